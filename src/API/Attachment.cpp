@@ -1,6 +1,8 @@
 #include "Attachment.h"
 #include "Core.h"
 #include "../Model/Attachment.h"
+#include "../Model/Step.h"
+#include "../Services/Metrics/IOverheadGovernor.h"
 #include "../Services/System/IUUIDGeneratorService.h"
 
 #include <cstring>
@@ -75,26 +77,39 @@ void Attachment::attach() {
     if (m_type.find("text/") == 0) extension = ".txt";
     else if (m_type.find("image/png") == 0) extension = ".png";
     else if (m_type.find("image/jpeg") == 0) extension = ".jpg";
+    else if (m_type.find("image/svg+xml") == 0) extension = ".svg";
     else if (m_type.find("application/json") == 0) extension = ".json";
     else if (m_type.find("application/xml") == 0) extension = ".xml";
     else extension = ".dat";
 
     std::string filename = uuid + "-attachment" + extension;
 
-    // Write attachment file to output folder
-    std::string outputFolder = detail::getTestProgram().getOutputFolder();
-    std::string filepath = outputFolder + "/" + filename;
-
-    std::ofstream outFile(filepath, std::ios::binary);
-    if (outFile.is_open()) {
+    // Under high overhead, the file is only written at the end of the test if it fails
+    bool deferred = detail::getServicesFactory()->buildOverheadGovernor()->isDeferringAttachments();
+    if (deferred) {
+        testCase->addDeferredAttachment(filename, std::string(m_data.data(), m_data.size()));
+    } else {
+        // Write attachment file to output folder
+        std::string outputFolder = detail::getTestProgram().getOutputFolder();
+        std::string filepath = outputFolder + "/" + filename;
+
+        std::ofstream outFile(filepath, std::ios::binary);
+        if (!outFile.is_open()) {
+            return;
+        }
         outFile.write(m_data.data(), m_data.size());
         outFile.close();
+    }
 
-        // Add attachment reference to test case
-        model::Attachment attachment;
-        attachment.setName(m_name);
-        attachment.setSource(filename);
-        attachment.setType(m_type);
+    // Add attachment reference to the running step, or to the test case outside of steps
+    model::Attachment attachment;
+    attachment.setName(m_name);
+    attachment.setSource(filename);
+    attachment.setType(m_type);
+    model::Step* step = testCase->getRunningStep();
+    if (step) {
+        step->addAttachment(attachment);
+    } else {
         testCase->addAttachment(attachment);
     }
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "CaptureLevel.h"
+
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -9,8 +12,13 @@ namespace allure {
 /**
  * @file Attachment.h
  * @brief Builders for adding attachments to the running test or step.
+ *
+ * When ALLURE_CAPTURE_LEVEL compiles test reporting away (see CaptureLevel.h),
+ * attachments are inline no-ops: data is neither copied nor read from files.
  */
 
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_TESTS
+
 /**
  * @brief Attachment builder for adding files, screenshots, and logs to test reports.
  *
@@ -83,4 +91,35 @@ void attachText(std::string_view name, std::string_view content);
  */
 void attachFile(std::string_view name, std::string_view filePath);
 
+#else
+
+inline namespace elided {
+
+/**
+ * @brief No-op attachment builder, used when ALLURE_CAPTURE_LEVEL compiles test reporting away.
+ */
+class Attachment {
+public:
+    static constexpr Attachment fromBinary(std::string_view, std::string_view, const void*, size_t) noexcept {
+        return Attachment();
+    }
+    static constexpr Attachment fromText(std::string_view, std::string_view) noexcept {
+        return Attachment();
+    }
+    static constexpr Attachment fromFile(std::string_view, std::string_view) noexcept {
+        return Attachment();
+    }
+    constexpr void attach() const noexcept {}
+
+private:
+    constexpr Attachment() noexcept = default;
+};
+
+constexpr void attachText(std::string_view, std::string_view) noexcept {}
+constexpr void attachFile(std::string_view, std::string_view) noexcept {}
+
+} // namespace elided
+
+#endif
+
 } // namespace allure
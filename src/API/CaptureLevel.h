@@ -0,0 +1,36 @@
+#pragma once
+
+/**
+ * @file CaptureLevel.h
+ * @brief Compile-time capture level of the Allure API.
+ *
+ * `ALLURE_CAPTURE_LEVEL` selects which API calls are compiled in:
+ * - `ALLURE_CAPTURE_STEPS` (2, default): everything is reported.
+ * - `ALLURE_CAPTURE_TESTS` (1): steps are compiled away; test metadata,
+ *   attachments, logs, counters and gauges are still reported.
+ * - `ALLURE_CAPTURE_NONE` (0): all of the above are compiled away.
+ *
+ * Compiled-away calls are inline no-ops: step names, format arguments and
+ * metadata are never evaluated into strings, and step lambdas are called
+ * directly, so an optimized build produces the same object code as the test
+ * source without any Allure call. This lets the same tests be built as a
+ * "perf" binary and as a "report" binary:
+ * @code
+ *   target_compile_definitions(MyPerfTests PRIVATE ALLURE_CAPTURE_LEVEL=0)
+ * @endcode
+ * The no-op API lives in the inline namespace `allure::elided`, so translation
+ * units built at different levels can be linked into the same program.
+ * The library itself is always built with the full API.
+ */
+
+#define ALLURE_CAPTURE_NONE 0
+#define ALLURE_CAPTURE_TESTS 1
+#define ALLURE_CAPTURE_STEPS 2
+
+#ifndef ALLURE_CAPTURE_LEVEL
+    #define ALLURE_CAPTURE_LEVEL ALLURE_CAPTURE_STEPS
+#endif
+
+#if (ALLURE_CAPTURE_LEVEL < ALLURE_CAPTURE_NONE) || (ALLURE_CAPTURE_LEVEL > ALLURE_CAPTURE_STEPS)
+    #error "ALLURE_CAPTURE_LEVEL must be 0 (none), 1 (tests) or 2 (steps)"
+#endif
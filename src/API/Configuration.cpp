@@ -0,0 +1,179 @@
+#include "Configuration.h"
+#include "Core.h"
+
+#include "../Model/ClockSource.h"
+#include "../Model/PerfCounter.h"
+#include "../Model/SeriesFormat.h"
+#include "../Model/StepDetailPolicy.h"
+
+#include "../Services/Capture/IOutputCapture.h"
+#include "../Services/Log/ILogRingBuffer.h"
+#include "../Services/Metrics/IAllocationTracker.h"
+#include "../Services/Metrics/IOverheadGovernor.h"
+#include "../Services/Metrics/IPerfCounterGroup.h"
+#include "../Services/Metrics/IResourceUsageMonitor.h"
+#include "../Services/Metrics/ISelfProfiler.h"
+#include "../Services/Metrics/ITestMetricRegistry.h"
+#include "../Services/Report/IChromeTraceWriter.h"
+#include "../Services/Report/IDurationBaselineStore.h"
+#include "../Services/Report/IFlameGraphBuilder.h"
+
+namespace allure {
+
+namespace {
+    // The API enums mirror the model ones, so that the public header needs no model header
+    static_assert(static_cast<int>(StepDetailPolicy::SUMMARY_ON_PASS) == static_cast<int>(model::StepDetailPolicy::SUMMARY_ON_PASS) &&
+                  static_cast<int>(StepDetailPolicy::TOP_LEVEL_ON_PASS) == static_cast<int>(model::StepDetailPolicy::TOP_LEVEL_ON_PASS),
+                  "StepDetailPolicy does not match model::StepDetailPolicy");
+    static_assert(static_cast<int>(ClockSource::MONOTONIC) == static_cast<int>(model::ClockSource::MONOTONIC) &&
+                  static_cast<int>(ClockSource::MONOTONIC_COARSE) == static_cast<int>(model::ClockSource::MONOTONIC_COARSE),
+                  "ClockSource does not match model::ClockSource");
+    static_assert(static_cast<int>(PerfCounter::CONTEXT_SWITCHES) == static_cast<int>(model::PerfCounter::CONTEXT_SWITCHES) &&
+                  static_cast<int>(PerfCounter::TASK_CLOCK) == static_cast<int>(model::PerfCounter::TASK_CLOCK),
+                  "PerfCounter does not match model::PerfCounter");
+    static_assert(static_cast<int>(SeriesFormat::JSON) == static_cast<int>(model::SeriesFormat::JSON),
+                  "SeriesFormat does not match model::SeriesFormat");
+}
+
+Configuration& Configuration::logBufferSize(std::size_t bytes) {
+    detail::getServicesFactory()->buildLogRingBuffer()->setCapacity(bytes);
+    return *this;
+}
+
+Configuration& Configuration::captureOutput(bool enabled) {
+    detail::getServicesFactory()->buildOutputCapture()->setEnabled(enabled);
+    return *this;
+}
+
+Configuration& Configuration::captureOutputOnlyOnFailure(bool onlyOnFailure) {
+    detail::getServicesFactory()->buildOutputCapture()->setOnlyOnFailure(onlyOnFailure);
+    return *this;
+}
+
+Configuration& Configuration::teeCapturedOutput(bool tee) {
+    detail::getServicesFactory()->buildOutputCapture()->setTee(tee);
+    return *this;
+}
+
+Configuration& Configuration::captureMemoryLimit(std::size_t bytes) {
+    detail::getServicesFactory()->buildOutputCapture()->setMemoryLimit(bytes);
+    return *this;
+}
+
+Configuration& Configuration::stepDetail(StepDetailPolicy policy) {
+    detail::getTestProgram().setStepDetailPolicy(static_cast<model::StepDetailPolicy>(policy));
+    return *this;
+}
+
+Configuration& Configuration::stepCoalescingThreshold(unsigned int threshold) {
+    detail::getTestProgram().setStepCoalescingThreshold(threshold);
+    return *this;
+}
+
+Configuration& Configuration::maxStepsPerTest(unsigned int maxSteps) {
+    detail::getTestProgram().setMaxStepsPerTest(maxSteps);
+    return *this;
+}
+
+Configuration& Configuration::maxStepDepth(unsigned int maxDepth) {
+    detail::getTestProgram().setMaxStepDepth(maxDepth);
+    return *this;
+}
+
+Configuration& Configuration::maxStatusDetailBytes(std::size_t bytes) {
+    detail::getTestProgram().setMaxStatusDetailBytes(bytes);
+    return *this;
+}
+
+Configuration& Configuration::clockSource(ClockSource source) {
+    detail::getTestProgram().setClockSource(static_cast<model::ClockSource>(source));
+    return *this;
+}
+
+Configuration& Configuration::timelineScale(unsigned int scale) {
+    detail::getTestProgram().setTimelineScale(scale);
+    return *this;
+}
+
+Configuration& Configuration::resourceUsage(bool enabled) {
+    detail::getServicesFactory()->buildResourceUsageMonitor()->setEnabled(enabled);
+    return *this;
+}
+
+Configuration& Configuration::perfCounters(const std::vector<PerfCounter>& counters) {
+    std::vector<model::PerfCounter> modelCounters;
+    for (PerfCounter counter : counters) {
+        modelCounters.push_back(static_cast<model::PerfCounter>(counter));
+    }
+    detail::getServicesFactory()->buildPerfCounterGroup()->setCounters(modelCounters);
+    return *this;
+}
+
+Configuration& Configuration::perfCountersPerStep(bool perStep) {
+    detail::getServicesFactory()->buildPerfCounterGroup()->setPerStep(perStep);
+    return *this;
+}
+
+Configuration& Configuration::trackAllocations(bool enabled) {
+    detail::getServicesFactory()->buildAllocationTracker()->setEnabled(enabled);
+    return *this;
+}
+
+Configuration& Configuration::durationBaseline(bool enabled, unsigned int window) {
+    auto durationBaselineStore = detail::getServicesFactory()->buildDurationBaselineStore();
+    durationBaselineStore->setEnabled(enabled);
+    durationBaselineStore->setWindow(window);
+    return *this;
+}
+
+Configuration& Configuration::regressionThreshold(double standardDeviations) {
+    detail::getServicesFactory()->buildDurationBaselineStore()->setThreshold(standardDeviations);
+    return *this;
+}
+
+Configuration& Configuration::markRegressionsFlaky(bool flaky) {
+    detail::getServicesFactory()->buildDurationBaselineStore()->setMarkFlaky(flaky);
+    return *this;
+}
+
+Configuration& Configuration::markRegressionsKnown(bool known) {
+    detail::getServicesFactory()->buildDurationBaselineStore()->setMarkKnown(known);
+    return *this;
+}
+
+Configuration& Configuration::gaugeSampling(std::chrono::nanoseconds interval, std::size_t maxSamples) {
+    auto testMetricRegistry = detail::getServicesFactory()->buildTestMetricRegistry();
+    testMetricRegistry->setSampleIntervalNanoseconds(interval.count());
+    testMetricRegistry->setMaxSamples(maxSamples);
+    return *this;
+}
+
+Configuration& Configuration::gaugeSeriesFormat(SeriesFormat format) {
+    detail::getServicesFactory()->buildTestMetricRegistry()->setSeriesFormat(static_cast<model::SeriesFormat>(format));
+    return *this;
+}
+
+Configuration& Configuration::chromeTrace(bool enabled) {
+    detail::getServicesFactory()->buildChromeTraceWriter()->setEnabled(enabled);
+    return *this;
+}
+
+Configuration& Configuration::flameGraphs(bool enabled) {
+    detail::getServicesFactory()->buildFlameGraphBuilder()->setEnabled(enabled);
+    return *this;
+}
+
+Configuration& Configuration::selfProfiling(bool enabled) {
+    detail::getServicesFactory()->buildSelfProfiler()->setEnabled(enabled);
+    return *this;
+}
+
+Configuration& Configuration::overheadBudget(double maxRatio, unsigned int window) {
+    auto governor = detail::getServicesFactory()->buildOverheadGovernor();
+    governor->setBudget(maxRatio);
+    governor->setWindow(window);
+    governor->setEnabled(maxRatio > 0.0);
+    return *this;
+}
+
+} // namespace allure
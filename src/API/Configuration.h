@@ -0,0 +1,368 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace allure {
+
+/**
+ * @file Configuration.h
+ * @brief Run-wide settings for the Allure reporting pipeline.
+ */
+
+/// How much step detail is written for passing tests, see Configuration::stepDetail().
+enum class StepDetailPolicy {
+    FULL = 0,               ///< The full step tree.
+    TOP_LEVEL_ON_PASS = 1,  ///< Only the top-level steps, with a "nested steps" count.
+    SUMMARY_ON_PASS = 2     ///< No steps, only a "steps" count.
+};
+
+/// Clock of the start/stop timestamps, see Configuration::clockSource().
+enum class ClockSource {
+    SYSTEM = 0,            ///< The system clock, read at every timestamp.
+    MONOTONIC = 1,         ///< A monotonic clock anchored once to the system clock.
+    MONOTONIC_COARSE = 2   ///< Same as MONOTONIC, with the cheapest (tick resolution) clock.
+};
+
+/// Performance counter of the test thread, see Configuration::perfCounters().
+enum class PerfCounter {
+    INSTRUCTIONS = 0,
+    CYCLES = 1,
+    CACHE_MISSES = 2,
+    BRANCH_MISSES = 3,
+    TASK_CLOCK = 4,
+    PAGE_FAULTS = 5,
+    CONTEXT_SWITCHES = 6
+};
+
+/// Format of the "gauges" attachment, see Configuration::gaugeSeriesFormat().
+enum class SeriesFormat {
+    CSV = 0,
+    JSON = 1
+};
+
+/**
+ * @brief Fluent setter for run-wide Allure settings.
+ *
+ * Each setter takes effect immediately. Configure before tests start running.
+ *
+ * Example usage:
+ * @code
+ *   allure::configure()
+ *       .logBufferSize(16 * 1024)
+ *       .captureOutput()
+ *       .captureOutputOnlyOnFailure();
+ * @endcode
+ */
+class Configuration {
+public:
+    /**
+     * @brief Sets the capacity of the per-test log buffer used by allure::log().
+     *
+     * Only the last `bytes` bytes logged by a test are kept and attached on
+     * failure. A value of 0 disables logging entirely.
+     * @param bytes Buffer capacity in bytes (default 64 KiB).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& logBufferSize(std::size_t bytes);
+
+    /**
+     * @brief Enables capturing of stdout/stderr written while each test runs.
+     *
+     * Both streams are redirected through a pipe drained by a background thread
+     * and attached to the result as a `text/plain` attachment named "output".
+     * Not supported on Windows, where this setting has no effect.
+     * @param enabled True to capture output (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& captureOutput(bool enabled = true);
+
+    /**
+     * @brief Attaches the captured output only for failed or broken tests.
+     * @param onlyOnFailure True to drop the output of passing tests (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& captureOutputOnlyOnFailure(bool onlyOnFailure = true);
+
+    /**
+     * @brief Keeps forwarding captured output to the original stdout.
+     * @param tee True to also print what is captured (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& teeCapturedOutput(bool tee = true);
+
+    /**
+     * @brief Sets how many captured bytes per test are kept in memory.
+     *
+     * Output beyond this limit spills into a temporary file, so memory usage
+     * per test never exceeds the limit.
+     * @param bytes In-memory limit in bytes (default 256 KiB).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& captureMemoryLimit(std::size_t bytes);
+
+    /**
+     * @brief Controls how much step detail is written for passing tests.
+     *
+     * Failed and broken tests always keep the full step tree. For passing tests,
+     * TOP_LEVEL_ON_PASS keeps only the top-level steps (with a "nested steps"
+     * count) and SUMMARY_ON_PASS replaces all steps with a "steps" count
+     * parameter, reducing serialization and result file size.
+     * @param policy The step detail policy (default FULL).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& stepDetail(StepDetailPolicy policy);
+
+    /**
+     * @brief Sets after how many identical consecutive sibling steps they get merged.
+     *
+     * Sibling steps with the same name, type, status and parameters (and no
+     * nested steps or attachments) are collapsed into a single step carrying
+     * count, total, min, max, p50 and p99 duration parameters once the run
+     * reaches this length. Coalescing is off unless enabled here: a value
+     * of 0 disables it.
+     * @param threshold Minimum run length to coalesce (default 0, off).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& stepCoalescingThreshold(unsigned int threshold);
+
+    /**
+     * @brief Caps the number of steps recorded for a single test.
+     *
+     * Further steps still run but are only counted; the result gets a
+     * "Step limit reached" summary step. A value of 0 removes the limit.
+     * @param maxSteps Maximum recorded steps per test (default 10000).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& maxStepsPerTest(unsigned int maxSteps);
+
+    /**
+     * @brief Caps how deeply steps can be nested.
+     *
+     * Steps beyond this depth (and everything nested in them) are only counted.
+     * A value of 0 removes the limit.
+     * @param maxDepth Maximum nesting depth (default 64).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& maxStepDepth(unsigned int maxDepth);
+
+    /**
+     * @brief Caps the size of the failure message and trace of a test.
+     *
+     * Repeated failure messages are listed once with a count; the message keeps
+     * its beginning and the trace keeps its end. A value of 0 removes the limit.
+     * @param bytes Maximum bytes for each of message and trace (default 64 KiB).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& maxStatusDetailBytes(std::size_t bytes);
+
+    /**
+     * @brief Selects the clock used for start/stop timestamps.
+     *
+     * MONOTONIC and MONOTONIC_COARSE anchor the wall clock once and derive every
+     * later timestamp from a monotonic clock, so timestamps never go backwards
+     * and ignore NTP adjustments. MONOTONIC_COARSE is the cheapest to read but
+     * only has tick resolution (typically 1-4 ms on Linux).
+     * @param source The clock source (default SYSTEM).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& clockSource(ClockSource source);
+
+    /**
+     * @brief Stretches the report timeline so that very short tests are visible.
+     *
+     * Time elapsed since the start of the run is multiplied by `scale` before
+     * it is written as start/stop timestamps, so a 20 us step spans 20 ms with a
+     * scale of 1000. Relative order and proportions are kept, but the reported
+     * durations are scaled too. The unscaled duration is always written in the
+     * `durationNs` field of every test and step. A value of 1 disables scaling.
+     * @param scale Timeline scale factor (default 1).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& timelineScale(unsigned int scale);
+
+    /**
+     * @brief Records the resources consumed by each test as result parameters.
+     *
+     * Adds the CPU time (user/system), max RSS growth, current RSS delta, minor
+     * and major page faults, voluntary and involuntary context switches and
+     * block I/O operations measured between test start and end. CPU time,
+     * faults and switches are those of the test thread. Linux only; other
+     * platforms report partial or zero values.
+     * @param enabled True to record resource usage (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& resourceUsage(bool enabled = true);
+
+    /**
+     * @brief Records performance counters of the test thread for each test.
+     *
+     * The counters are read through perf_event_open() at test start and end and
+     * written as result parameters (e.g. "instructions", "cache misses").
+     * Instruction counts are much less noisy than wall time for regression
+     * tracking. When hardware counters are not accessible (VMs, containers)
+     * the task-clock, page-faults and context-switches software counters are
+     * reported instead. Linux only. An empty set disables the counters.
+     * @param counters Counters to record (default instructions, cycles,
+     *        cache misses and branch misses).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& perfCounters(const std::vector<PerfCounter>& counters = {
+        PerfCounter::INSTRUCTIONS, PerfCounter::CYCLES,
+        PerfCounter::CACHE_MISSES, PerfCounter::BRANCH_MISSES });
+
+    /**
+     * @brief Also records the configured performance counters for every step.
+     *
+     * Costs one read() syscall at the start and end of each step.
+     * @param perStep True to add the counters to steps (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& perfCountersPerStep(bool perStep = true);
+
+    /**
+     * @brief Records the heap allocations of each test and step as parameters.
+     *
+     * Adds "allocations", "bytes allocated" and "peak live bytes" to every test
+     * and step. Allocations are counted through the global operator new/delete,
+     * which requires building with ALLURE_TRACK_ALLOCATIONS=ON (or, with the
+     * CppUTest adapter, through CppUTest's allocators). Allocations of all
+     * threads are counted, except those made by Allure itself. Without hooks
+     * this setting has no effect.
+     * @param enabled True to track allocations (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& trackAllocations(bool enabled = true);
+
+    /**
+     * @brief Flags tests that got slower than their duration baseline.
+     *
+     * The durations of the last `window` passing runs of every test are kept
+     * per historyId in `history/duration-baseline.jsonl` of the output folder,
+     * together with their mean, standard deviation, p50 and p95. The file is
+     * read when the program starts and updated when it ends. Once a test has
+     * at least 5 runs, it is flagged when it takes longer than its mean plus
+     * regressionThreshold() standard deviations (and at least 10% more than
+     * the mean): it gets a "performance-regression" tag and a statusDetails
+     * message comparing its duration with the baseline.
+     * @param enabled True to keep and check baselines (default false).
+     * @param window Number of recent runs kept per test (default 20, min 5).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& durationBaseline(bool enabled = true, unsigned int window = 20);
+
+    /**
+     * @brief Sets how far above its baseline mean a duration is a regression.
+     * @param standardDeviations Threshold in standard deviations (default 3).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& regressionThreshold(double standardDeviations);
+
+    /**
+     * @brief Also marks tests with a duration regression as flaky.
+     * @param flaky True to set statusDetails.flaky (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& markRegressionsFlaky(bool flaky = true);
+
+    /**
+     * @brief Also marks tests with a duration regression as known issues.
+     * @param known True to set statusDetails.known (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& markRegressionsKnown(bool known = true);
+
+    /**
+     * @brief Sets how often allure::gauge() values are sampled.
+     *
+     * A gauge keeps at most one sample per interval. When its series reaches
+     * `maxSamples`, every other sample is dropped and the interval doubles,
+     * so long tests keep a bounded series covering their whole duration.
+     * @param interval Minimum time between samples (default 10 ms).
+     * @param maxSamples Maximum samples per gauge and test (default 1024, min 2).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& gaugeSampling(std::chrono::nanoseconds interval, std::size_t maxSamples = 1024);
+
+    /**
+     * @brief Selects the format of the "gauges" attachment.
+     *
+     * CSV has one `gauge,time_ms,value` row per sample; JSON maps each gauge
+     * to an array of `[time_ms, value]` pairs. Times are relative to the test start.
+     * @param format The series format (default CSV).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& gaugeSeriesFormat(SeriesFormat format);
+
+    /**
+     * @brief Writes a Chrome Trace Event timeline of the whole run to `trace.json`.
+     *
+     * Every suite, test and step becomes a complete event on the track of the
+     * thread that ran it, with its status, parameters and attachments as args
+     * (tests also carry the uuid of their result file). Events are streamed to
+     * the output folder as they end. Open the file with Perfetto
+     * (ui.perfetto.dev) or chrome://tracing to see where time goes across
+     * threads at step granularity.
+     * @param enabled True to write the trace (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& chromeTrace(bool enabled = true);
+
+    /**
+     * @brief Produces flame graphs of where test time goes, by step path.
+     *
+     * The step tree of each test is folded into collapsed stacks
+     * (`suite;test;step;substep self-ns`) and attached to its result together
+     * with a self-contained SVG flame graph. Stacks of all tests are merged as
+     * they end and written for the whole run as `flamegraph.folded` and
+     * `flamegraph.svg`; memory grows with the number of distinct step paths
+     * only. The folded file can be loaded into speedscope or flamegraph.pl.
+     * @param enabled True to produce flame graphs (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& flameGraphs(bool enabled = true);
+
+    /**
+     * @brief Reports the overhead of Allure itself at the end of the run.
+     *
+     * Writes the time spent per phase (step guards, event handlers,
+     * serialization, file I/O, UUID generation), the files and bytes written
+     * and Allure's own allocations to `allure-stats.json` and
+     * `environment.properties`. The same totals are available at any time
+     * from allure::stats(). Requires building with ALLURE_SELF_PROFILING=ON,
+     * which otherwise compiles the instrumentation out; without it this
+     * setting has no effect.
+     * @param enabled True to report the overhead (default false).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& selfProfiling(bool enabled = true);
+
+    /**
+     * @brief Lowers capture detail automatically when Allure's overhead is too high.
+     *
+     * Compares the time spent by Allure with the duration of the last `window`
+     * tests. While the ratio exceeds `maxRatio`, detail is lowered one level
+     * at a time: steps are coalesced from 2 repetitions, then step trees of
+     * passing tests are summarized, then attachments are only written for
+     * failed tests. Detail comes back one level at a time once the ratio falls
+     * below half of `maxRatio`. Each result gets a "capture level" parameter.
+     * Allure's time is measured by the self-profiling instrumentation, which
+     * requires building with ALLURE_SELF_PROFILING=ON; without it detail is
+     * never lowered.
+     * @param maxRatio Highest acceptable Allure time / test time ratio (default 0.03, 0 to disable).
+     * @param window Number of tests the ratio is computed over (default 20).
+     * @return Reference to this builder for method chaining.
+     */
+    Configuration& overheadBudget(double maxRatio = 0.03, unsigned int window = 20);
+};
+
+/**
+ * @brief Entry point for run-wide configuration.
+ * @return A Configuration builder.
+ */
+inline Configuration configure() {
+    return Configuration();
+}
+
+} // namespace allure
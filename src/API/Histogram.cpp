@@ -0,0 +1,249 @@
+#include "Histogram.h"
+#include "Attachment.h"
+#include "Core.h"
+#include "Utils.h"
+#include "../Model/Parameter.h"
+#include "../Services/Report/XMLUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+namespace allure {
+
+namespace {
+    struct ReportedPercentile {
+        const char* name;
+        double percentile;
+    };
+
+    constexpr ReportedPercentile REPORTED_PERCENTILES[] = {
+        { "p50", 50.0 }, { "p90", 90.0 }, { "p99", 99.0 }, { "p99.9", 99.9 }
+    };
+
+    constexpr int SVG_WIDTH = 640;
+    constexpr int SVG_HEIGHT = 360;
+    constexpr int SVG_LEFT = 80;
+    constexpr int SVG_RIGHT = 20;
+    constexpr int SVG_TOP = 30;
+    constexpr int SVG_BOTTOM = 40;
+    constexpr int MAX_PLOTTED_NINES = 5;
+
+    model::Parameter buildParameter(const std::string& name, const std::string& value) {
+        model::Parameter parameter;
+        parameter.setName(name);
+        parameter.setValue(value);
+        parameter.setExcluded(true);
+        return parameter;
+    }
+}
+
+Histogram::Histogram()
+    : Histogram(std::string_view())
+{
+}
+
+Histogram::Histogram(std::string_view name)
+    : m_name(name)
+    , m_reported(false)
+    , m_buckets(new std::atomic<std::uint64_t>[BUCKET_COUNT]())
+    , m_count(0)
+    , m_sum(0)
+    , m_min(std::numeric_limits<std::uint64_t>::max())
+    , m_max(0)
+{
+}
+
+Histogram::~Histogram() noexcept {
+    if (m_name.empty() || m_reported) {
+        return;
+    }
+
+    try {
+        report();
+    }
+    catch (...) {
+        // Destructor must not throw, call report() to see reporting errors
+    }
+}
+
+void Histogram::merge(const Histogram& other) noexcept {
+    for (std::size_t i = 0; i < BUCKET_COUNT; i++) {
+        std::uint64_t count = other.m_buckets[i].load(std::memory_order_relaxed);
+        if (count > 0) {
+            m_buckets[i].fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+    m_count.fetch_add(other.m_count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_sum.fetch_add(other.m_sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    updateMin(other.m_min.load(std::memory_order_relaxed));
+    updateMax(other.m_max.load(std::memory_order_relaxed));
+}
+
+void Histogram::reset() noexcept {
+    for (std::size_t i = 0; i < BUCKET_COUNT; i++) {
+        m_buckets[i].store(0, std::memory_order_relaxed);
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::getCount() const noexcept {
+    return m_count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::getMin() const noexcept {
+    return (getCount() > 0) ? m_min.load(std::memory_order_relaxed) : 0;
+}
+
+std::uint64_t Histogram::getMax() const noexcept {
+    return m_max.load(std::memory_order_relaxed);
+}
+
+double Histogram::getMean() const noexcept {
+    std::uint64_t count = getCount();
+    return (count > 0) ? static_cast<double>(m_sum.load(std::memory_order_relaxed)) / count : 0.0;
+}
+
+std::uint64_t Histogram::getValueAtPercentile(double percentile) const noexcept {
+    std::uint64_t count = getCount();
+    if (count == 0) {
+        return 0;
+    }
+
+    double fraction = std::min(std::max(percentile, 0.0), 100.0) / 100.0;
+    std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(fraction * count)));
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; i++) {
+        cumulative += m_buckets[i].load(std::memory_order_relaxed);
+        if (cumulative >= rank) {
+            return std::min(getBucketHighestValue(i), getMax());
+        }
+    }
+    return getMax();
+}
+
+std::uint64_t Histogram::getBucketLowestValue(std::size_t index) noexcept {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    unsigned shift = static_cast<unsigned>(index / SUB_BUCKET_COUNT) - 1;
+    return static_cast<std::uint64_t>(SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT) << shift;
+}
+
+std::uint64_t Histogram::getBucketHighestValue(std::size_t index) noexcept {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    unsigned shift = static_cast<unsigned>(index / SUB_BUCKET_COUNT) - 1;
+    return getBucketLowestValue(index) + ((std::uint64_t(1) << shift) - 1);
+}
+
+std::string Histogram::toJSON() const {
+    nlohmann::ordered_json histogram;
+    histogram["name"] = m_name;
+    histogram["unit"] = "ns";
+    histogram["count"] = getCount();
+    histogram["min"] = getMin();
+    histogram["max"] = getMax();
+    histogram["mean"] = getMean();
+
+    nlohmann::ordered_json percentiles = nlohmann::ordered_json::object();
+    for (const auto& reported : REPORTED_PERCENTILES) {
+        percentiles[reported.name] = getValueAtPercentile(reported.percentile);
+    }
+    histogram["percentiles"] = percentiles;
+
+    nlohmann::ordered_json buckets = nlohmann::ordered_json::array();
+    for (std::size_t i = 0; i < BUCKET_COUNT; i++) {
+        std::uint64_t count = m_buckets[i].load(std::memory_order_relaxed);
+        if (count > 0) {
+            buckets.push_back({ { "from", getBucketLowestValue(i) }, { "to", getBucketHighestValue(i) }, { "count", count } });
+        }
+    }
+    histogram["buckets"] = buckets;
+    return histogram.dump();
+}
+
+std::string Histogram::toSVG() const {
+    const double plotWidth = SVG_WIDTH - SVG_LEFT - SVG_RIGHT;
+    const double plotHeight = SVG_HEIGHT - SVG_TOP - SVG_BOTTOM;
+    std::uint64_t count = getCount();
+    double maxValue = static_cast<double>(std::max<std::uint64_t>(getMax(), 1));
+
+    // The x axis spreads the tail: each decade of nines (90%, 99%, 99.9%...) gets the same width
+    int nines = std::max(1, std::min(MAX_PLOTTED_NINES, static_cast<int>(std::ceil(std::log10(std::max<double>(count, 10.0))))));
+    auto x = [&](double fraction) {
+        double remaining = std::max(1.0 - fraction, std::pow(10.0, -nines));
+        return SVG_LEFT + (-std::log10(remaining) / nines) * plotWidth;
+    };
+    auto y = [&](double value) {
+        return SVG_TOP + plotHeight - (value / maxValue) * plotHeight;
+    };
+
+    std::string svg = fmt::format(
+        "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"{0}\" height=\"{1}\" viewBox=\"0 0 {0} {1}\" "
+        "font-family=\"sans-serif\" font-size=\"11\">\n"
+        "<rect width=\"{0}\" height=\"{1}\" fill=\"white\"/>\n"
+        "<text x=\"{2}\" y=\"18\" font-size=\"13\">{3} (latency by percentile, {4} values)</text>\n",
+        SVG_WIDTH, SVG_HEIGHT, SVG_LEFT, service::escapeXML(m_name.empty() ? std::string("histogram") : m_name), count);
+
+    for (int tick = 0; tick <= 4; tick++) {
+        double value = maxValue * tick / 4;
+        svg += fmt::format("<line x1=\"{0}\" y1=\"{1:.1f}\" x2=\"{2}\" y2=\"{1:.1f}\" stroke=\"#ddd\"/>"
+                           "<text x=\"{3}\" y=\"{4:.1f}\" text-anchor=\"end\">{5}</text>\n",
+                           SVG_LEFT, y(value), SVG_WIDTH - SVG_RIGHT, SVG_LEFT - 6, y(value) + 4,
+                           detail::formatNanoseconds(value));
+    }
+    for (int nine = 0; nine <= nines; nine++) {
+        double fraction = 1.0 - std::pow(10.0, -nine);
+        std::string label = (nine == 0) ? "0%" : fmt::format("{:.{}f}%", fraction * 100.0, std::max(0, nine - 2));
+        svg += fmt::format("<line x1=\"{0:.1f}\" y1=\"{1}\" x2=\"{0:.1f}\" y2=\"{2}\" stroke=\"#ddd\"/>"
+                           "<text x=\"{0:.1f}\" y=\"{3}\" text-anchor=\"middle\">{4}</text>\n",
+                           x(fraction), SVG_TOP, SVG_HEIGHT - SVG_BOTTOM, SVG_HEIGHT - SVG_BOTTOM + 16, label);
+    }
+
+    // Each bucket is a flat segment spanning the percentiles of the values it holds
+    std::string points;
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; (i < BUCKET_COUNT) && (count > 0); i++) {
+        std::uint64_t bucketCount = m_buckets[i].load(std::memory_order_relaxed);
+        if (bucketCount == 0) {
+            continue;
+        }
+        double value = static_cast<double>(std::min(getBucketHighestValue(i), getMax()));
+        double from = static_cast<double>(cumulative) / count;
+        cumulative += bucketCount;
+        double to = static_cast<double>(cumulative) / count;
+        points += fmt::format("{:.1f},{:.1f} {:.1f},{:.1f} ", x(from), y(value), x(to), y(value));
+    }
+    svg += fmt::format("<polyline fill=\"none\" stroke=\"#1f77b4\" stroke-width=\"2\" points=\"{}\"/>\n", points);
+    svg += "</svg>\n";
+    return svg;
+}
+
+void Histogram::report() {
+    m_reported = true;
+    auto* testCase = detail::getTestProgram().getRunningTestCase();
+    if (!testCase || (getCount() == 0)) {
+        return;
+    }
+
+    for (const auto& reported : REPORTED_PERCENTILES) {
+        testCase->addParameter(buildParameter(m_name + " " + reported.name,
+            detail::formatNanoseconds(static_cast<double>(getValueAtPercentile(reported.percentile)))));
+    }
+    testCase->addParameter(buildParameter(m_name + " max", detail::formatNanoseconds(static_cast<double>(getMax()))));
+    testCase->addParameter(buildParameter(m_name + " count", std::to_string(getCount())));
+
+    std::string json = toJSON();
+    Attachment::fromBinary(m_name + " histogram", "application/json", json.data(), json.size()).attach();
+    std::string svg = toSVG();
+    Attachment::fromBinary(m_name + " plot", "image/svg+xml", svg.data(), svg.size()).attach();
+}
+
+} // namespace allure
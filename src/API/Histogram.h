@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace allure {
+
+/**
+ * @file Histogram.h
+ * @brief Lock-free latency histograms reported as parameters and attachments of the running test.
+ */
+
+/**
+ * @brief Thread-safe, log-bucketed latency recorder with fixed memory.
+ *
+ * Values (nanoseconds) below 128 get a bucket each; above, every power of two
+ * is split into 128 linear sub-buckets, so each recorded value is known
+ * within 1% (as an HDR histogram with 2 significant digits). The whole
+ * 64-bit range is covered by 7424 buckets allocated once. Recording is a few
+ * relaxed atomic increments, without locks or allocations, and may happen
+ * from any number of threads.
+ *
+ * To keep threads from contending on the same counters, each thread can
+ * record into its own unnamed histogram and merge() it into the named one.
+ *
+ * A named histogram is reported when it is destroyed (or on report()): the
+ * running test gets `<name> p50`, `p90`, `p99`, `p99.9`, `max` and `count`
+ * parameters, a JSON attachment with the non-empty buckets and an SVG plot of
+ * the latency by percentile.
+ *
+ * Example usage:
+ * @code
+ *   allure::Histogram latency("request latency");
+ *   for (const auto& request : requests) {
+ *       auto start = std::chrono::steady_clock::now();
+ *       client.send(request);
+ *       latency.record(std::chrono::steady_clock::now() - start);
+ *   }
+ * @endcode
+ */
+class Histogram {
+public:
+    /** @brief Bits of the linear sub-buckets each power of two is split into. */
+    static constexpr unsigned SUB_BUCKET_BITS = 7;
+    static constexpr std::size_t SUB_BUCKET_COUNT = std::size_t(1) << SUB_BUCKET_BITS;
+    static constexpr std::size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    /** @brief Creates an unnamed histogram, never reported (e.g. a per-thread one to merge). */
+    Histogram();
+
+    /**
+     * @brief Creates a histogram reported to the running test when destroyed.
+     * @param name Name of the histogram, prefixing its parameters and attachments.
+     */
+    explicit Histogram(std::string_view name);
+
+    /**
+     * @brief Reports the histogram if it is named and was not reported yet.
+     *
+     * Reporting errors are ignored here; call report() to get them.
+     */
+    ~Histogram() noexcept;
+
+    Histogram(const Histogram&) = delete;
+    Histogram& operator=(const Histogram&) = delete;
+
+    /**
+     * @brief Records a value.
+     * @param nanoseconds The latency in nanoseconds.
+     */
+    void record(std::uint64_t nanoseconds) noexcept {
+        m_buckets[getBucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+        updateMin(nanoseconds);
+        updateMax(nanoseconds);
+    }
+
+    /**
+     * @brief Records a duration.
+     * @param duration The latency; negative durations are recorded as 0.
+     */
+    template<typename Rep, typename Period>
+    void record(std::chrono::duration<Rep, Period> duration) noexcept {
+        auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        record(static_cast<std::uint64_t>(nanoseconds > 0 ? nanoseconds : 0));
+    }
+
+    /**
+     * @brief Adds all values recorded by another histogram.
+     *
+     * Only reads the other histogram, so it may go on recording meanwhile.
+     * @param other The histogram to merge into this one.
+     */
+    void merge(const Histogram& other) noexcept;
+
+    /** @brief Forgets all recorded values. Not safe while other threads record. */
+    void reset() noexcept;
+
+    std::uint64_t getCount() const noexcept;
+    std::uint64_t getMin() const noexcept;
+    std::uint64_t getMax() const noexcept;
+    double getMean() const noexcept;
+
+    /**
+     * @brief Gets the value below which a percentage of the recorded values fall.
+     * @param percentile Percentage between 0 and 100.
+     * @return The highest value of the bucket holding that percentile (at most the maximum), or 0 if empty.
+     */
+    std::uint64_t getValueAtPercentile(double percentile) const noexcept;
+
+    /** @brief Serializes the non-empty buckets and summary statistics as JSON. */
+    std::string toJSON() const;
+
+    /** @brief Renders the latency by percentile as an SVG plot. */
+    std::string toSVG() const;
+
+    /**
+     * @brief Adds the percentiles and attachments to the running test.
+     *
+     * Does nothing when no test is running or nothing was recorded.
+     * Unlike the destructor, it lets errors (e.g. writing the attachment) propagate.
+     */
+    void report();
+
+    /** @brief Index of the bucket holding a value. */
+    static std::size_t getBucketIndex(std::uint64_t value) noexcept {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<std::size_t>(value);
+        }
+        unsigned msb = getMostSignificantBit(value);
+        unsigned shift = msb - SUB_BUCKET_BITS;
+        return static_cast<std::size_t>((shift + 1) * SUB_BUCKET_COUNT + ((value >> shift) - SUB_BUCKET_COUNT));
+    }
+
+    /** @brief Lowest value held by a bucket. */
+    static std::uint64_t getBucketLowestValue(std::size_t index) noexcept;
+
+    /** @brief Highest value held by a bucket. */
+    static std::uint64_t getBucketHighestValue(std::size_t index) noexcept;
+
+private:
+    static unsigned getMostSignificantBit(std::uint64_t value) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<unsigned>(index);
+#else
+        return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#endif
+    }
+
+    void updateMin(std::uint64_t value) noexcept {
+        std::uint64_t current = m_min.load(std::memory_order_relaxed);
+        while ((value < current) && !m_min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    void updateMax(std::uint64_t value) noexcept {
+        std::uint64_t current = m_max.load(std::memory_order_relaxed);
+        while ((value > current) && !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::string m_name;
+    bool m_reported;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> m_buckets;
+    std::atomic<std::uint64_t> m_count;
+    std::atomic<std::uint64_t> m_sum;
+    std::atomic<std::uint64_t> m_min;
+    std::atomic<std::uint64_t> m_max;
+};
+
+} // namespace allure
@@ -0,0 +1,19 @@
+#include "Log.h"
+#include "Core.h"
+
+#include "../Services/Log/ILogRingBuffer.h"
+
+namespace allure {
+namespace detail {
+
+bool isLogRetained() {
+    return getServicesFactory()->buildLogRingBuffer()->isEnabled() &&
+           (getTestProgram().getRunningTestCase() != nullptr);
+}
+
+void appendLog(std::string_view line) {
+    getServicesFactory()->buildLogRingBuffer()->append(line);
+}
+
+} // namespace detail
+} // namespace allure
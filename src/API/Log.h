@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CaptureLevel.h"
+
+#include <fmt/format.h>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace allure {
+
+/**
+ * @file Log.h
+ * @brief Lightweight per-test logging sink attached to the report only on failure.
+ */
+
+namespace detail {
+
+/**
+ * @brief Checks whether a log message written now would be kept.
+ * @return True if a test case is running and the log buffer is enabled.
+ */
+bool isLogRetained();
+
+/**
+ * @brief Appends an already formatted line to the per-test log buffer.
+ * @param line The text to append (including its trailing newline).
+ */
+void appendLog(std::string_view line);
+
+} // namespace detail
+
+/**
+ * @brief Writes a formatted message into the running test's log buffer.
+ *
+ * Messages go into a fixed-capacity ring buffer. When the test fails or is
+ * broken, the retained tail of the buffer is attached as a `text/plain`
+ * attachment named "log"; when the test passes the buffer is simply reset.
+ * Formatting only happens when the message will actually be retained, and
+ * never when ALLURE_CAPTURE_LEVEL compiles test reporting away.
+ *
+ * Example usage:
+ * @code
+ *   allure::log("connecting to {}:{}", host, port);
+ * @endcode
+ * @tparam Args Variadic argument types.
+ * @param fmt_str Format string checked by fmt at compile time.
+ * @param args Arguments to substitute into the format string.
+ */
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_TESTS
+template<typename... Args>
+void log(fmt::format_string<Args...> fmt_str, Args&&... args) {
+    if (!detail::isLogRetained()) {
+        return;
+    }
+
+    fmt::memory_buffer line;
+    fmt::format_to(std::back_inserter(line), fmt_str, std::forward<Args>(args)...);
+    line.push_back('\n');
+    detail::appendLog(std::string_view(line.data(), line.size()));
+}
+#else
+inline namespace elided {
+
+template<typename... Args>
+constexpr void log(fmt::format_string<Args...>, Args&&...) noexcept {
+}
+
+} // namespace elided
+#endif
+
+} // namespace allure
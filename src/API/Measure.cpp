@@ -0,0 +1,154 @@
+#include "Measure.h"
+#include "Attachment.h"
+#include "Core.h"
+#include "Utils.h"
+#include "../Model/Parameter.h"
+#include "../Model/Step.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+namespace allure {
+
+namespace {
+    // Samples are sized so that the target time fits about this many of them
+    constexpr std::int64_t SAMPLES_PER_TARGET_TIME = 1000;
+    constexpr std::uint64_t MAX_BATCH_SIZE = std::uint64_t(1) << 40;
+
+    double percentile(const std::vector<double>& sortedSamples, double fraction) {
+        std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * sortedSamples.size()));
+        return sortedSamples[(rank > 0) ? rank - 1 : 0];
+    }
+
+    model::Parameter buildParameter(const std::string& name, const std::string& value) {
+        model::Parameter parameter;
+        parameter.setName(name);
+        parameter.setValue(value);
+        return parameter;
+    }
+}
+
+#if !defined(__GNUC__) && !defined(__clang__)
+void detail::useCharPointer(const volatile char*) {
+}
+#endif
+
+namespace detail {
+
+MeasureSession::MeasureSession(const MeasureOptions& options)
+    : m_options(options)
+    , m_batchSize(1)
+    , m_warmupNanoseconds(0)
+    , m_measuredNanoseconds(0)
+    , m_samples()
+    , m_mean(0.0)
+    , m_squaredDeviations(0.0)
+{
+    m_options.minSamples = std::max<std::size_t>(m_options.minSamples, 1);
+    m_options.maxSamples = std::max(m_options.maxSamples, m_options.minSamples);
+}
+
+bool MeasureSession::warmUp(std::int64_t batchNanoseconds) {
+    m_warmupNanoseconds += batchNanoseconds;
+
+    // Grow batches until a single one is long enough to be timed accurately
+    bool tooShort = (batchNanoseconds < MIN_BATCH_NANOSECONDS) && (m_batchSize < MAX_BATCH_SIZE);
+    if (tooShort) {
+        m_batchSize *= 2;
+    }
+    if (tooShort || (m_warmupNanoseconds < m_options.warmupTime.count())) {
+        return true;
+    }
+
+    double nanosecondsPerIteration = static_cast<double>(std::max<std::int64_t>(batchNanoseconds, 1)) / m_batchSize;
+    std::int64_t sampleNanoseconds = std::max(MIN_BATCH_NANOSECONDS, m_options.targetTime.count() / SAMPLES_PER_TARGET_TIME);
+    m_batchSize = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::llround(sampleNanoseconds / nanosecondsPerIteration)));
+    m_samples.reserve(m_options.maxSamples);
+    return false;
+}
+
+bool MeasureSession::addSample(std::int64_t batchNanoseconds) {
+    double sample = static_cast<double>(batchNanoseconds) / m_batchSize;
+    m_samples.push_back(sample);
+    m_measuredNanoseconds += batchNanoseconds;
+
+    // Welford's update, so that checking the confidence costs O(1) per sample
+    std::size_t count = m_samples.size();
+    double delta = sample - m_mean;
+    m_mean += delta / count;
+    m_squaredDeviations += delta * (sample - m_mean);
+
+    if (count >= m_options.maxSamples) {
+        return false;
+    }
+    if (count < m_options.minSamples) {
+        return true;
+    }
+    if (m_measuredNanoseconds >= m_options.targetTime.count()) {
+        return false;
+    }
+    if ((m_options.targetRelativeError > 0.0) && (count > 1)) {
+        double standardError = std::sqrt(m_squaredDeviations / (count - 1) / count);
+        return (1.96 * standardError) > (m_options.targetRelativeError * m_mean);
+    }
+    return true;
+}
+
+MeasureResult MeasureSession::buildResult() const {
+    MeasureResult result;
+    result.samples = m_samples;
+    result.iterationsPerSample = m_batchSize;
+    result.iterations = m_batchSize * m_samples.size();
+    if (m_samples.empty()) {
+        return result;
+    }
+
+    std::vector<double> sortedSamples = m_samples;
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+    result.min = sortedSamples.front();
+    result.median = percentile(sortedSamples, 0.50);
+    result.p90 = percentile(sortedSamples, 0.90);
+    result.p99 = percentile(sortedSamples, 0.99);
+    result.mean = m_mean;
+    result.stddev = (m_samples.size() > 1) ? std::sqrt(m_squaredDeviations / (m_samples.size() - 1)) : 0.0;
+    result.iterationsPerSecond = (m_mean > 0.0) ? (1e9 / m_mean) : 0.0;
+    return result;
+}
+
+MeasureResult MeasureSession::report() const {
+    MeasureResult result = buildResult();
+
+    // The step of measure() is the running one, unless it was dropped by the step limits
+    auto* testCase = getTestProgram().getRunningTestCase();
+    model::Step* step = (testCase && (testCase->getOpenDroppedStepCount() == 0)) ? testCase->getRunningStep() : nullptr;
+    if (!step) {
+        return result;
+    }
+
+    step->addParameter(buildParameter("min", detail::formatNanoseconds(result.min)));
+    step->addParameter(buildParameter("median", detail::formatNanoseconds(result.median)));
+    step->addParameter(buildParameter("mean", detail::formatNanoseconds(result.mean)));
+    step->addParameter(buildParameter("p90", detail::formatNanoseconds(result.p90)));
+    step->addParameter(buildParameter("p99", detail::formatNanoseconds(result.p99)));
+    step->addParameter(buildParameter("stddev", detail::formatNanoseconds(result.stddev)));
+    step->addParameter(buildParameter("iterations/s", fmt::format("{:.0f}", result.iterationsPerSecond)));
+    step->addParameter(buildParameter("iterations", std::to_string(result.iterations)));
+    step->addParameter(buildParameter("samples", std::to_string(result.samples.size())));
+
+    if (m_options.attachSamples) {
+        nlohmann::ordered_json samples;
+        samples["unit"] = "ns";
+        samples["iterationsPerSample"] = result.iterationsPerSample;
+        samples["samples"] = result.samples;
+        std::string content = samples.dump();
+        Attachment::fromBinary("samples", "application/json", content.data(), content.size()).attach();
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+} // namespace allure
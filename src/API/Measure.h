@@ -0,0 +1,247 @@
+#pragma once
+
+#include "StepGuard.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace allure {
+
+/**
+ * @file Measure.h
+ * @brief Micro-benchmarks recorded as steps of the running test.
+ */
+
+// ============================================================================
+// Compiler barriers
+// ============================================================================
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/**
+ * @brief Forces the compiler to materialize a value, so its computation is not optimized away.
+ * @param value The value the benchmarked code produced.
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    asm volatile("" : : "m"(value) : "memory");
+#endif
+}
+
+/**
+ * @brief Forces the compiler to assume that a value is read and modified.
+ * @param value The value the benchmarked code produced.
+ */
+template<typename T>
+inline void doNotOptimize(T& value) {
+#if defined(__clang__)
+    asm volatile("" : "+r,m"(value) : : "memory");
+#else
+    asm volatile("" : "+m"(value) : : "memory");
+#endif
+}
+
+/**
+ * @brief Forces pending memory writes to be performed, as if all memory was read.
+ */
+inline void clobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+#else
+
+namespace detail {
+    /** @brief Opaque sink defined in another translation unit. */
+    void useCharPointer(const volatile char* pointer);
+}
+
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    detail::useCharPointer(&reinterpret_cast<const volatile char&>(value));
+    _ReadWriteBarrier();
+}
+
+inline void clobberMemory() {
+    _ReadWriteBarrier();
+}
+
+#endif
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+/**
+ * @brief Settings of a single allure::measure() call.
+ */
+struct MeasureOptions {
+    /** @brief Time spent running the callable before samples are taken. */
+    std::chrono::nanoseconds warmupTime{std::chrono::milliseconds(100)};
+
+    /** @brief Time after which sampling stops (once minSamples are taken). */
+    std::chrono::nanoseconds targetTime{std::chrono::seconds(1)};
+
+    /**
+     * @brief Sampling stops early once the 95% confidence interval of the mean
+     *        is within this fraction of the mean. 0 always samples for targetTime.
+     */
+    double targetRelativeError{0.01};
+
+    /** @brief Minimum number of samples taken. */
+    std::size_t minSamples{30};
+
+    /** @brief Maximum number of samples taken. */
+    std::size_t maxSamples{10000};
+
+    /** @brief Attaches all samples to the step as a JSON attachment named "samples". */
+    bool attachSamples{true};
+};
+
+/**
+ * @brief Statistics of a measurement, in nanoseconds per iteration.
+ */
+struct MeasureResult {
+    std::vector<double> samples;        ///< Mean time per iteration of each sample.
+    std::uint64_t iterationsPerSample{0}; ///< Iterations run back to back for each sample.
+    std::uint64_t iterations{0};        ///< Measured iterations (warm-up excluded).
+    double min{0.0};
+    double median{0.0};
+    double mean{0.0};
+    double p90{0.0};
+    double p99{0.0};
+    double stddev{0.0};
+    double iterationsPerSecond{0.0};
+};
+
+namespace detail {
+
+/**
+ * @brief Drives warm-up, iteration count calibration and stopping of a measurement.
+ *
+ * Kept out of the template so that only the timed loop is instantiated per callable.
+ */
+class MeasureSession {
+public:
+    /** @brief Shortest batch worth timing, so clock reads stay below 1% of it. */
+    static constexpr std::int64_t MIN_BATCH_NANOSECONDS = 10000;
+
+    explicit MeasureSession(const MeasureOptions& options);
+
+    /** @brief Number of iterations to run back to back for the next batch. */
+    std::uint64_t getBatchSize() const { return m_batchSize; }
+
+    /**
+     * @brief Accounts a warm-up batch and grows the batch size while batches are too short.
+     * @return True while warm-up should go on.
+     */
+    bool warmUp(std::int64_t batchNanoseconds);
+
+    /**
+     * @brief Records a batch as a sample.
+     * @return True while more samples are needed.
+     */
+    bool addSample(std::int64_t batchNanoseconds);
+
+    /** @brief Computes the statistics of the samples taken. */
+    MeasureResult buildResult() const;
+
+    /**
+     * @brief Adds the statistics (and samples attachment) to the running step.
+     * @return The statistics of the samples taken.
+     */
+    MeasureResult report() const;
+
+private:
+    MeasureOptions m_options;
+    std::uint64_t m_batchSize;
+    std::int64_t m_warmupNanoseconds;
+    std::int64_t m_measuredNanoseconds;
+    std::vector<double> m_samples;
+    double m_mean;
+    double m_squaredDeviations;
+};
+
+inline std::int64_t measureClock() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template<typename Func>
+inline std::int64_t runMeasuredBatch(Func& func, std::uint64_t iterations) {
+    std::int64_t start = measureClock();
+    for (std::uint64_t i = 0; i < iterations; i++) {
+        if constexpr (std::is_void_v<std::invoke_result_t<Func&>>) {
+            func();
+        } else {
+            auto result = func();
+            doNotOptimize(result);
+        }
+        clobberMemory();
+    }
+    return measureClock() - start;
+}
+
+} // namespace detail
+
+#if ALLURE_CAPTURE_LEVEL < ALLURE_CAPTURE_STEPS
+inline namespace elided {
+#endif
+
+/**
+ * @brief Benchmarks a callable and records its throughput as a step.
+ *
+ * The callable is first run for `warmupTime` while the number of iterations
+ * per sample is calibrated, so that each sample lasts at least 10 us. Samples
+ * are then taken until `targetTime` elapsed or the mean is known within
+ * `targetRelativeError`. The step gets min, median, mean, p90, p99, stddev,
+ * iterations/s, iterations and samples parameters and, optionally, the raw
+ * samples as a JSON attachment. Return values of the callable are passed to
+ * doNotOptimize(); use doNotOptimize() and clobberMemory() inside the callable
+ * for anything else that must not be optimized away. When ALLURE_CAPTURE_LEVEL
+ * compiles steps away, the callable is still measured but nothing is reported.
+ *
+ * Example usage:
+ * @code
+ *   auto result = allure::measure("Parse request", [&]() {
+ *       return parser.parse(request);
+ *   });
+ * @endcode
+ * @tparam Func Callable type; must be invocable with no arguments.
+ * @param name The name of the step.
+ * @param func The callable to benchmark.
+ * @param options Warm-up, duration and sampling settings.
+ * @return The statistics of the measurement, in nanoseconds per iteration.
+ */
+template<typename Func>
+MeasureResult measure([[maybe_unused]] std::string_view name, Func&& func, const MeasureOptions& options = MeasureOptions()) {
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_STEPS
+    StepGuard guard(name);
+#endif
+    detail::MeasureSession session(options);
+    while (session.warmUp(detail::runMeasuredBatch(func, session.getBatchSize()))) {
+    }
+    while (session.addSample(detail::runMeasuredBatch(func, session.getBatchSize()))) {
+    }
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_STEPS
+    return session.report();
+#else
+    return session.buildResult();
+#endif
+}
+
+#if ALLURE_CAPTURE_LEVEL < ALLURE_CAPTURE_STEPS
+} // namespace elided
+#endif
+
+} // namespace allure
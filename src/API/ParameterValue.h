@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace allure {
+namespace detail {
+
+/**
+ * @file ParameterValue.h
+ * @brief Native values of typed test parameters.
+ *
+ * Integers, floating point numbers, booleans and enums given as parameter
+ * values are stored as they are and only rendered as text when the report
+ * is written. Other types, and enums with an `fmt::formatter`, are formatted
+ * with it.
+ */
+
+/// Native value of a typed parameter.
+using ParameterValue = std::variant<std::int64_t, std::uint64_t, double, bool>;
+
+// Characters are text, not numbers: they are formatted instead
+template<typename T>
+constexpr bool is_character_v = std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+                                std::is_same_v<T, unsigned char> || std::is_same_v<T, wchar_t> ||
+                                std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+struct ParameterFormatTag;
+
+/**
+ * Whether T has an `fmt::formatter`, answered by hasFmtFormatter() in Utils.h.
+ * Without Utils.h nothing is known to be formatted, so enums stay integers.
+ */
+template<typename T, typename = void>
+struct has_fmt_formatter : std::false_type {};
+
+template<typename T>
+struct has_fmt_formatter<T, std::void_t<decltype(hasFmtFormatter(std::declval<const ParameterFormatTag&>(), std::declval<const T*>()))>>
+    : decltype(hasFmtFormatter(std::declval<const ParameterFormatTag&>(), std::declval<const T*>())) {};
+
+/// Whether a value of type T is stored natively (numbers, booleans and enums without an `fmt::formatter`).
+template<typename T, typename U = std::decay_t<T>>
+constexpr bool is_typed_parameter_v = (std::is_arithmetic_v<U> && !is_character_v<U>) ||
+                                      (std::is_enum_v<U> && !has_fmt_formatter<U>::value);
+
+/// Whether a value of type T is formatted with its `fmt::formatter` (anything not text or stored natively).
+template<typename T, typename U = std::decay_t<T>>
+constexpr bool is_formatted_parameter_v = !is_typed_parameter_v<U> && !std::is_convertible_v<const U&, std::string_view>;
+
+/**
+ * Convert a number, boolean or enum (as its underlying integer) to a parameter value.
+ * @param value Value to store.
+ * @return The value widened to 64 bits.
+ */
+template<typename T>
+constexpr ParameterValue toParameterValue(T value) noexcept {
+    if constexpr (std::is_enum_v<T>) {
+        return toParameterValue(static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return ParameterValue(value);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return ParameterValue(static_cast<double>(value));
+    } else if constexpr (std::is_signed_v<T>) {
+        return ParameterValue(static_cast<std::int64_t>(value));
+    } else {
+        return ParameterValue(static_cast<std::uint64_t>(value));
+    }
+}
+
+/**
+ * Tag of formatParameterValue(), found by argument-dependent lookup when the
+ * parameter is added. It is defined in Utils.h, so that `fmt` stays out of
+ * the headers that only need native values.
+ */
+struct ParameterFormatTag {};
+
+/// Whether formatParameterValue() can be found for T, i.e. whether Utils.h was included.
+template<typename T, typename = void>
+struct has_parameter_formatter : std::false_type {};
+
+template<typename T>
+struct has_parameter_formatter<T, std::void_t<decltype(formatParameterValue(std::declval<ParameterFormatTag>(), std::declval<const T&>()))>>
+    : std::true_type {};
+
+template<typename T>
+constexpr bool has_parameter_formatter_v = has_parameter_formatter<T>::value;
+
+} // namespace detail
+} // namespace allure
@@ -0,0 +1,36 @@
+#include "Stats.h"
+#include "Core.h"
+
+#include "../Services/Metrics/SelfProfiler.h"
+
+namespace allure {
+
+namespace {
+    PhaseStats toPhaseStats(const service::SelfProfiler::Totals& totals, service::SelfProfiler::Phase phase) {
+        const auto& phaseTotals = totals.phases[static_cast<std::size_t>(phase)];
+        PhaseStats phaseStats;
+        phaseStats.calls = phaseTotals.calls;
+        phaseStats.totalNs = phaseTotals.totalNs;
+        return phaseStats;
+    }
+}
+
+Stats stats() {
+    using Phase = service::SelfProfiler::Phase;
+    service::SelfProfiler::Totals totals = detail::getServicesFactory()->buildSelfProfiler()->getTotals();
+
+    Stats result;
+    result.enabled = service::SelfProfiler::isCompiledIn();
+    result.stepGuards = toPhaseStats(totals, Phase::STEP_GUARDS);
+    result.eventHandlers = toPhaseStats(totals, Phase::EVENT_HANDLERS);
+    result.serialization = toPhaseStats(totals, Phase::SERIALIZATION);
+    result.fileIO = toPhaseStats(totals, Phase::FILE_IO);
+    result.uuidGeneration = toPhaseStats(totals, Phase::UUID_GENERATION);
+    result.filesWritten = totals.filesWritten;
+    result.bytesWritten = totals.bytesWritten;
+    result.allocations = totals.allocations;
+    result.bytesAllocated = totals.bytesAllocated;
+    return result;
+}
+
+} // namespace allure
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+namespace allure {
+
+/**
+ * @file Stats.h
+ * @brief Overhead of Allure itself over the run (self-profiling).
+ */
+
+/**
+ * @brief Calls and time spent in one phase of Allure's own work.
+ */
+struct PhaseStats {
+    std::uint64_t calls = 0;
+    std::uint64_t totalNs = 0;
+};
+
+/**
+ * @brief Totals of Allure's own work since the start of the program.
+ *
+ * Phase times are self times: the time spent serializing a result is
+ * charged to `serialization` and not also to the event handler that
+ * triggered it, so the phases add up to totalNs().
+ *
+ * Self-profiling is built in with the ALLURE_SELF_PROFILING CMake option;
+ * without it the instrumentation is compiled out, `enabled` is false and
+ * every total is 0. Allocations are only counted when the allocation hooks
+ * are built in as well (ALLURE_TRACK_ALLOCATIONS).
+ */
+struct Stats {
+    bool enabled = false;
+
+    /** StepGuard work outside the step handlers (building handlers, reading the test status). */
+    PhaseStats stepGuards;
+    /** Test program, suite, test case and step event handlers. */
+    PhaseStats eventHandlers;
+    /** JSON serialization of results and containers. */
+    PhaseStats serialization;
+    /** Writing files to the output folder. */
+    PhaseStats fileIO;
+    /** Generating UUIDs. */
+    PhaseStats uuidGeneration;
+
+    std::uint64_t filesWritten = 0;
+    std::uint64_t bytesWritten = 0;
+    std::uint64_t allocations = 0;
+    std::uint64_t bytesAllocated = 0;
+
+    /** @brief Total time spent in Allure's own work, in nanoseconds. */
+    std::uint64_t totalNs() const {
+        return stepGuards.totalNs + eventHandlers.totalNs + serialization.totalNs +
+               fileIO.totalNs + uuidGeneration.totalNs;
+    }
+};
+
+/**
+ * @brief Returns how much time and resources Allure itself has used so far.
+ *
+ * With Configuration::selfProfiling(), the same totals are written at the
+ * end of the run to `allure-stats.json` and `environment.properties` in the
+ * output folder.
+ *
+ * Example usage:
+ * @code
+ *   allure::Stats overhead = allure::stats();
+ *   std::cout << "Allure overhead: " << overhead.totalNs() / 1e6 << " ms, "
+ *             << overhead.filesWritten << " files" << std::endl;
+ * @endcode
+ */
+Stats stats();
+
+} // namespace allure
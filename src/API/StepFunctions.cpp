@@ -1,8 +1,21 @@
-// Dummy implementation file for StepFunctions.h
-// This file exists solely to ensure MrDocs can extract documentation
-// from the inline template functions in StepFunctions.h
+// Besides letting MrDocs extract documentation from the inline templates in
+// StepFunctions.h, this file instantiates the renderers of the most common
+// single-argument step names, declared `extern template` in the header, so
+// test translation units do not compile them again.
 
 #include "StepFunctions.h"
 
-// All functions in StepFunctions.h are inline templates
-// No implementation needed here
+namespace allure { namespace detail {
+
+    template std::string renderDeferredName<int>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<unsigned int>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<long>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<unsigned long>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<long long>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<unsigned long long>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<float>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<double>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<bool>(const unsigned char*, std::size_t);
+    template std::string renderDeferredName<char>(const unsigned char*, std::size_t);
+
+}} // namespace allure::detail
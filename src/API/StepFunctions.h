@@ -1,141 +1,175 @@
 #pragma once
 
-#include "StepGuard.h"
+#include "Steps.h"
 #include "Utils.h"
+#include "../Model/DeferredName.h"
+#include <array>
+#include <cstddef>
+#include <cstring>
 #include <fmt/format.h>
-#include <string_view>
+#include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 namespace allure {
 
 namespace detail {
-    // Helper to detect if a type is callable (lambda, function, functor)
-    template<typename T, typename = void>
-    struct is_callable : std::false_type {};
+    // Helper to detect format arguments followed by a callable (and not a time budget)
+    template<typename... Args>
+    struct is_formatted_step : std::false_type {};
+
+    template<typename First, typename Second, typename... Rest>
+    struct is_formatted_step<First, Second, Rest...>
+        : std::bool_constant<!is_time_budget<std::decay_t<First>>::value &&
+                             is_callable<std::decay_t<std::tuple_element_t<sizeof...(Rest) + 1, std::tuple<First, Second, Rest...>>>>::value> {};
+
+    // Format string checked against all the arguments but the trailing callable
+    template<typename Tuple, typename Indices>
+    struct step_format_string_of;
+
+    template<typename Tuple, std::size_t... I>
+    struct step_format_string_of<Tuple, std::index_sequence<I...>> {
+        using type = fmt::format_string<std::tuple_element_t<I, Tuple>...>;
+    };
+
+    template<typename... Args>
+    using step_format_string = typename step_format_string_of<
+        std::tuple<Args...>, std::make_index_sequence<(sizeof...(Args) > 0) ? sizeof...(Args) - 1 : 0>>::type;
+
+    // Plain values can be copied into a deferred name: nothing they point to can dangle
+    template<typename... Args>
+    constexpr bool is_deferrable_v = (std::is_arithmetic_v<std::decay_t<Args>> && ...);
+
+    template<typename... Args>
+    constexpr std::array<std::size_t, sizeof...(Args)> deferredArgumentOffsets() {
+        std::array<std::size_t, sizeof...(Args)> offsets{};
+        std::size_t sizes[] = { sizeof(Args)... };
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < sizeof...(Args); i++) {
+            offsets[i] = offset;
+            offset += sizes[i];
+        }
+        return offsets;
+    }
 
     template<typename T>
-    struct is_callable<T, std::void_t<decltype(&T::operator())>> : std::true_type {};
-
-    template<typename Ret, typename... Args>
-    struct is_callable<Ret(*)(Args...)> : std::true_type {};
-
-    template<typename Ret, typename... Args>
-    struct is_callable<Ret(Args...)> : std::true_type {};
+    inline T loadDeferredArgument(const unsigned char* data) {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    // Deferred name layout: the arguments, one after the other, then the format string
+    template<typename... Args, std::size_t... I>
+    std::string formatDeferredName(const unsigned char* data, std::size_t size, std::index_sequence<I...>) {
+        constexpr auto offsets = deferredArgumentOffsets<Args...>();
+        constexpr std::size_t argumentsSize = (sizeof(Args) + ...);
+        fmt::string_view format(reinterpret_cast<const char*>(data) + argumentsSize, size - argumentsSize);
+        return fmt::format(fmt::runtime(format), loadDeferredArgument<Args>(data + offsets[I])...);
+    }
+
+    template<typename... Args>
+    std::string renderDeferredName(const unsigned char* data, std::size_t size) {
+        return formatDeferredName<Args...>(data, size, std::index_sequence_for<Args...>());
+    }
+
+    // Renderers of single-argument names are instantiated once, in the library
+    extern template std::string renderDeferredName<int>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<unsigned int>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<long>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<unsigned long>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<long long>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<unsigned long long>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<float>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<double>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<bool>(const unsigned char*, std::size_t);
+    extern template std::string renderDeferredName<char>(const unsigned char*, std::size_t);
+
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_STEPS
+    template<typename... Args>
+    inline StepGuard startFormattedStep(fmt::format_string<Args...> fmt_str, Args&&... args) {
+        fmt::string_view format = static_cast<fmt::string_view>(fmt_str);
+        if constexpr (is_deferrable_v<Args...>) {
+            constexpr std::size_t argumentsSize = (sizeof(std::decay_t<Args>) + ...);
+            if (argumentsSize + format.size() <= model::DeferredName::CAPACITY) {
+                model::DeferredName name(&renderDeferredName<std::decay_t<Args>...>);
+                (name.append(&args, sizeof(args)), ...);
+                name.append(format.data(), format.size());
+                return StepGuard(name);
+            }
+        }
+        return StepGuard(fmt::vformat(format, fmt::make_format_args(args...)));
+    }
+
+    template<typename... Args, std::size_t... I>
+    inline void runFormattedStep(step_format_string<Args...> fmt_str, std::tuple<Args&&...> arguments,
+                                 std::index_sequence<I...>) {
+        StepGuard guard = startFormattedStep<std::tuple_element_t<I, std::tuple<Args...>>...>(
+            fmt_str, std::get<I>(std::move(arguments))...);
+        std::get<sizeof...(Args) - 1>(std::move(arguments))();
+    }
+#endif
 }
 
 /**
  * @file StepFunctions.h
- * @brief This file contains functions for creating Allure test steps using RAII guards.
+ * @brief Steps whose names are built from `fmt`-style format strings.
  *
- * There are two primary ways to create a step:
- * 1. Manual RAII Guard: The step starts when a `StepGuard` is created and ends when it goes out of scope.
- *    @code
- *    {
- *        auto guard = allure::step("My Step");
- *        // ... code for the step ...
- *    } // Step ends here
- *    @endcode
- * 2. Lambda-based: A lambda function containing the step's code is passed to the `step` function.
+ * Includes all the step functions of Steps.h. Names are formatted lazily,
+ * when the report needs them:
  *    @code
- *    allure::step("My Step", [&]() {
+ *    allure::step("Decode frame {}", frame, [&]() {
  *        // ... code for the step ...
  *    });
  *    @endcode
- *
- * The `step` functions also support `fmt`-style format strings for dynamic step names.
- * Steps are closed automatically, even when the callable throws.
+ * When ALLURE_CAPTURE_LEVEL compiles steps away (see CaptureLevel.h), names
+ * are never formatted.
  */
 
-// ============================================================================
-// Manual RAII guard (user controls scope)
-// ============================================================================
-
-/**
- * @brief Starts a test step and returns a guard object.
- *
- * The step is considered active until the returned `StepGuard` is destroyed.
- * This is useful for steps that span a clear lexical scope.
- *
- * @param name The name of the step. Keep the guard alive for the full step scope.
- * @return A `StepGuard` object that controls the lifetime of the step.
- */
-[[nodiscard]] inline StepGuard step(std::string_view name) {
-    return StepGuard(name);
-}
-
-// ============================================================================
-// Lambda-based steps (automatic scoping)
-// ============================================================================
-
-/**
- * @brief Executes a callable (e.g., a lambda) within a test step.
- *
- * The step automatically starts before the callable is invoked and ends after it completes.
- *
- * @tparam Func Callable type; must be invocable with no arguments.
- * @param name The name of the step.
- * @param func The callable object to execute as the body of the step.
- */
-template<typename Func, typename = std::enable_if_t<detail::is_callable<std::decay_t<Func>>::value>>
-inline void step(std::string_view name, Func&& func) {
-    StepGuard guard(name);
-    std::forward<Func>(func)();
-}
+#if ALLURE_CAPTURE_LEVEL < ALLURE_CAPTURE_STEPS
+inline namespace elided {
+#endif
 
 // ============================================================================
 // Formatted step names (with arguments)
 // ============================================================================
 
 /**
- * @brief Executes a callable within a step with a formatted name (1 argument).
+ * @brief Executes a callable within a step with a formatted name.
  *
- * @tparam Arg1 Type of the first format argument.
- * @tparam Func Callable type; must be invocable with no arguments.
- * @param fmt_str A `fmt`-style format string for the step name.
- * @param arg1 The first argument to format into the step name.
- * @param func The callable object to execute as the body of the step.
- */
-template<typename Arg1, typename Func, typename = std::enable_if_t<detail::is_callable<std::decay_t<Func>>::value>>
-inline void step(const char* fmt_str, Arg1&& arg1, Func&& func) {
-    StepGuard guard(detail::format(fmt::runtime(fmt_str), std::forward<Arg1>(arg1)));
-    std::forward<Func>(func)();
-}
-
-/**
- * @brief Executes a callable within a step with a formatted name (2 arguments).
+ * The format string is checked against the arguments by `fmt` at compile time
+ * (with C++20). When every argument is a plain number (integers, floating
+ * point, bool, char) and they fit in a small inline buffer together with the
+ * format string, they are copied and the name is only formatted when the
+ * report reads it: steps that are never serialized (dropped by the step
+ * limits or summarized on pass) never pay for formatting. Other arguments,
+ * such as strings that may not outlive the step, are formatted right away.
  *
- * @tparam Arg1 Type of the first format argument.
- * @tparam Arg2 Type of the second format argument.
- * @tparam Func Callable type; must be invocable with no arguments.
+ * Example usage:
+ * @code
+ *   allure::step("Decode frame {} of {}", frame, frameCount, [&]() {
+ *       decoder.decode(frame);
+ *   });
+ * @endcode
+ * @tparam Args The format arguments, followed by the callable type.
  * @param fmt_str A `fmt`-style format string for the step name.
- * @param arg1 The first argument to format into the step name.
- * @param arg2 The second argument to format into the step name.
- * @param func The callable object to execute as the body of the step.
+ * @param arguments The arguments to format into the step name, followed by
+ *                  the callable object to execute as the body of the step.
  */
-template<typename Arg1, typename Arg2, typename Func, typename = std::enable_if_t<detail::is_callable<std::decay_t<Func>>::value>>
-inline void step(const char* fmt_str, Arg1&& arg1, Arg2&& arg2, Func&& func) {
-    StepGuard guard(detail::format(fmt::runtime(fmt_str), std::forward<Arg1>(arg1), std::forward<Arg2>(arg2)));
-    std::forward<Func>(func)();
+template<typename... Args, typename = std::enable_if_t<detail::is_formatted_step<Args...>::value>>
+inline void step(detail::step_format_string<Args...> fmt_str, Args&&... arguments) {
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_STEPS
+    detail::runFormattedStep<Args...>(fmt_str, std::forward_as_tuple(std::forward<Args>(arguments)...),
+                                      std::make_index_sequence<sizeof...(Args) - 1>());
+#else
+    static_cast<void>(fmt_str);
+    std::get<sizeof...(Args) - 1>(std::forward_as_tuple(std::forward<Args>(arguments)...))();
+#endif
 }
 
-/**
- * @brief Executes a callable within a step with a formatted name (3 arguments).
- *
- * @tparam Arg1 Type of the first format argument.
- * @tparam Arg2 Type of the second format argument.
- * @tparam Arg3 Type of the third format argument.
- * @tparam Func Callable type; must be invocable with no arguments.
- * @param fmt_str A `fmt`-style format string for the step name.
- * @param arg1 The first argument to format into the step name.
- * @param arg2 The second argument to format into the step name.
- * @param arg3 The third argument to format into the step name.
- * @param func The callable object to execute as the body of the step.
- */
-template<typename Arg1, typename Arg2, typename Arg3, typename Func, typename = std::enable_if_t<detail::is_callable<std::decay_t<Func>>::value>>
-inline void step(const char* fmt_str, Arg1&& arg1, Arg2&& arg2, Arg3&& arg3, Func&& func) {
-    StepGuard guard(detail::format(fmt::runtime(fmt_str), std::forward<Arg1>(arg1), std::forward<Arg2>(arg2), std::forward<Arg3>(arg3)));
-    std::forward<Func>(func)();
-}
+#if ALLURE_CAPTURE_LEVEL < ALLURE_CAPTURE_STEPS
+} // namespace elided
+#endif
 
 } // namespace allure
@@ -1,8 +1,13 @@
 #include "StepGuard.h"
 #include "Core.h"
 #include "../Model/Status.h"
+#include "../Model/StepNameRegistry.h"
 #include "../Services/EventHandlers/ITestStepStartEventHandler.h"
 #include "../Services/EventHandlers/ITestStepEndEventHandler.h"
+#include "../Services/Metrics/SelfProfiler.h"
+
+#include <algorithm>
+#include <cstdint>
 
 namespace allure {
 
@@ -19,26 +24,65 @@ namespace {
     }
 }
 
+namespace detail {
+
+StepName registerStepName(std::string_view name) {
+    return StepName{ model::StepNameRegistry::instance().registerName(std::string(name)) };
+}
+
+} // namespace detail
+
 StepGuard::StepGuard(std::string_view name)
     : m_active(true)
+    , m_budget()
 {
+    ALLURE_PROFILE_SCOPE(STEP_GUARDS);
     auto factory = detail::getServicesFactory();
     auto handler = factory->buildTestStepStartEventHandler();
     handler->handleTestStepStart(std::string(name), true);  // true = isAction
 }
 
+StepGuard::StepGuard(const model::DeferredName& name)
+    : m_active(true)
+    , m_budget()
+{
+    ALLURE_PROFILE_SCOPE(STEP_GUARDS);
+    auto factory = detail::getServicesFactory();
+    auto handler = factory->buildTestStepStartEventHandler();
+    handler->handleTestStepStart(name, true);  // true = isAction
+}
+
+StepGuard::StepGuard(StepName name)
+    : m_active(true)
+    , m_budget()
+{
+    ALLURE_PROFILE_SCOPE(STEP_GUARDS);
+    auto factory = detail::getServicesFactory();
+    auto handler = factory->buildTestStepStartEventHandler();
+    handler->handleTestStepStart(name.id, true);  // true = isAction
+}
+
+StepGuard::StepGuard(std::string_view name, const TimeBudget& budget)
+    : StepGuard(name)
+{
+    m_budget.budgetNs = static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(budget.limit.count(), 1));
+    m_budget.exceededStatus = budget.exceededStatus;
+    m_budget.failTest = budget.failTest;
+}
+
 StepGuard::~StepGuard() noexcept {
     if (!m_active) {
         return;  // Moved-from guard, don't end step
     }
 
     try {
+        ALLURE_PROFILE_SCOPE(STEP_GUARDS);
         auto statusProvider = detail::getStatusProvider();
         auto status = convertStatus(*statusProvider);
 
         auto factory = detail::getServicesFactory();
         auto handler = factory->buildTestStepEndEventHandler();
-        handler->handleTestStepEnd(status);
+        handler->handleTestStepEnd(status, m_budget);
     }
     catch (...) {
         // Destructor must not throw
@@ -48,6 +92,7 @@ StepGuard::~StepGuard() noexcept {
 
 StepGuard::StepGuard(StepGuard&& other) noexcept
     : m_active(other.m_active)
+    , m_budget(other.m_budget)
 {
     other.m_active = false;  // Prevent double-cleanup
 }
@@ -55,6 +100,7 @@ StepGuard::StepGuard(StepGuard&& other) noexcept
 StepGuard& StepGuard::operator=(StepGuard&& other) noexcept {
     if (this != &other) {
         m_active = other.m_active;
+        m_budget = other.m_budget;
         other.m_active = false;
     }
     return *this;
@@ -1,15 +1,62 @@
 #pragma once
 
+#include "CaptureLevel.h"
+#include "../Model/StepBudget.h"
+
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <string_view>
 
 namespace allure {
 
+namespace model {
+    class DeferredName;
+}
+
 /**
  * @file StepGuard.h
  * @brief RAII guard that manages the lifetime of an Allure step.
  */
 
+/**
+ * Time budget of a step: an inline performance assertion.
+ *
+ * The step is measured on a monotonic clock. When it takes longer than
+ * `limit`, it gets `exceededStatus` (unless it already failed) and an
+ * "Exceeded budget of X by Y" status message; with `failTest` the test
+ * gets that status and message as well. The budget is recorded as the
+ * "budget" step parameter and the measured time as "duration (ns)".
+ */
+struct TimeBudget {
+    std::chrono::nanoseconds limit{0};                    ///< Maximum duration of the step.
+    model::Status exceededStatus{model::Status::FAILED};  ///< Status of a step over budget (FAILED or BROKEN).
+    bool failTest{false};                                 ///< Whether a step over budget also fails the test.
+};
+
+/**
+ * Handle on a step name registered once, see ALLURE_STEP_NAME().
+ *
+ * Steps started from a registered name only record its 32-bit id instead
+ * of copying the name.
+ */
+struct StepName {
+    std::uint32_t id{0};  ///< Id in the registry of step names (0 when unregistered).
+};
+
+namespace detail {
+
+/**
+ * @brief Registers a step name, or finds the one already registered.
+ * @param name The name of the step.
+ * @return The handle on the registered name.
+ */
+StepName registerStepName(std::string_view name);
+
+} // namespace detail
+
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_STEPS
+
 /**
  * RAII guard for automatic step lifecycle management.
  *
@@ -31,6 +78,25 @@ public:
      */
     explicit StepGuard(std::string_view name);
 
+    /**
+     * Construct a step guard and start a step whose name is formatted when first read.
+     * @param name The deferred name of the step.
+     */
+    explicit StepGuard(const model::DeferredName& name);
+
+    /**
+     * Construct a step guard and start a step with a registered name.
+     * @param name The registered name of the step.
+     */
+    explicit StepGuard(StepName name);
+
+    /**
+     * Construct a step guard with a time budget and start the step.
+     * @param name The name of the step.
+     * @param budget The time budget checked when the step ends.
+     */
+    StepGuard(std::string_view name, const TimeBudget& budget);
+
     /**
      * Destructor automatically ends the step.
      * This is noexcept to prevent exceptions during stack unwinding.
@@ -47,6 +113,34 @@ public:
 
 private:
     bool m_active{true};  ///< True if the guard is active. Becomes false if it has been moved from.
+    model::StepBudget m_budget;  ///< Budget checked when the step ends (none by default).
 };
 
+#else
+
+inline namespace elided {
+
+/**
+ * No-op step guard, used when ALLURE_CAPTURE_LEVEL compiles steps away.
+ */
+class StepGuard {
+public:
+    explicit StepGuard(std::string_view) noexcept {}
+    explicit StepGuard(StepName) noexcept {}
+    StepGuard(std::string_view, const TimeBudget&) noexcept {}
+
+    // Not trivial, so that unused guards do not trigger compiler warnings
+    ~StepGuard() noexcept {}
+
+    // Non-copyable, movable (same contract as the reporting guard)
+    StepGuard(const StepGuard&) = delete;
+    StepGuard& operator=(const StepGuard&) = delete;
+    StepGuard(StepGuard&&) noexcept = default;
+    StepGuard& operator=(StepGuard&&) noexcept = default;
+};
+
+} // namespace elided
+
+#endif
+
 } // namespace allure
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Steps.h"
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace allure {
+
+/**
+ * @file StepSampler.h
+ * @brief Sampling of steps executed inside hot loops.
+ */
+
+/**
+ * @brief Decides which iterations of a loop are recorded as steps.
+ *
+ * Keep one sampler per loop and pass it to sampledStep() on every iteration.
+ * Iterations that are not sampled still run their body, they just do not
+ * create a step.
+ *
+ * Example usage:
+ * @code
+ *   auto sampler = allure::StepSampler::everyNth(1000);
+ *   for (int i = 0; i < 1000000; i++) {
+ *       allure::sampledStep("Process item", sampler, [&]() { process(i); });
+ *   }
+ * @endcode
+ */
+class StepSampler {
+public:
+    /**
+     * @brief Records the first iteration and then one out of every `n`.
+     * @param n Sampling period; 0 and 1 record every iteration.
+     * @return A StepSampler object.
+     */
+    static StepSampler everyNth(std::uint64_t n) {
+        return StepSampler(n, 1.0, 0);
+    }
+
+    /**
+     * @brief Records a pseudo-random subset of the iterations.
+     * @param fraction Probability in [0, 1] that an iteration is recorded.
+     * @param seed Seed of the generator, so that runs are reproducible.
+     * @return A StepSampler object.
+     */
+    static StepSampler random(double fraction, std::uint64_t seed = 0x2545F4914F6CDD1DULL) {
+        return StepSampler(0, fraction, seed);
+    }
+
+    /**
+     * @brief Decides whether the next iteration is recorded.
+     * @return True if the iteration should create a step.
+     */
+    bool sample() noexcept {
+        std::uint64_t iteration = m_seen++;
+        bool recorded = (m_period > 1) ? ((iteration % m_period) == 0) : (nextRandom() < m_fraction);
+        m_recorded += recorded ? 1 : 0;
+        return recorded;
+    }
+
+    /** @brief Number of iterations seen so far. */
+    std::uint64_t getSeen() const noexcept { return m_seen; }
+
+    /** @brief Number of iterations recorded as steps so far. */
+    std::uint64_t getRecorded() const noexcept { return m_recorded; }
+
+private:
+    StepSampler(std::uint64_t period, double fraction, std::uint64_t seed)
+        : m_period(period), m_fraction(fraction), m_state(seed ? seed : 1) {}
+
+    double nextRandom() noexcept {
+        if (m_fraction >= 1.0) {
+            return 0.0;
+        }
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return static_cast<double>(m_state >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    std::uint64_t m_period;
+    double m_fraction;
+    std::uint64_t m_state;
+    std::uint64_t m_seen{0};
+    std::uint64_t m_recorded{0};
+};
+
+/**
+ * @brief Executes a callable, recording it as a step only when sampled.
+ *
+ * @tparam Func Callable type; must be invocable with no arguments.
+ * @param name The name of the step.
+ * @param sampler The sampler shared by all iterations of the loop.
+ * @param func The callable object to execute as the body of the step.
+ */
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_STEPS
+template<typename Func, typename = std::enable_if_t<detail::is_callable<std::decay_t<Func>>::value>>
+inline void sampledStep(std::string_view name, StepSampler& sampler, Func&& func) {
+    if (!sampler.sample()) {
+        std::forward<Func>(func)();
+        return;
+    }
+
+    StepGuard guard(name);
+    std::forward<Func>(func)();
+}
+#else
+inline namespace elided {
+
+template<typename Func, typename = std::enable_if_t<detail::is_callable<std::decay_t<Func>>::value>>
+inline void sampledStep(std::string_view, StepSampler&, Func&& func) {
+    std::forward<Func>(func)();
+}
+
+} // namespace elided
+#endif
+
+} // namespace allure
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "StepGuard.h"
+#include <chrono>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace allure {
+
+namespace detail {
+    // Helper to detect if a type is callable (lambda, function, functor)
+    template<typename T, typename = void>
+    struct is_callable : std::false_type {};
+
+    template<typename T>
+    struct is_callable<T, std::void_t<decltype(&T::operator())>> : std::true_type {};
+
+    template<typename Ret, typename... Args>
+    struct is_callable<Ret(*)(Args...)> : std::true_type {};
+
+    template<typename Ret, typename... Args>
+    struct is_callable<Ret(Args...)> : std::true_type {};
+
+    // Helper to detect a step time budget (a duration or a TimeBudget)
+    template<typename T>
+    struct is_time_budget : std::false_type {};
+
+    template<typename Rep, typename Period>
+    struct is_time_budget<std::chrono::duration<Rep, Period>> : std::true_type {};
+
+    template<>
+    struct is_time_budget<TimeBudget> : std::true_type {};
+}
+
+/**
+ * @file Steps.h
+ * @brief This file contains functions for creating Allure test steps using RAII guards.
+ *
+ * There are two primary ways to create a step:
+ * 1. Manual RAII Guard: The step starts when a `StepGuard` is created and ends when it goes out of scope.
+ *    @code
+ *    {
+ *        auto guard = allure::step("My Step");
+ *        // ... code for the step ...
+ *    } // Step ends here
+ *    @endcode
+ * 2. Lambda-based: A lambda function containing the step's code is passed to the `step` function.
+ *    @code
+ *    allure::step("My Step", [&]() {
+ *        // ... code for the step ...
+ *    });
+ *    @endcode
+ *
+ * The `step` functions also support time budgets that fail the step when it takes too long:
+ *    @code
+ *    allure::step("Decode frame", 2ms, [&]() {
+ *        // ... code for the step ...
+ *    });
+ *    @endcode
+ * Steps are closed automatically, even when the callable throws. Literal names
+ * can be registered once per call site with `ALLURE_STEP("My Step")`. Step names
+ * built from `fmt`-style format strings are in StepFunctions.h.
+ *
+ * When ALLURE_CAPTURE_LEVEL compiles steps away (see CaptureLevel.h), these
+ * functions only call the callable.
+ */
+
+#if ALLURE_CAPTURE_LEVEL < ALLURE_CAPTURE_STEPS
+inline namespace elided {
+#endif
+
+// ============================================================================
+// Manual RAII guard (user controls scope)
+// ============================================================================
+
+/**
+ * @brief Starts a test step and returns a guard object.
+ *
+ * The step is considered active until the returned `StepGuard` is destroyed.
+ * This is useful for steps that span a clear lexical scope.
+ *
+ * @param name The name of the step. Keep the guard alive for the full step scope.
+ * @return A `StepGuard` object that controls the lifetime of the step.
+ */
+[[nodiscard]] inline StepGuard step(std::string_view name) {
+    return StepGuard(name);
+}
+
+// ============================================================================
+// Lambda-based steps (automatic scoping)
+// ============================================================================
+
+/**
+ * @brief Executes a callable (e.g., a lambda) within a test step.
+ *
+ * The step automatically starts before the callable is invoked and ends after it completes.
+ *
+ * @tparam Func Callable type; must be invocable with no arguments.
+ * @param name The name of the step.
+ * @param func The callable object to execute as the body of the step.
+ */
+template<typename Func, typename = std::enable_if_t<detail::is_callable<std::decay_t<Func>>::value>>
+inline void step(std::string_view name, Func&& func) {
+    StepGuard guard(name);
+    std::forward<Func>(func)();
+}
+
+// ============================================================================
+// Steps with a registered name (see ALLURE_STEP)
+// ============================================================================
+
+/**
+ * @brief Starts a test step with a registered name and returns a guard object.
+ *
+ * @param name The registered name of the step, see ALLURE_STEP_NAME().
+ * @return A `StepGuard` object that controls the lifetime of the step.
+ */
+[[nodiscard]] inline StepGuard step(StepName name) {
+    return StepGuard(name);
+}
+
+/**
+ * @brief Executes a callable within a test step with a registered name.
+ *
+ * @tparam Func Callable type; must be invocable with no arguments.
+ * @param name The registered name of the step, see ALLURE_STEP_NAME().
+ * @param func The callable object to execute as the body of the step.
+ */
+template<typename Func, typename = std::enable_if_t<detail::is_callable<std::decay_t<Func>>::value>>
+inline void step(StepName name, Func&& func) {
+    StepGuard guard(name);
+    std::forward<Func>(func)();
+}
+
+// ============================================================================
+// Steps with a time budget
+// ============================================================================
+
+/**
+ * @brief Starts a test step with a time budget and returns a guard object.
+ *
+ * When the guard is destroyed, the step fails if it took longer than the budget.
+ *
+ * @param name The name of the step.
+ * @param budget Maximum duration of the step.
+ * @return A `StepGuard` object that controls the lifetime of the step.
+ */
+template<typename Rep, typename Period>
+[[nodiscard]] inline StepGuard step(std::string_view name, std::chrono::duration<Rep, Period> budget) {
+    return StepGuard(name, TimeBudget{ std::chrono::duration_cast<std::chrono::nanoseconds>(budget) });
+}
+
+/**
+ * @brief Starts a test step with a time budget and returns a guard object.
+ *
+ * @param name The name of the step.
+ * @param budget Time budget, with the status to give to a step over budget and whether it also fails the test.
+ * @return A `StepGuard` object that controls the lifetime of the step.
+ */
+[[nodiscard]] inline StepGuard step(std::string_view name, const TimeBudget& budget) {
+    return StepGuard(name, budget);
+}
+
+/**
+ * @brief Executes a callable within a test step with a time budget.
+ *
+ * The step fails with an "Exceeded budget of X by Y" message if it took longer than the budget.
+ *
+ * @tparam Budget A `std::chrono::duration` or a `TimeBudget`.
+ * @tparam Func Callable type; must be invocable with no arguments.
+ * @param name The name of the step.
+ * @param budget Maximum duration of the step.
+ * @param func The callable object to execute as the body of the step.
+ */
+template<typename Budget, typename Func,
+         typename = std::enable_if_t<detail::is_time_budget<std::decay_t<Budget>>::value &&
+                                     detail::is_callable<std::decay_t<Func>>::value>>
+inline void step(std::string_view name, Budget&& budget, Func&& func) {
+    StepGuard guard = step(name, std::forward<Budget>(budget));
+    std::forward<Func>(func)();
+}
+
+#if ALLURE_CAPTURE_LEVEL < ALLURE_CAPTURE_STEPS
+} // namespace elided
+#endif
+
+} // namespace allure
+
+/**
+ * @brief Registers a literal step name once per call site.
+ *
+ * The name is stored in a process-wide table the first time the expression
+ * runs; steps started from it only record its 32-bit id.
+ *
+ * Example usage:
+ * @code
+ *   allure::step(ALLURE_STEP_NAME("Decode frame"), [&]() {
+ *       decoder.decode(frame);
+ *   });
+ * @endcode
+ */
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_STEPS
+    #define ALLURE_STEP_NAME(literal) \
+        ([]() -> ::allure::StepName { \
+            static const ::allure::StepName stepName = ::allure::detail::registerStepName("" literal); \
+            return stepName; \
+        }())
+#else
+    #define ALLURE_STEP_NAME(literal) (static_cast<void>("" literal), ::allure::StepName{})
+#endif
+
+/**
+ * @brief Starts a step with a literal name registered once per call site.
+ *
+ * Example usage:
+ * @code
+ *   {
+ *       auto guard = ALLURE_STEP("Open connection");
+ *       // ... code for the step ...
+ *   }
+ * @endcode
+ */
+#define ALLURE_STEP(literal) ::allure::step(ALLURE_STEP_NAME(literal))
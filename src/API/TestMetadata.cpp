@@ -124,6 +124,21 @@ TestMetadata& TestMetadata::parameter(std::string_view name, std::string_view va
     return *this;
 }
 
+TestMetadata& TestMetadata::typedParameter(std::string_view name, detail::ParameterValue value) {
+    m_operations.push_back([name = std::string(name), value]() {
+        auto* testCase = detail::getTestProgram().getRunningTestCase();
+        if (testCase) {
+            model::Parameter param;
+            param.setName(name);
+            std::visit([&param](auto typedValue) { param.setTypedValue(typedValue); }, value);
+            param.setExcluded(false);
+            param.setMode("default");
+            testCase->addParameter(param);
+        }
+    });
+    return *this;
+}
+
 TestMetadata& TestMetadata::maskedParameter(std::string_view name, std::string_view value) {
     m_operations.push_back([name = std::string(name), value = std::string(value)]() {
         auto* testCase = detail::getTestProgram().getRunningTestCase();
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "CaptureLevel.h"
+#include "ParameterValue.h"
+
 #include <functional>
 #include <string>
 #include <string_view>
@@ -13,8 +16,12 @@ namespace allure {
  *
  * Each builder queues mutations and applies them when the object is destroyed,
  * making it convenient to write scoped, chainable metadata declarations.
+ * When ALLURE_CAPTURE_LEVEL compiles test reporting away (see CaptureLevel.h),
+ * the builders are empty and every setter is an inline no-op.
  */
 
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_TESTS
+
 /**
  * Fluent builder for test case metadata.
  * Metadata is automatically applied when the builder is destroyed (RAII). Each
@@ -140,6 +147,36 @@ public:
      * @return Reference to the builder for chaining.
      */
     TestMetadata& parameter(std::string_view name, std::string_view value);
+    /**
+     * Add a visible parameter holding a number, boolean or enum.
+     * The value keeps its native type and is only rendered when the report is written.
+     * Enums with an `fmt::formatter` are formatted instead, when API/Utils.h is included.
+     * @param name Parameter name.
+     * @param value Parameter value (enums are stored as their underlying integer).
+     * @return Reference to the builder for chaining.
+     */
+    template<typename T>
+    std::enable_if_t<detail::is_typed_parameter_v<T>, TestMetadata&> parameter(std::string_view name, T value) {
+        return typedParameter(name, detail::toParameterValue(value));
+    }
+    /**
+     * Add a visible parameter of any type with an `fmt::formatter` (enums included).
+     * Needs API/Utils.h (included by allure-cpp.h), which does the formatting.
+     * @param name Parameter name.
+     * @param value Parameter value.
+     * @return Reference to the builder for chaining.
+     */
+    template<typename T>
+    std::enable_if_t<detail::is_formatted_parameter_v<T>, TestMetadata&> parameter(std::string_view name, const T& value) {
+        static_assert(detail::has_parameter_formatter_v<T>,
+                      "allure::test().parameter() with a value that is neither text, a number, a boolean nor an enum "
+                      "formats it with fmt: include API/Utils.h (or allure-cpp.h instead of allure-cpp-lite.h)");
+        if constexpr (detail::has_parameter_formatter_v<T>) {
+            return parameter(name, std::string_view(formatParameterValue(detail::ParameterFormatTag{}, value)));
+        } else {
+            return *this;
+        }
+    }
     /**
      * Add a parameter whose value is masked in the report.
      * @param name Parameter name.
@@ -173,6 +210,8 @@ public:
     TestMetadata& muted();
 
 private:
+    TestMetadata& typedParameter(std::string_view name, detail::ParameterValue value);
+
     std::vector<std::function<void()>> m_operations;
 };
 
@@ -258,6 +297,76 @@ inline SuiteMetadata suite() {
     return SuiteMetadata();
 }
 
+#else
+
+inline namespace elided {
+
+/**
+ * No-op test metadata builder, used when ALLURE_CAPTURE_LEVEL compiles test reporting away.
+ */
+class TestMetadata {
+public:
+    constexpr TestMetadata() noexcept = default;
+
+    TestMetadata(const TestMetadata&) = delete;
+    TestMetadata& operator=(const TestMetadata&) = delete;
+    TestMetadata(TestMetadata&&) noexcept = default;
+    TestMetadata& operator=(TestMetadata&&) noexcept = default;
+
+    constexpr TestMetadata& name(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& description(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& descriptionHtml(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& epic(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& feature(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& story(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& severity(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& owner(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& tag(std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& label(std::string_view, std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& link(std::string_view, std::string_view, std::string_view = "custom") noexcept { return *this; }
+    constexpr TestMetadata& issue(std::string_view, std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& tms(std::string_view, std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& parameter(std::string_view, std::string_view) noexcept { return *this; }
+    template<typename T>
+    constexpr TestMetadata& parameter(std::string_view, const T&) noexcept { return *this; }
+    constexpr TestMetadata& maskedParameter(std::string_view, std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& hiddenParameter(std::string_view, std::string_view) noexcept { return *this; }
+    constexpr TestMetadata& flaky() noexcept { return *this; }
+    constexpr TestMetadata& known() noexcept { return *this; }
+    constexpr TestMetadata& muted() noexcept { return *this; }
+};
+
+constexpr TestMetadata test() noexcept {
+    return TestMetadata();
+}
+
+/**
+ * No-op suite metadata builder, used when ALLURE_CAPTURE_LEVEL compiles test reporting away.
+ */
+class SuiteMetadata {
+public:
+    constexpr SuiteMetadata() noexcept = default;
+
+    SuiteMetadata(const SuiteMetadata&) = delete;
+    SuiteMetadata& operator=(const SuiteMetadata&) = delete;
+    SuiteMetadata(SuiteMetadata&&) noexcept = default;
+    SuiteMetadata& operator=(SuiteMetadata&&) noexcept = default;
+
+    constexpr SuiteMetadata& name(std::string_view) noexcept { return *this; }
+    constexpr SuiteMetadata& description(std::string_view) noexcept { return *this; }
+    constexpr SuiteMetadata& epic(std::string_view) noexcept { return *this; }
+    constexpr SuiteMetadata& severity(std::string_view) noexcept { return *this; }
+    constexpr SuiteMetadata& label(std::string_view, std::string_view) noexcept { return *this; }
+};
+
+constexpr SuiteMetadata suite() noexcept {
+    return SuiteMetadata();
+}
+
+} // namespace elided
+
+#endif
+
 // Parent/Sub suite support is handled by the test framework's structure
 // (e.g., TEST_F class hierarchy in GTest, or test groups in CppUTest)
 
@@ -0,0 +1,24 @@
+#include "TestMetrics.h"
+#include "Core.h"
+
+#include "../Services/Metrics/ITestMetricRegistry.h"
+
+namespace allure {
+
+void Gauge::set(double value) {
+    if (m_slot) {
+        m_registry->setGauge(*m_slot, value);
+    }
+}
+
+Counter counter(std::string_view name) {
+    return Counter(detail::getServicesFactory()->buildTestMetricRegistry()->getCounter(name));
+}
+
+Gauge gauge(std::string_view name) {
+    // The handle keeps the registry, so that set() in hot loops skips the factory
+    auto registry = detail::getServicesFactory()->buildTestMetricRegistry();
+    return Gauge(registry.get(), registry->getGauge(name));
+}
+
+} // namespace allure
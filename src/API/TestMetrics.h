@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CaptureLevel.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+namespace allure {
+
+namespace service {
+    struct GaugeSlot;
+    class ITestMetricRegistry;
+}
+
+/**
+ * @file TestMetrics.h
+ * @brief Counters and gauges recorded by the code under test for the running test.
+ *
+ * When ALLURE_CAPTURE_LEVEL compiles test reporting away (see CaptureLevel.h),
+ * counter() and gauge() return empty handles inline, so add() and set() vanish.
+ */
+
+/**
+ * @brief Handle on a counter of the running test.
+ *
+ * Each thread adds into its own cache-line-padded slot, so concurrent adds
+ * never contend. At the end of the test the slots of all threads are summed
+ * into a result parameter named after the counter (up to 64 counters per
+ * test; further names are only counted in a "dropped counters" parameter).
+ * Outside of a running test the handle is empty and add() does nothing.
+ *
+ * Keep the handle in a local variable around hot loops: it saves the name lookup.
+ *
+ * Example usage:
+ * @code
+ *   auto cacheHits = allure::counter("cache hits");
+ *   for (const auto& key : keys) {
+ *       if (cache.contains(key)) {
+ *           cacheHits.add();
+ *       }
+ *   }
+ * @endcode
+ */
+class Counter {
+public:
+    constexpr explicit Counter(std::atomic<std::int64_t>* slot) noexcept
+        : m_slot(slot)
+    {
+    }
+
+    /**
+     * @brief Adds to the counter (a relaxed atomic add on a slot of the calling thread).
+     * @param n Amount to add (default 1).
+     */
+    void add(std::int64_t n = 1) noexcept {
+        if (m_slot) {
+            m_slot->fetch_add(n, std::memory_order_relaxed);
+        }
+    }
+
+    /** @brief False when no test was running when the handle was created. */
+    explicit operator bool() const noexcept {
+        return m_slot != nullptr;
+    }
+
+private:
+    std::atomic<std::int64_t>* m_slot;
+};
+
+#if ALLURE_CAPTURE_LEVEL >= ALLURE_CAPTURE_TESTS
+/**
+ * @brief Handle on a gauge of the running test.
+ *
+ * set() stores the current value, and samples it at most once per sampling
+ * interval (see Configuration::gaugeSampling()) into a bounded time series.
+ * At the end of the test each gauge becomes a parameter with its last, min
+ * and max values, and the series of all gauges are attached as "gauges"
+ * (CSV or JSON, see Configuration::gaugeSeriesFormat()). Up to 32 gauges
+ * per test; further names are only counted in a "dropped gauges" parameter.
+ * Outside of a running test the handle is empty and set() does nothing.
+ *
+ * Example usage:
+ * @code
+ *   auto queueDepth = allure::gauge("queue depth");
+ *   while (consumer.poll()) {
+ *       queueDepth.set(static_cast<double>(queue.size()));
+ *   }
+ * @endcode
+ */
+class Gauge {
+public:
+    Gauge(service::ITestMetricRegistry* registry, service::GaugeSlot* slot) noexcept
+        : m_registry(registry)
+        , m_slot(slot)
+    {
+    }
+
+    /**
+     * @brief Sets the current value of the gauge.
+     * @param value The new value.
+     */
+    void set(double value);
+
+    /** @brief False when no test was running when the handle was created. */
+    explicit operator bool() const noexcept {
+        return m_slot != nullptr;
+    }
+
+private:
+    service::ITestMetricRegistry* m_registry;
+    service::GaugeSlot* m_slot;
+};
+
+/**
+ * @brief Gets a counter of the running test.
+ * @param name Counter name, used as result parameter name.
+ * @return A handle, empty when no test is running.
+ */
+Counter counter(std::string_view name);
+
+/**
+ * @brief Gets a gauge of the running test.
+ * @param name Gauge name, used as result parameter and series name.
+ * @return A handle, empty when no test is running.
+ */
+Gauge gauge(std::string_view name);
+
+#else
+
+inline namespace elided {
+
+/**
+ * @brief No-op gauge handle, used when ALLURE_CAPTURE_LEVEL compiles test reporting away.
+ */
+class Gauge {
+public:
+    constexpr void set(double) noexcept {}
+
+    explicit constexpr operator bool() const noexcept {
+        return false;
+    }
+};
+
+constexpr Counter counter(std::string_view) noexcept {
+    return Counter(nullptr);
+}
+
+constexpr Gauge gauge(std::string_view) noexcept {
+    return Gauge();
+}
+
+} // namespace elided
+
+#endif
+
+} // namespace allure
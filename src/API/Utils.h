@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ParameterValue.h"
 #include <fmt/format.h>
 #include <string>
 #include <string_view>
@@ -30,5 +31,44 @@ inline std::string format(fmt::format_string<Args...> fmt_str, Args&&... args) {
     return fmt::format(fmt_str, std::forward<Args>(args)...);
 }
 
+/**
+ * Format a duration with 4 significant digits in ns, us, ms or s.
+ * @param nanoseconds The duration in nanoseconds.
+ * @return The formatted duration, e.g. "12.35 us".
+ */
+inline std::string formatNanoseconds(double nanoseconds) {
+    if (nanoseconds < 1e3) {
+        return fmt::format("{:.4g} ns", nanoseconds);
+    }
+    if (nanoseconds < 1e6) {
+        return fmt::format("{:.4g} us", nanoseconds / 1e3);
+    }
+    if (nanoseconds < 1e9) {
+        return fmt::format("{:.4g} ms", nanoseconds / 1e6);
+    }
+    return fmt::format("{:.4g} s", nanoseconds / 1e9);
+}
+
+/**
+ * Format a parameter value that is neither text nor stored natively.
+ * @tparam T Any type with a `fmt::formatter`.
+ * @param value Parameter value.
+ * @return The formatted value.
+ */
+template<typename T>
+inline std::string formatParameterValue(ParameterFormatTag, const T& value) {
+    return fmt::format("{}", value);
+}
+
+/**
+ * Whether T has an `fmt::formatter` (e.g. an enum printed by name), found by has_fmt_formatter.
+ * @tparam T Parameter value type.
+ * @return std::true_type if it has one, std::false_type otherwise.
+ */
+template<typename T>
+constexpr std::bool_constant<std::is_constructible_v<fmt::formatter<T>>> hasFmtFormatter(const ParameterFormatTag&, const T*) {
+    return {};
+}
+
 } // namespace detail
 } // namespace allure
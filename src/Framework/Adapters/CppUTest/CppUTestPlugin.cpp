@@ -2,16 +2,90 @@
 #include "Framework/Adapters/CppUTest/CppUTestPlugin.h"
 #include "Framework/Adapters/CppUTest/CppUTestMetadata.h"
 #include "Model/Status.h"
+#include "Services/Metrics/AllocationTracker.h"
 #include <CppUTest/TestHarness.h>
 #include <CppUTest/TestPlugin.h>
 #include <CppUTest/MemoryLeakWarningPlugin.h>
 #include <CppUTest/MemoryLeakDetector.h>
+#include <CppUTest/TestMemoryAllocator.h>
 
 
 namespace allure {
 namespace adapters {
 namespace cpputest {
 
+	namespace {
+
+		/**
+		 * Reports the allocations of CppUTest's operator new/delete to the AllocationTracker.
+		 *
+		 * CppUTest's memory leak detection owns the global operator new/delete, so instead
+		 * of replacing them again, this allocator is chained in front of the current one.
+		 * Leak detection keeps working, and sizes include its bookkeeping overhead.
+		 */
+		class CountingMemoryAllocator : public TestMemoryAllocator
+		{
+		public:
+			explicit CountingMemoryAllocator(TestMemoryAllocator* originalAllocator)
+				: TestMemoryAllocator(originalAllocator->name(), originalAllocator->alloc_name(), originalAllocator->free_name())
+				, m_originalAllocator(originalAllocator)
+			{
+			}
+
+			char* alloc_memory(size_t size, const char* file, size_t line) override
+			{
+				char* memory = m_originalAllocator->alloc_memory(size, file, line);
+				if (memory != nullptr)
+				{
+					allure::service::AllocationTracker::instance().recordAllocation(size, size);
+				}
+				return memory;
+			}
+
+			void free_memory(char* memory, size_t size, const char* file, size_t line) override
+			{
+				if (memory != nullptr)
+				{
+					allure::service::AllocationTracker::instance().recordDeallocation(size);
+				}
+				m_originalAllocator->free_memory(memory, size, file, line);
+			}
+
+			char* allocMemoryLeakNode(size_t size) override
+			{
+				return m_originalAllocator->allocMemoryLeakNode(size);
+			}
+
+			void freeMemoryLeakNode(char* memory) override
+			{
+				m_originalAllocator->freeMemoryLeakNode(memory);
+			}
+
+			TestMemoryAllocator* actualAllocator() override
+			{
+				return m_originalAllocator->actualAllocator();
+			}
+
+		private:
+			TestMemoryAllocator* m_originalAllocator;
+		};
+
+		void installCountingAllocators()
+		{
+			allure::service::AllocationTracker& tracker = allure::service::AllocationTracker::instance();
+			if (!tracker.isEnabled() || tracker.isHooked())
+			{
+				return;
+			}
+
+			static CountingMemoryAllocator newAllocator(getCurrentNewAllocator());
+			static CountingMemoryAllocator newArrayAllocator(getCurrentNewArrayAllocator());
+			setCurrentNewAllocator(&newAllocator);
+			setCurrentNewArrayAllocator(&newArrayAllocator);
+			tracker.setHooked(true);
+		}
+	}
+
 	CppUTestPlugin::CppUTestPlugin(
 		allure::service::ITestProgramStartEventHandler* programStartHandler,
 		allure::service::ITestProgramEndEventHandler* programEndHandler,
@@ -100,6 +174,7 @@ namespace cpputest {
 			this->onTestProgramStart();
 			programStarted = true;
 		}
+		installCountingAllocators();
 
 		// Check if we're starting a new test group
 		std::string group = test.getGroup().asCharString();
@@ -0,0 +1,60 @@
+#include "Framework/Adapters/GoogleBenchmark/AllureGBenchmark.h"
+
+#include "API/Core.h"
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkAdapter.h"
+#include "Model/TestProgram.h"
+#include "Services/ServicesFactory.h"
+
+#include <benchmark/benchmark.h>
+
+namespace allure { namespace adapters { namespace googlebenchmark {
+
+class AllureGBenchmark::Impl
+{
+public:
+	Impl(const std::string& outputFolder)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder(outputFolder);
+		testProgram.setFrameworkName("GoogleBenchmark");
+
+		m_servicesFactory = std::make_unique<service::ServicesFactory>(testProgram);
+
+		auto adapter = std::make_shared<GBenchmarkAdapter>(
+			m_servicesFactory->buildTestProgramStartEventHandler(),
+			m_servicesFactory->buildTestProgramEndEventHandler(),
+			m_servicesFactory->buildTestSuiteStartEventHandler(),
+			m_servicesFactory->buildTestSuiteEndEventHandler(),
+			m_servicesFactory->buildTestCaseStartEventHandler(),
+			m_servicesFactory->buildTestCaseEndEventHandler(),
+			&m_consoleReporter
+		);
+		adapter->initialize();
+		detail::Core::instance().setFrameworkAdapter(adapter);
+		m_adapter = std::move(adapter);
+	}
+
+	benchmark::BenchmarkReporter* getReporter() const
+	{
+		return m_adapter->getReporter();
+	}
+
+private:
+	::benchmark::ConsoleReporter m_consoleReporter;
+	std::shared_ptr<GBenchmarkAdapter> m_adapter;
+	std::unique_ptr<service::ServicesFactory> m_servicesFactory;
+};
+
+AllureGBenchmark::AllureGBenchmark(const std::string& outputFolder)
+	: m_impl(std::make_unique<Impl>(outputFolder))
+{
+}
+
+AllureGBenchmark::~AllureGBenchmark() = default;
+
+benchmark::BenchmarkReporter* AllureGBenchmark::getReporter() const
+{
+	return m_impl->getReporter();
+}
+
+}}} // namespace allure::adapters::googlebenchmark
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace benchmark {
+class BenchmarkReporter;
+}
+
+namespace allure { namespace adapters { namespace googlebenchmark {
+
+/**
+ * @brief Reports Google Benchmark runs as Allure results.
+ *
+ * Runs are still printed by a console reporter. Durations of the results are
+ * the real time per iteration, so that duration baselines flag regressions.
+ *
+ * Example usage:
+ * @code
+ *   int main(int argc, char** argv) {
+ *       benchmark::Initialize(&argc, argv);
+ *       allure::AllureGBenchmark allureBenchmark;
+ *       benchmark::RunSpecifiedBenchmarks(allureBenchmark.getReporter());
+ *       benchmark::Shutdown();
+ *   }
+ * @endcode
+ */
+class AllureGBenchmark
+{
+public:
+    explicit AllureGBenchmark(const std::string& outputFolder = "allure-results");
+    ~AllureGBenchmark();
+
+    AllureGBenchmark(const AllureGBenchmark&) = delete;
+    AllureGBenchmark& operator=(const AllureGBenchmark&) = delete;
+    AllureGBenchmark(AllureGBenchmark&&) = delete;
+    AllureGBenchmark& operator=(AllureGBenchmark&&) = delete;
+
+    /** @brief Reporter to pass to benchmark::RunSpecifiedBenchmarks(). */
+    benchmark::BenchmarkReporter* getReporter() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+}}} // namespace allure::adapters::googlebenchmark
+
+namespace allure {
+using AllureGBenchmark = allure::adapters::googlebenchmark::AllureGBenchmark;
+}
@@ -0,0 +1,68 @@
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkAdapter.h"
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkReporter.h"
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkStatusProvider.h"
+
+
+namespace allure {
+namespace adapters {
+namespace googlebenchmark {
+
+	GBenchmarkAdapter::GBenchmarkAdapter(
+		std::unique_ptr<allure::service::ITestProgramStartEventHandler> programStartHandler,
+		std::unique_ptr<allure::service::ITestProgramEndEventHandler> programEndHandler,
+		std::unique_ptr<allure::service::ITestSuiteStartEventHandler> suiteStartHandler,
+		std::unique_ptr<allure::service::ITestSuiteEndEventHandler> suiteEndHandler,
+		std::unique_ptr<allure::service::ITestCaseStartEventHandler> caseStartHandler,
+		std::unique_ptr<allure::service::ITestCaseEndEventHandler> caseEndHandler,
+		::benchmark::BenchmarkReporter* displayReporter)
+		: m_programStartHandler(std::move(programStartHandler))
+		, m_programEndHandler(std::move(programEndHandler))
+		, m_suiteStartHandler(std::move(suiteStartHandler))
+		, m_suiteEndHandler(std::move(suiteEndHandler))
+		, m_caseStartHandler(std::move(caseStartHandler))
+		, m_caseEndHandler(std::move(caseEndHandler))
+		, m_displayReporter(displayReporter)
+		, m_reporter()
+	{
+	}
+
+	GBenchmarkAdapter::~GBenchmarkAdapter() = default;
+
+	void GBenchmarkAdapter::initialize()
+	{
+		// Unlike other frameworks, Google Benchmark does not own the reporter
+		m_reporter = std::make_unique<GBenchmarkReporter>(
+			m_programStartHandler.get(),
+			m_programEndHandler.get(),
+			m_suiteStartHandler.get(),
+			m_suiteEndHandler.get(),
+			m_caseStartHandler.get(),
+			m_caseEndHandler.get(),
+			m_displayReporter
+		);
+	}
+
+	std::unique_ptr<ITestStatusProvider> GBenchmarkAdapter::createStatusProvider() const
+	{
+		return std::make_unique<GBenchmarkStatusProvider>();
+	}
+
+	FrameworkCapabilities GBenchmarkAdapter::getCapabilities() const
+	{
+		// Google Benchmark capabilities
+		return FrameworkCapabilities(
+			true,   // supportsTestSuites - Benchmark families
+			false,  // supportsRuntimeStatus - Runs are reported once finished
+			true,   // supportsSkippedTests - SkipWithError() and SkipWithMessage()
+			true,   // supportsParametricTests - Arg(), Args() and Range()
+			"GoogleBenchmark",
+			"1.7"   // Minimum Google Benchmark version
+		);
+	}
+
+	::benchmark::BenchmarkReporter* GBenchmarkAdapter::getReporter() const
+	{
+		return m_reporter.get();
+	}
+
+}}} // namespace allure::adapters::googlebenchmark
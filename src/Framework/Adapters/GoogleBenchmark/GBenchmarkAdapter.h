@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Framework/ITestFrameworkAdapter.h"
+#include "Services/EventHandlers/ITestProgramStartEventHandler.h"
+#include "Services/EventHandlers/ITestProgramEndEventHandler.h"
+#include "Services/EventHandlers/ITestSuiteStartEventHandler.h"
+#include "Services/EventHandlers/ITestSuiteEndEventHandler.h"
+#include "Services/EventHandlers/ITestCaseStartEventHandler.h"
+#include "Services/EventHandlers/ITestCaseEndEventHandler.h"
+#include <memory>
+
+namespace benchmark {
+	class BenchmarkReporter;
+}
+
+
+namespace allure {
+namespace adapters {
+namespace googlebenchmark {
+
+	class GBenchmarkReporter;
+
+	/**
+	 * @brief Main adapter class for Google Benchmark integration.
+	 *
+	 * Google Benchmark has no listener registry: results reach a reporter that is
+	 * passed to ::benchmark::RunSpecifiedBenchmarks(). Initializing the adapter
+	 * therefore only creates the GBenchmarkReporter, which the caller then hands
+	 * over to Google Benchmark through getReporter().
+	 *
+	 * Google Benchmark Capabilities:
+	 * - Test Suites: Yes (benchmark families)
+	 * - Runtime Status: No (runs are reported once finished)
+	 * - Skipped Tests: Yes (SkipWithError(), SkipWithMessage())
+	 * - Parametric Tests: Yes (Arg(), Args(), Range())
+	 *
+	 * Usage:
+	 * @code
+	 * auto adapter = std::make_unique<GBenchmarkAdapter>(
+	 *     std::move(programStartHandler),
+	 *     std::move(programEndHandler),
+	 *     std::move(suiteStartHandler),
+	 *     std::move(suiteEndHandler),
+	 *     std::move(caseStartHandler),
+	 *     std::move(caseEndHandler),
+	 *     &consoleReporter
+	 * );
+	 * adapter->initialize();
+	 * ::benchmark::RunSpecifiedBenchmarks(adapter->getReporter());
+	 * @endcode
+	 */
+	class GBenchmarkAdapter : public allure::ITestFrameworkAdapter
+	{
+	public:
+		/**
+		 * @brief Construct the Google Benchmark adapter with event handlers.
+		 *
+		 * The adapter takes ownership of the event handlers and manages their lifetime.
+		 *
+		 * @param programStartHandler Handler for program start events (must not be null)
+		 * @param programEndHandler Handler for program end events (must not be null)
+		 * @param suiteStartHandler Handler for suite start events (must not be null)
+		 * @param suiteEndHandler Handler for suite end events (must not be null)
+		 * @param caseStartHandler Handler for test case start events (must not be null)
+		 * @param caseEndHandler Handler for test case end events (must not be null)
+		 * @param displayReporter Reporter the runs are forwarded to (may be null; not owned)
+		 */
+		GBenchmarkAdapter(
+			std::unique_ptr<allure::service::ITestProgramStartEventHandler> programStartHandler,
+			std::unique_ptr<allure::service::ITestProgramEndEventHandler> programEndHandler,
+			std::unique_ptr<allure::service::ITestSuiteStartEventHandler> suiteStartHandler,
+			std::unique_ptr<allure::service::ITestSuiteEndEventHandler> suiteEndHandler,
+			std::unique_ptr<allure::service::ITestCaseStartEventHandler> caseStartHandler,
+			std::unique_ptr<allure::service::ITestCaseEndEventHandler> caseEndHandler,
+			::benchmark::BenchmarkReporter* displayReporter);
+
+		~GBenchmarkAdapter() override;
+
+		// ITestFrameworkAdapter implementation
+		void initialize() override;
+		std::unique_ptr<ITestStatusProvider> createStatusProvider() const override;
+		FrameworkCapabilities getCapabilities() const override;
+
+		// Google Benchmark-specific method to get the reporter created by initialize()
+		::benchmark::BenchmarkReporter* getReporter() const;
+
+	private:
+		// Event handler pointers (owned by this adapter)
+		std::unique_ptr<allure::service::ITestProgramStartEventHandler> m_programStartHandler;
+		std::unique_ptr<allure::service::ITestProgramEndEventHandler> m_programEndHandler;
+		std::unique_ptr<allure::service::ITestSuiteStartEventHandler> m_suiteStartHandler;
+		std::unique_ptr<allure::service::ITestSuiteEndEventHandler> m_suiteEndHandler;
+		std::unique_ptr<allure::service::ITestCaseStartEventHandler> m_caseStartHandler;
+		std::unique_ptr<allure::service::ITestCaseEndEventHandler> m_caseEndHandler;
+
+		::benchmark::BenchmarkReporter* m_displayReporter;
+		std::unique_ptr<GBenchmarkReporter> m_reporter;
+	};
+
+}}} // namespace allure::adapters::googlebenchmark
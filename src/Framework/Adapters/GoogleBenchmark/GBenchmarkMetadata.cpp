@@ -0,0 +1,39 @@
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkMetadata.h"
+
+
+namespace allure {
+namespace adapters {
+namespace googlebenchmark {
+
+	GBenchmarkMetadata::GBenchmarkMetadata(const ::benchmark::BenchmarkReporter::Run& run)
+		: m_run(run)
+	{
+	}
+
+	std::string GBenchmarkMetadata::getTestName() const
+	{
+		return m_run.benchmark_name();
+	}
+
+	std::string GBenchmarkMetadata::getSuiteName() const
+	{
+		return m_run.run_name.function_name;
+	}
+
+	std::string GBenchmarkMetadata::getFullName() const
+	{
+		// The benchmark name already starts with the family name
+		return getTestName();
+	}
+
+	std::string GBenchmarkMetadata::getFileName() const
+	{
+		return "";
+	}
+
+	int GBenchmarkMetadata::getLineNumber() const
+	{
+		return 0;
+	}
+
+}}} // namespace allure::adapters::googlebenchmark
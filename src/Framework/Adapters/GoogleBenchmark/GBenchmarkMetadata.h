@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Framework/ITestMetadata.h"
+#include <benchmark/benchmark.h>
+#include <string>
+
+
+namespace allure {
+namespace adapters {
+namespace googlebenchmark {
+
+	/**
+	 * @brief Google Benchmark-specific implementation of ITestMetadata.
+	 *
+	 * This class wraps a run reported by Google Benchmark to provide test
+	 * metadata in a framework-agnostic format:
+	 * - Suite name: The benchmark family (e.g., "BM_Sort")
+	 * - Test name: The full benchmark name, including arguments and the
+	 *   aggregate suffix (e.g., "BM_Sort/1024/real_time_mean")
+	 *
+	 * Benchmarks do not expose their source location, so the file name is
+	 * empty and the line number is 0.
+	 */
+	class GBenchmarkMetadata : public allure::ITestMetadata
+	{
+	public:
+		/**
+		 * @brief Construct metadata wrapper around a Google Benchmark run.
+		 *
+		 * @param run Reference to the run being reported
+		 *            Must remain valid for the lifetime of this object
+		 */
+		explicit GBenchmarkMetadata(const ::benchmark::BenchmarkReporter::Run& run);
+
+		~GBenchmarkMetadata() override = default;
+
+		// ITestMetadata implementation
+		std::string getTestName() const override;
+		std::string getSuiteName() const override;
+		std::string getFullName() const override;
+		std::string getFileName() const override;
+		int getLineNumber() const override;
+
+	private:
+		const ::benchmark::BenchmarkReporter::Run& m_run;
+	};
+
+}}} // namespace allure::adapters::googlebenchmark
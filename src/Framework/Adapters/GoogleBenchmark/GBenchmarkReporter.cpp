@@ -0,0 +1,231 @@
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkReporter.h"
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkMetadata.h"
+
+#include "API/Core.h"
+#include "Model/Parameter.h"
+#include "Model/TestCase.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+
+
+namespace allure {
+namespace adapters {
+namespace googlebenchmark {
+
+	namespace {
+
+		struct RunOutcome
+		{
+			model::Status status;
+			std::string message;
+		};
+
+		// Google Benchmark 1.8 replaced Run::error_occurred by Run::skipped, which
+		// also tells benchmarks skipped on purpose from those that hit an error
+		template<typename BenchmarkRun>
+		auto getRunOutcome(const BenchmarkRun& run, int) -> decltype(run.error_occurred, RunOutcome())
+		{
+			if (run.error_occurred)
+			{
+				return { model::Status::BROKEN, run.error_message };
+			}
+			return { model::Status::PASSED, "" };
+		}
+
+		template<typename BenchmarkRun>
+		auto getRunOutcome(const BenchmarkRun& run, long) -> decltype(run.skipped, RunOutcome())
+		{
+			switch (static_cast<int>(run.skipped))
+			{
+				case 1:
+					return { model::Status::SKIPPED, run.skip_message };
+				case 2:
+					return { model::Status::BROKEN, run.skip_message };
+				default:
+					return { model::Status::PASSED, "" };
+			}
+		}
+
+		bool isTimeRun(const ::benchmark::BenchmarkReporter::Run& run)
+		{
+			return !run.report_big_o && !run.report_rms && (run.aggregate_unit == ::benchmark::kTime);
+		}
+
+		std::string formatRunTime(const ::benchmark::BenchmarkReporter::Run& run, double adjustedTime, double accumulatedTime)
+		{
+			if (run.report_big_o)
+			{
+				return fmt::format("{:.4g}", adjustedTime);
+			}
+			if (run.report_rms)
+			{
+				return fmt::format("{:.0f} %", adjustedTime * 100.0);
+			}
+			if (run.aggregate_unit == ::benchmark::kPercentage)
+			{
+				return fmt::format("{:.2f} %", accumulatedTime * 100.0);
+			}
+			return fmt::format("{:.4g} {}", adjustedTime, ::benchmark::GetTimeUnitString(run.time_unit));
+		}
+
+		std::string formatCounter(const std::string& name, const ::benchmark::Counter& counter)
+		{
+			double value = counter.value;
+			if (name == "bytes_per_second")
+			{
+				const char* units[] = { "B/s", "KiB/s", "MiB/s", "GiB/s", "TiB/s" };
+				size_t unit = 0;
+				while ((std::fabs(value) >= 1024.0) && (unit < 4))
+				{
+					value /= 1024.0;
+					unit++;
+				}
+				return fmt::format("{:.4g} {}", value, units[unit]);
+			}
+
+			bool rate = ((counter.flags & ::benchmark::Counter::kIsRate) != 0) &&
+			            ((counter.flags & ::benchmark::Counter::kInvert) == 0);
+			return rate ? fmt::format("{:.6g}/s", value) : fmt::format("{:.6g}", value);
+		}
+
+		model::Parameter buildParameter(const std::string& name, const std::string& value, bool excluded)
+		{
+			model::Parameter parameter;
+			parameter.setName(name);
+			parameter.setValue(value);
+			parameter.setExcluded(excluded);
+			return parameter;
+		}
+	}
+
+	GBenchmarkReporter::GBenchmarkReporter(
+		allure::service::ITestProgramStartEventHandler* programStartHandler,
+		allure::service::ITestProgramEndEventHandler* programEndHandler,
+		allure::service::ITestSuiteStartEventHandler* suiteStartHandler,
+		allure::service::ITestSuiteEndEventHandler* suiteEndHandler,
+		allure::service::ITestCaseStartEventHandler* caseStartHandler,
+		allure::service::ITestCaseEndEventHandler* caseEndHandler,
+		::benchmark::BenchmarkReporter* displayReporter)
+		: TestLifecycleListenerBase(programStartHandler, programEndHandler,
+		                            suiteStartHandler, suiteEndHandler,
+		                            caseStartHandler, caseEndHandler)
+		, m_displayReporter(displayReporter)
+		, m_currentFamily()
+		, m_suiteStarted(false)
+		, m_suiteFailed(false)
+	{
+	}
+
+	bool GBenchmarkReporter::ReportContext(const Context& context)
+	{
+		this->onTestProgramStart();
+		return m_displayReporter ? m_displayReporter->ReportContext(context) : true;
+	}
+
+	void GBenchmarkReporter::ReportRuns(const std::vector<Run>& runs)
+	{
+		// Display first, so that console output is not captured into the results
+		if (m_displayReporter)
+		{
+			m_displayReporter->ReportRuns(runs);
+		}
+
+		for (const Run& run : runs)
+		{
+			reportRun(run);
+		}
+	}
+
+	void GBenchmarkReporter::Finalize()
+	{
+		endRunningSuite();
+		this->onTestProgramEnd();
+
+		if (m_displayReporter)
+		{
+			m_displayReporter->Finalize();
+		}
+	}
+
+	void GBenchmarkReporter::reportRun(const Run& run)
+	{
+		GBenchmarkMetadata metadata(run);
+
+		// Runs of a family are reported back to back, so a new family starts a new suite
+		if (!m_suiteStarted || (run.run_name.function_name != m_currentFamily))
+		{
+			endRunningSuite();
+			m_currentFamily = run.run_name.function_name;
+			m_suiteStarted = true;
+			m_suiteFailed = false;
+			this->onTestSuiteStart(metadata);
+		}
+
+		RunOutcome outcome = getRunOutcome(run, 0);
+		this->onTestStart(metadata);
+
+		model::TestCase* testCase = detail::Core::instance().getTestProgram().getRunningTestCase();
+		if (testCase)
+		{
+			addRunParameters(*testCase, run);
+
+			// The run is over already: its duration is the measured time per iteration
+			if ((outcome.status == model::Status::PASSED) && isTimeRun(run))
+			{
+				double nanoseconds = run.GetAdjustedRealTime() * 1e9 / ::benchmark::GetTimeUnitMultiplier(run.time_unit);
+				testCase->setDurationNs(std::max<uint64_t>(1, static_cast<uint64_t>(std::llround(nanoseconds))));
+			}
+		}
+
+		if ((outcome.status == model::Status::FAILED) || (outcome.status == model::Status::BROKEN))
+		{
+			m_suiteFailed = true;
+		}
+		this->onTestEnd(metadata, outcome.status, outcome.message, "");
+	}
+
+	void GBenchmarkReporter::addRunParameters(model::TestCase& testCase, const Run& run) const
+	{
+		if (!run.run_name.args.empty())
+		{
+			testCase.addParameter(buildParameter("arguments", run.run_name.args, false));
+		}
+		if (run.run_type == Run::RT_Aggregate)
+		{
+			testCase.addParameter(buildParameter("aggregate", run.aggregate_name, false));
+		}
+		else if (run.repetitions > 1)
+		{
+			testCase.addParameter(buildParameter("repetition", std::to_string(run.repetition_index), false));
+		}
+		if (!run.report_label.empty())
+		{
+			testCase.addParameter(buildParameter("label", run.report_label, true));
+		}
+
+		// Measurements change on every run, so they do not identify the result
+		testCase.addParameter(buildParameter("real time", formatRunTime(run, run.GetAdjustedRealTime(), run.real_accumulated_time), true));
+		testCase.addParameter(buildParameter("cpu time", formatRunTime(run, run.GetAdjustedCPUTime(), run.cpu_accumulated_time), true));
+		testCase.addParameter(buildParameter("iterations", std::to_string(run.iterations), true));
+		if (run.threads > 1)
+		{
+			testCase.addParameter(buildParameter("threads", std::to_string(run.threads), true));
+		}
+		for (const auto& counter : run.counters)
+		{
+			testCase.addParameter(buildParameter(counter.first, formatCounter(counter.first, counter.second), true));
+		}
+	}
+
+	void GBenchmarkReporter::endRunningSuite()
+	{
+		if (m_suiteStarted)
+		{
+			this->onTestSuiteEnd(m_suiteFailed ? allure::model::Status::FAILED : allure::model::Status::PASSED);
+			m_suiteStarted = false;
+		}
+	}
+
+}}} // namespace allure::adapters::googlebenchmark
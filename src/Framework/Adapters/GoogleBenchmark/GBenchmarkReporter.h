@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Framework/TestLifecycleListenerBase.h"
+#include "Model/Status.h"
+#include "Services/EventHandlers/ITestProgramStartEventHandler.h"
+#include "Services/EventHandlers/ITestProgramEndEventHandler.h"
+#include "Services/EventHandlers/ITestSuiteStartEventHandler.h"
+#include "Services/EventHandlers/ITestSuiteEndEventHandler.h"
+#include "Services/EventHandlers/ITestCaseStartEventHandler.h"
+#include "Services/EventHandlers/ITestCaseEndEventHandler.h"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+
+namespace allure {
+
+namespace model {
+	class TestCase;
+}
+
+namespace adapters {
+namespace googlebenchmark {
+
+	/**
+	 * @brief Google Benchmark reporter that bridges benchmark runs to the abstraction layer.
+	 *
+	 * This class serves as the integration point between Google Benchmark's
+	 * reporter interface and the framework-agnostic abstraction layer. It inherits from both:
+	 *
+	 * 1. benchmark::BenchmarkReporter - Google Benchmark's reporter interface
+	 *    Receives the runs once each benchmark has finished
+	 *
+	 * 2. TestLifecycleListenerBase - Framework-agnostic bridge class
+	 *    Delegates to existing event handlers
+	 *
+	 * Each benchmark family is reported as a suite and each run (every argument
+	 * set, repetition and aggregate such as mean, median or stddev) as a test case
+	 * with real time, CPU time, iterations and user counters (including bytes and
+	 * items per second) as parameters. The duration of the test case is the real
+	 * time per iteration, so that duration baselines flag benchmark regressions.
+	 * Runs that Google Benchmark reports as errors are BROKEN.
+	 *
+	 * Flow:
+	 * Google Benchmark run → GBenchmarkReporter → TestLifecycleListenerBase → Event handlers
+	 *
+	 * Usage:
+	 * @code
+	 * ::benchmark::ConsoleReporter console;
+	 * GBenchmarkReporter reporter(
+	 *     programStartHandler.get(),
+	 *     programEndHandler.get(),
+	 *     suiteStartHandler.get(),
+	 *     suiteEndHandler.get(),
+	 *     caseStartHandler.get(),
+	 *     caseEndHandler.get(),
+	 *     &console
+	 * );
+	 * ::benchmark::RunSpecifiedBenchmarks(&reporter);
+	 * @endcode
+	 */
+	class GBenchmarkReporter : public ::benchmark::BenchmarkReporter,
+	                           public allure::TestLifecycleListenerBase
+	{
+	public:
+		/**
+		 * @brief Construct the reporter with event handlers.
+		 *
+		 * All event handlers are passed to TestLifecycleListenerBase for delegation.
+		 *
+		 * @param programStartHandler Handler for program start events (must not be null)
+		 * @param programEndHandler Handler for program end events (must not be null)
+		 * @param suiteStartHandler Handler for suite start events (must not be null)
+		 * @param suiteEndHandler Handler for suite end events (must not be null)
+		 * @param caseStartHandler Handler for test case start events (must not be null)
+		 * @param caseEndHandler Handler for test case end events (must not be null)
+		 * @param displayReporter Reporter all runs are forwarded to, so that they are
+		 *                        still displayed (may be null; not owned)
+		 */
+		GBenchmarkReporter(
+			allure::service::ITestProgramStartEventHandler* programStartHandler,
+			allure::service::ITestProgramEndEventHandler* programEndHandler,
+			allure::service::ITestSuiteStartEventHandler* suiteStartHandler,
+			allure::service::ITestSuiteEndEventHandler* suiteEndHandler,
+			allure::service::ITestCaseStartEventHandler* caseStartHandler,
+			allure::service::ITestCaseEndEventHandler* caseEndHandler,
+			::benchmark::BenchmarkReporter* displayReporter);
+
+		~GBenchmarkReporter() override = default;
+
+		// BenchmarkReporter callbacks
+		bool ReportContext(const Context& context) override;
+		void ReportRuns(const std::vector<Run>& runs) override;
+		void Finalize() override;
+
+	private:
+		void reportRun(const Run& run);
+		void addRunParameters(model::TestCase& testCase, const Run& run) const;
+		void endRunningSuite();
+
+	private:
+		::benchmark::BenchmarkReporter* m_displayReporter;
+		std::string m_currentFamily;
+		bool m_suiteStarted;
+		bool m_suiteFailed;
+	};
+
+}}} // namespace allure::adapters::googlebenchmark
@@ -0,0 +1,19 @@
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkStatusProvider.h"
+
+
+namespace allure {
+namespace adapters {
+namespace googlebenchmark {
+
+	bool GBenchmarkStatusProvider::isCurrentTestFailed() const
+	{
+		// Errors of a benchmark are only known when its run is reported
+		return false;
+	}
+
+	bool GBenchmarkStatusProvider::isCurrentTestSkipped() const
+	{
+		return false;
+	}
+
+}}} // namespace allure::adapters::googlebenchmark
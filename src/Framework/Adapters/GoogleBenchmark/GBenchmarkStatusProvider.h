@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Framework/ITestStatusProvider.h"
+
+
+namespace allure {
+namespace adapters {
+namespace googlebenchmark {
+
+	/**
+	 * @brief Google Benchmark-specific implementation of ITestStatusProvider.
+	 *
+	 * Benchmark runs are only reported once they have finished, so there is no
+	 * running test to query: both methods always return false.
+	 */
+	class GBenchmarkStatusProvider : public allure::ITestStatusProvider
+	{
+	public:
+		GBenchmarkStatusProvider() = default;
+
+		~GBenchmarkStatusProvider() override = default;
+
+		// ITestStatusProvider implementation
+		bool isCurrentTestFailed() const override;
+		bool isCurrentTestSkipped() const override;
+	};
+
+}}} // namespace allure::adapters::googlebenchmark
@@ -1,6 +1,9 @@
 #include "Framework/Adapters/GoogleTest/GTestEventListener.h"
 #include "Framework/Adapters/GoogleTest/GTestMetadata.h"
+#include "API/Core.h"
 #include "Model/Status.h"
+#include "Services/Metrics/AllocationTracker.h"
+#include "Services/Report/StatusDetailsBuilder.h"
 
 
 namespace allure {
@@ -57,6 +60,9 @@ namespace googletest {
 
 	void GTestEventListener::OnTestEnd(const ::testing::TestInfo& testInfo)
 	{
+		// Building the status details is bookkeeping, not part of the test
+		allure::service::AllocationTracker::Pause allocationPause;
+
 		// Create metadata wrapper
 		GTestMetadata metadata(testInfo);
 
@@ -79,22 +85,14 @@ namespace googletest {
 		{
 			status = allure::model::Status::FAILED;
 
-			// Extract failure message and trace
+			// Extract failure message and trace (bounded, repeated failures are counted)
+			size_t maxBytes = allure::detail::getTestProgram().getMaxStatusDetailBytes();
+			allure::service::StatusDetailsBuilder statusDetails(maxBytes);
 			for (int i = 0; i < result->total_part_count(); i++)
 			{
 				const ::testing::TestPartResult& part = result->GetTestPartResult(i);
 				if (part.failed())
 				{
-					if (!statusMessage.empty())
-					{
-						statusMessage += "\n";
-					}
-					statusMessage += part.message();
-
-					if (!statusTrace.empty())
-					{
-						statusTrace += "\n";
-					}
 					// file_name() can be nullptr when failure is from an exception
 					std::string location;
 					if (part.file_name() != nullptr)
@@ -105,9 +103,12 @@ namespace googletest {
 					{
 						location = "unknown file";
 					}
-					statusTrace += location + "\n" + part.message();
+					statusDetails.addFailure(part.message(), location);
 				}
 			}
+
+			statusMessage = statusDetails.getMessage();
+			statusTrace = statusDetails.getTrace();
 		}
 
 		// Call parent method
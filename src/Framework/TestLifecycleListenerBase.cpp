@@ -1,5 +1,7 @@
 #include "Framework/TestLifecycleListenerBase.h"
 
+#include "Services/Metrics/AllocationTracker.h"
+
 #include <stdexcept>
 
 
@@ -42,6 +44,8 @@ namespace allure {
 
 	void TestLifecycleListenerBase::onTestStart(const ITestMetadata& metadata)
 	{
+		allure::service::AllocationTracker::Pause allocationPause;
+
 		// Delegate to handler with full metadata for parametric test support
 		m_caseStartHandler->handleTestCaseStart(metadata);
 	}
@@ -49,6 +53,8 @@ namespace allure {
 	void TestLifecycleListenerBase::onTestEnd(const ITestMetadata& metadata,
 	                                          allure::model::Status status)
 	{
+		allure::service::AllocationTracker::Pause allocationPause;
+
 		// Delegate to existing handler with status
 		// Note: metadata is available but current handler doesn't use it
 		m_caseEndHandler->handleTestCaseEnd(status);
@@ -69,6 +75,8 @@ namespace allure {
 	                                          const std::string& statusMessage,
 	                                          const std::string& statusTrace)
 	{
+		allure::service::AllocationTracker::Pause allocationPause;
+
 		// Call the overloaded handler with failure details
 		m_caseEndHandler->handleTestCaseEnd(status, statusMessage, statusTrace);
 	}
@@ -0,0 +1,15 @@
+#pragma once
+
+
+namespace allure { namespace model {
+
+	// Each level keeps the reductions of the levels before it
+	enum class CaptureLevel
+	{
+		FULL = 0,
+		COALESCED_STEPS = 1,
+		STEPS_ON_FAILURE = 2,
+		ATTACHMENTS_ON_FAILURE = 3
+	};
+
+}} // namespace allure::model
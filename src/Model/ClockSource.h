@@ -0,0 +1,13 @@
+#pragma once
+
+
+namespace allure { namespace model {
+
+	enum class ClockSource
+	{
+		SYSTEM = 0,
+		MONOTONIC = 1,
+		MONOTONIC_COARSE = 2
+	};
+
+}} // namespace allure::model
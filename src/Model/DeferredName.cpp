@@ -0,0 +1,55 @@
+#include "DeferredName.h"
+
+#include <cstring>
+
+
+namespace allure { namespace model {
+
+	DeferredName::DeferredName()
+		:m_renderer(nullptr)
+		,m_size(0)
+		,m_data()
+	{
+	}
+
+	DeferredName::DeferredName(Renderer renderer)
+		:m_renderer(renderer)
+		,m_size(0)
+		,m_data()
+	{
+	}
+
+	bool DeferredName::isSet() const
+	{
+		return m_renderer != nullptr;
+	}
+
+	size_t DeferredName::getSize() const
+	{
+		return m_size;
+	}
+
+	void DeferredName::append(const void* data, size_t size)
+	{
+		std::memcpy(m_data.data() + m_size, data, size);
+		m_size += size;
+	}
+
+	std::string DeferredName::render() const
+	{
+		return m_renderer ? m_renderer(m_data.data(), m_size) : std::string();
+	}
+
+	bool operator== (const DeferredName& lhs, const DeferredName& rhs)
+	{
+		return (lhs.m_renderer == rhs.m_renderer) &&
+			   (lhs.m_size == rhs.m_size) &&
+			   (std::memcmp(lhs.m_data.data(), rhs.m_data.data(), lhs.m_size) == 0);
+	}
+
+	bool operator!= (const DeferredName& lhs, const DeferredName& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+}} // namespace allure::model
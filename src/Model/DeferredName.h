@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+
+namespace allure { namespace model {
+
+	/**
+	 * Name rendered when it is read.
+	 *
+	 * The bytes of the format arguments and of the format string are copied
+	 * into a fixed inline buffer, next to the function that formats them, so
+	 * building one never allocates. Names that are never read (steps dropped
+	 * from the report) are never formatted. Names with the same function and
+	 * bytes render the same, so they can be compared without rendering.
+	 */
+	class DeferredName
+	{
+	public:
+		static constexpr size_t CAPACITY = 64;
+		typedef std::string (*Renderer)(const unsigned char* data, size_t size);
+
+		DeferredName();
+		explicit DeferredName(Renderer);
+		DeferredName(const DeferredName&) = default;
+		virtual ~DeferredName() = default;
+
+		bool isSet() const;
+		size_t getSize() const;
+
+		// The caller checks that the data fits within CAPACITY
+		void append(const void* data, size_t size);
+		std::string render() const;
+
+		DeferredName& operator= (const DeferredName&) = default;
+		friend bool operator== (const DeferredName& lhs, const DeferredName& rhs);
+		friend bool operator!= (const DeferredName& lhs, const DeferredName& rhs);
+
+	private:
+		Renderer m_renderer;
+		size_t m_size;
+		std::array<unsigned char, CAPACITY> m_data;
+	};
+
+}} // namespace allure::model
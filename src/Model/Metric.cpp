@@ -0,0 +1,84 @@
+#include "Metric.h"
+
+#include <algorithm>
+
+
+namespace allure { namespace model {
+
+	Metric::Metric()
+		:m_name("")
+		,m_value(0)
+		,m_aggregation(Aggregation::SUM)
+	{
+	}
+
+	Metric::Metric(const std::string& name, int64_t value, Aggregation aggregation)
+		:m_name(name)
+		,m_value(value)
+		,m_aggregation(aggregation)
+	{
+	}
+
+	Metric::Metric(const Metric& other)
+		:m_name(other.m_name)
+		,m_value(other.m_value)
+		,m_aggregation(other.m_aggregation)
+	{
+	}
+
+	std::string Metric::getName() const
+	{
+		return m_name;
+	}
+
+	int64_t Metric::getValue() const
+	{
+		return m_value;
+	}
+
+	Metric::Aggregation Metric::getAggregation() const
+	{
+		return m_aggregation;
+	}
+
+	void Metric::setName(const std::string& name)
+	{
+		m_name = name;
+	}
+
+	void Metric::setValue(int64_t value)
+	{
+		m_value = value;
+	}
+
+	void Metric::setAggregation(Aggregation aggregation)
+	{
+		m_aggregation = aggregation;
+	}
+
+	void Metric::aggregate(int64_t value)
+	{
+		m_value = (m_aggregation == Aggregation::MAX) ? std::max(m_value, value) : (m_value + value);
+	}
+
+	Metric& Metric::operator= (const Metric& other)
+	{
+		m_name = other.m_name;
+		m_value = other.m_value;
+		m_aggregation = other.m_aggregation;
+		return *this;
+	}
+
+	bool operator== (const Metric& lhs, const Metric& rhs)
+	{
+		return (lhs.m_name == rhs.m_name) &&
+			   (lhs.m_value == rhs.m_value) &&
+			   (lhs.m_aggregation == rhs.m_aggregation);
+	}
+
+	bool operator!= (const Metric& lhs, const Metric& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+}} // namespace allure::model
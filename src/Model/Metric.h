@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+
+namespace allure { namespace model {
+
+	/**
+	 * A numeric measurement taken while a step ran (e.g. a performance counter).
+	 *
+	 * Unlike parameters, metrics do not prevent identical sibling steps from
+	 * being coalesced; they are aggregated into the merged step instead.
+	 */
+	class Metric
+	{
+	public:
+		enum class Aggregation
+		{
+			SUM = 0,
+			MAX = 1
+		};
+
+		Metric();
+		Metric(const std::string& name, int64_t value, Aggregation aggregation = Aggregation::SUM);
+		Metric(const Metric&);
+		virtual ~Metric() = default;
+
+		std::string getName() const;
+		int64_t getValue() const;
+		Aggregation getAggregation() const;
+
+		void setName(const std::string&);
+		void setValue(int64_t);
+		void setAggregation(Aggregation);
+
+		void aggregate(int64_t value);
+
+		virtual Metric& operator= (const Metric&);
+		friend bool operator== (const Metric& lhs, const Metric& rhs);
+		friend bool operator!= (const Metric& lhs, const Metric& rhs);
+
+	private:
+		std::string m_name;
+		int64_t m_value;
+		Aggregation m_aggregation;
+	};
+
+}} // namespace allure::model
@@ -1,11 +1,13 @@
 #include "Parameter.h"
 
+#include <fmt/format.h>
+
 
 namespace allure { namespace model {
 
 	Parameter::Parameter()
 		:m_name("")
-		,m_value("")
+		,m_value(std::string())
 		,m_excluded(false)
 		,m_mode("default")
 	{
@@ -25,10 +27,26 @@ namespace allure { namespace model {
 	}
 
 	std::string Parameter::getValue() const
+	{
+		if (const std::string* value = std::get_if<std::string>(&m_value))
+		{
+			return *value;
+		}
+
+		// Shortest text that reads back as the same value
+		return std::visit([](const auto& value) { return fmt::to_string(value); }, m_value);
+	}
+
+	const Parameter::Value& Parameter::getTypedValue() const
 	{
 		return m_value;
 	}
 
+	bool Parameter::isTyped() const
+	{
+		return !std::holds_alternative<std::string>(m_value);
+	}
+
 	bool Parameter::getExcluded() const
 	{
 		return m_excluded;
@@ -49,6 +67,11 @@ namespace allure { namespace model {
 		m_value = value;
 	}
 
+	void Parameter::setTypedValue(const Value& value)
+	{
+		m_value = value;
+	}
+
 	void Parameter::setExcluded(bool excluded)
 	{
 		m_excluded = excluded;
@@ -1,24 +1,41 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <variant>
 
 
 namespace allure { namespace model {
 
+	/**
+	 * Name/value pair of a test or step.
+	 *
+	 * Integer, floating point and boolean values keep their native type and
+	 * are only rendered as text when read with getValue(). The serializers
+	 * read every parameter, hidden and excluded ones included, so this only
+	 * saves the rendering of parameters that are never written (e.g. of steps
+	 * dropped from the report). Values of other types are formatted by the
+	 * API when they are added.
+	 */
 	class Parameter
 	{
 	public:
+		typedef std::variant<std::string, int64_t, uint64_t, double, bool> Value;
+
 		Parameter();
 		Parameter(const Parameter&);
 		virtual ~Parameter() = default;
 
 		std::string getName() const;
 		std::string getValue() const;
+		const Value& getTypedValue() const;
+		bool isTyped() const;
 		bool getExcluded() const;
 		std::string getMode() const;
 
 		void setName(const std::string&);
 		void setValue(const std::string&);
+		void setTypedValue(const Value&);
 		void setExcluded(bool);
 		void setMode(const std::string&);
 
@@ -28,7 +45,7 @@ namespace allure { namespace model {
 
 	private:
 		std::string m_name;
-		std::string m_value;
+		Value m_value;
 		bool m_excluded;
 		std::string m_mode;
 	};
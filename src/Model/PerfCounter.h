@@ -0,0 +1,17 @@
+#pragma once
+
+
+namespace allure { namespace model {
+
+	enum class PerfCounter
+	{
+		INSTRUCTIONS = 0,
+		CYCLES = 1,
+		CACHE_MISSES = 2,
+		BRANCH_MISSES = 3,
+		TASK_CLOCK = 4,
+		PAGE_FAULTS = 5,
+		CONTEXT_SWITCHES = 6
+	};
+
+}} // namespace allure::model
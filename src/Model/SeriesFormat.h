@@ -0,0 +1,12 @@
+#pragma once
+
+
+namespace allure { namespace model {
+
+	enum class SeriesFormat
+	{
+		CSV = 0,
+		JSON = 1
+	};
+
+}} // namespace allure::model
@@ -1,32 +1,49 @@
 #include "Step.h"
 
 #include "Stage.h"
+#include "StepNameRegistry.h"
 #include "Status.h"
 
+#include <algorithm>
+
 
 namespace allure { namespace model {
 
 	Step::Step()
 		:m_name("")
+		,m_deferredName()
+		,m_nameId(StepNameRegistry::NO_NAME)
 		,m_status(Status::UNKNOWN)
 		,m_stage(Stage::PENDING)
 		,m_start(0)
 		,m_stop(0)
+		,m_startNs(0)
+		,m_durationNs(0)
+		,m_statusMessage("")
 		,m_steps()
 		,m_parameters()
 		,m_attachments()
+		,m_metrics()
+		,m_statistics()
 	{
 	}
 
 	Step::Step(const Step& other)
 		:m_name(other.m_name)
+		,m_deferredName(other.m_deferredName)
+		,m_nameId(other.m_nameId)
 		,m_status(other.m_status)
 		,m_stage(other.m_stage)
 		,m_start(other.m_start)
 		,m_stop(other.m_stop)
+		,m_startNs(other.m_startNs)
+		,m_durationNs(other.m_durationNs)
+		,m_statusMessage(other.m_statusMessage)
 		,m_steps()
 		,m_parameters(other.m_parameters)
 		,m_attachments(other.m_attachments)
+		,m_metrics(other.m_metrics)
+		,m_statistics(other.m_statistics)
 	{
 		for (const auto& step : other.m_steps)
 		{
@@ -36,6 +53,14 @@ namespace allure { namespace model {
 
 	std::string Step::getName() const
 	{
+		if (m_deferredName.isSet())
+		{
+			return m_deferredName.render();
+		}
+		if (m_nameId != StepNameRegistry::NO_NAME)
+		{
+			return StepNameRegistry::instance().getName(m_nameId);
+		}
 		return m_name;
 	}
 
@@ -59,9 +84,64 @@ namespace allure { namespace model {
 		return m_stop;
 	}
 
+	int64_t Step::getStartNs() const
+	{
+		return m_startNs;
+	}
+
+	uint64_t Step::getDurationNs() const
+	{
+		return m_durationNs;
+	}
+
+	std::string Step::getStatusMessage() const
+	{
+		return m_statusMessage;
+	}
+
 	void Step::setName(const std::string& name)
 	{
 		m_name = name;
+		m_deferredName = DeferredName();
+		m_nameId = StepNameRegistry::NO_NAME;
+	}
+
+	void Step::setDeferredName(const DeferredName& name)
+	{
+		m_name = "";
+		m_deferredName = name;
+		m_nameId = StepNameRegistry::NO_NAME;
+	}
+
+	bool Step::hasDeferredName() const
+	{
+		return m_deferredName.isSet();
+	}
+
+	const DeferredName& Step::getDeferredName() const
+	{
+		return m_deferredName;
+	}
+
+	void Step::renderDeferredName()
+	{
+		if (m_deferredName.isSet())
+		{
+			m_name = m_deferredName.render();
+			m_deferredName = DeferredName();
+		}
+	}
+
+	void Step::setNameId(uint32_t nameId)
+	{
+		m_name = "";
+		m_deferredName = DeferredName();
+		m_nameId = nameId;
+	}
+
+	uint32_t Step::getNameId() const
+	{
+		return m_nameId;
 	}
 
 	void Step::setStatus(Status status)
@@ -84,6 +164,21 @@ namespace allure { namespace model {
 		m_stop = stop;
 	}
 
+	void Step::setStartNs(int64_t startNs)
+	{
+		m_startNs = startNs;
+	}
+
+	void Step::setDurationNs(uint64_t durationNs)
+	{
+		m_durationNs = durationNs;
+	}
+
+	void Step::setStatusMessage(const std::string& statusMessage)
+	{
+		m_statusMessage = statusMessage;
+	}
+
 	unsigned int Step::getStepCount() const
 	{
 		return (unsigned int) m_steps.size();
@@ -104,6 +199,16 @@ namespace allure { namespace model {
 		m_steps.push_back(std::move(step));
 	}
 
+	void Step::clearSteps()
+	{
+		m_steps.clear();
+	}
+
+	void Step::removeLastSteps(unsigned int count)
+	{
+		m_steps.erase(m_steps.end() - std::min<size_t>(count, m_steps.size()), m_steps.end());
+	}
+
 	const std::vector<Parameter>& Step::getParameters() const
 	{
 		return m_parameters;
@@ -124,15 +229,45 @@ namespace allure { namespace model {
 		m_attachments.push_back(attachment);
 	}
 
+	const std::vector<Metric>& Step::getMetrics() const
+	{
+		return m_metrics;
+	}
+
+	std::vector<Metric>& Step::getMetrics()
+	{
+		return m_metrics;
+	}
+
+	void Step::addMetric(const Metric& metric)
+	{
+		m_metrics.push_back(metric);
+	}
+
+	const StepStatistics& Step::getStatistics() const
+	{
+		return m_statistics;
+	}
+
+	StepStatistics& Step::getStatistics()
+	{
+		return m_statistics;
+	}
+
+	bool Step::isCoalesced() const
+	{
+		return m_statistics.getCount() > 0;
+	}
+
 	Step* Step::getRunningStep()
 	{
 		// If this step is running, check if any of its nested steps are also running
 		if (getStage() == Stage::RUNNING)
 		{
-			// Check nested steps first (depth-first search for the deepest running step)
-			for (auto& step : m_steps)
+			// Steps are strictly nested, so only the last nested step can still be running
+			if (!m_steps.empty())
 			{
-				Step* runningNestedStep = step->getRunningStep();
+				Step* runningNestedStep = m_steps.back()->getRunningStep();
 				if (runningNestedStep != nullptr)
 				{
 					return runningNestedStep;
@@ -149,10 +284,10 @@ namespace allure { namespace model {
 		// If this step is running, check if any of its nested steps are also running
 		if (getStage() == Stage::RUNNING)
 		{
-			// Check nested steps first (depth-first search for the deepest running step)
-			for (const auto& step : m_steps)
+			// Steps are strictly nested, so only the last nested step can still be running
+			if (!m_steps.empty())
 			{
-				const Step* runningNestedStep = step->getRunningStep();
+				const Step* runningNestedStep = m_steps.back()->getRunningStep();
 				if (runningNestedStep != nullptr)
 				{
 					return runningNestedStep;
@@ -167,10 +302,15 @@ namespace allure { namespace model {
 	Step& Step::operator= (const Step& other)
 	{
 		m_name = other.m_name;
+		m_deferredName = other.m_deferredName;
+		m_nameId = other.m_nameId;
 		m_status = other.m_status;
 		m_stage = other.m_stage;
 		m_start = other.m_start;
 		m_stop = other.m_stop;
+		m_startNs = other.m_startNs;
+		m_durationNs = other.m_durationNs;
+		m_statusMessage = other.m_statusMessage;
 
 		m_steps = std::vector< std::unique_ptr<Step> >();
 		for (const auto& step : other.m_steps)
@@ -180,20 +320,27 @@ namespace allure { namespace model {
 
 		m_parameters = other.m_parameters;
 		m_attachments = other.m_attachments;
+		m_metrics = other.m_metrics;
+		m_statistics = other.m_statistics;
 
 		return *this;
 	}
 
 	bool operator== (const Step& lhs, const Step& rhs)
 	{
-		if ((lhs.m_name != rhs.m_name) ||
+		if ((lhs.getName() != rhs.getName()) ||
 			(lhs.m_status != rhs.m_status) ||
 			(lhs.m_stage != rhs.m_stage) ||
 			(lhs.m_start != rhs.m_start) ||
 			(lhs.m_stop != rhs.m_stop) ||
+			(lhs.m_startNs != rhs.m_startNs) ||
+			(lhs.m_durationNs != rhs.m_durationNs) ||
+			(lhs.m_statusMessage != rhs.m_statusMessage) ||
 			(lhs.m_steps.size() != rhs.m_steps.size()) ||
 			(lhs.m_parameters != rhs.m_parameters) ||
-			(lhs.m_attachments != rhs.m_attachments))
+			(lhs.m_attachments != rhs.m_attachments) ||
+			(lhs.m_metrics != rhs.m_metrics) ||
+			(lhs.m_statistics != rhs.m_statistics))
 		{
 			return false;
 		}
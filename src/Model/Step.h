@@ -2,6 +2,9 @@
 
 #include "Parameter.h"
 #include "Attachment.h"
+#include "DeferredName.h"
+#include "Metric.h"
+#include "StepStatistics.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -28,17 +31,34 @@ namespace allure { namespace model {
 		Stage getStage() const;
 		time_t getStart() const;
 		time_t getStop() const;
+		int64_t getStartNs() const;
+		uint64_t getDurationNs() const;
+		std::string getStatusMessage() const;
 
 		void setName(const std::string&);
+		// Replaces the name by one rendered by each getName(), until renderDeferredName()
+		void setDeferredName(const DeferredName&);
+		bool hasDeferredName() const;
+		const DeferredName& getDeferredName() const;
+		// Stores the rendered deferred name; only for the owner of the step, readers may run concurrently otherwise
+		void renderDeferredName();
+		// Replaces the name by one of the StepNameRegistry
+		void setNameId(uint32_t);
+		uint32_t getNameId() const;
 		void setStatus(Status);
 		void setStage(Stage);
 		void setStart(time_t);
 		void setStop(time_t);
+		void setStartNs(int64_t);
+		void setDurationNs(uint64_t);
+		void setStatusMessage(const std::string&);
 
 		unsigned int getStepCount() const;
 		const Step* getStep(unsigned int index) const;
 		Step* getStep(unsigned int index);
 		void addStep(std::unique_ptr<Step>);
+		void clearSteps();
+		void removeLastSteps(unsigned int count);
 
 		const std::vector<Parameter>& getParameters() const;
 		void addParameter(const Parameter&);
@@ -46,6 +66,16 @@ namespace allure { namespace model {
 		const std::vector<Attachment>& getAttachments() const;
 		void addAttachment(const Attachment&);
 
+		// Measurements taken while the step ran, reported as excluded parameters
+		const std::vector<Metric>& getMetrics() const;
+		std::vector<Metric>& getMetrics();
+		void addMetric(const Metric&);
+
+		// Durations of the sibling steps merged into this one (empty if not coalesced)
+		const StepStatistics& getStatistics() const;
+		StepStatistics& getStatistics();
+		bool isCoalesced() const;
+
 		// Helper method to find the deepest running step (for nesting)
 		Step* getRunningStep();
 		const Step* getRunningStep() const;
@@ -56,13 +86,20 @@ namespace allure { namespace model {
 
 	private:
 		std::string m_name;
+		DeferredName m_deferredName;
+		uint32_t m_nameId;
 		Status m_status;
 		Stage m_stage;
 		time_t m_start;
 		time_t m_stop;
+		int64_t m_startNs;
+		uint64_t m_durationNs;
+		std::string m_statusMessage;
 		std::vector< std::unique_ptr<Step> > m_steps;
 		std::vector<Parameter> m_parameters;
 		std::vector<Attachment> m_attachments;
+		std::vector<Metric> m_metrics;
+		StepStatistics m_statistics;
 	};
 
 }} // namespace allure::model
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Status.h"
+
+#include <cstdint>
+
+
+namespace allure { namespace model {
+
+	/**
+	 * Time budget of a step, checked against its duration when the step ends.
+	 *
+	 * A step that takes longer than budgetNs gets exceededStatus (unless it
+	 * already failed) and, with failTest, makes its test case fail too.
+	 * A budget of 0 means no budget.
+	 */
+	struct StepBudget
+	{
+		uint64_t budgetNs = 0;
+		Status exceededStatus = Status::FAILED;
+		bool failTest = false;
+	};
+
+}} // namespace allure::model
@@ -0,0 +1,13 @@
+#pragma once
+
+
+namespace allure { namespace model {
+
+	enum class StepDetailPolicy
+	{
+		FULL = 0,
+		TOP_LEVEL_ON_PASS = 1,
+		SUMMARY_ON_PASS = 2
+	};
+
+}} // namespace allure::model
@@ -0,0 +1,66 @@
+#include "StepNameRegistry.h"
+
+
+namespace allure { namespace model {
+
+	StepNameRegistry::StepNameRegistry()
+		:m_mutex()
+		,m_chunks()
+		,m_nameCount(0)
+		,m_ids()
+	{
+	}
+
+	uint32_t StepNameRegistry::registerName(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_ids.find(name);
+		if (it != m_ids.end())
+		{
+			return it->second;
+		}
+
+		size_t index = m_nameCount.load(std::memory_order_relaxed);
+		if (index >= MAX_NAMES)
+		{
+			return NO_NAME;
+		}
+
+		std::unique_ptr<std::string[]>& chunk = m_chunks[index / CHUNK_SIZE];
+		if (!chunk)
+		{
+			chunk.reset(new std::string[CHUNK_SIZE]);
+		}
+		chunk[index % CHUNK_SIZE] = name;
+
+		// Readers of the new id see the name stored above
+		m_nameCount.store(index + 1, std::memory_order_release);
+		uint32_t id = static_cast<uint32_t>(index + 1);
+		m_ids.emplace(name, id);
+		return id;
+	}
+
+	const std::string& StepNameRegistry::getName(uint32_t id) const
+	{
+		if ((id == NO_NAME) || (id > m_nameCount.load(std::memory_order_acquire)))
+		{
+			static const std::string emptyName;
+			return emptyName;
+		}
+
+		size_t index = id - 1;
+		return m_chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+	}
+
+	size_t StepNameRegistry::getNameCount() const
+	{
+		return m_nameCount.load(std::memory_order_acquire);
+	}
+
+	StepNameRegistry& StepNameRegistry::instance()
+	{
+		static StepNameRegistry registry;
+		return registry;
+	}
+
+}} // namespace allure::model
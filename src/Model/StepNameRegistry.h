@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+
+namespace allure { namespace model {
+
+	/**
+	 * Process-wide table of interned step names.
+	 *
+	 * Names of static steps (ALLURE_STEP) are registered once per call site
+	 * and then referred to by a 32-bit id, so starting such a step does not
+	 * copy its name into the model. Registering the same name twice returns
+	 * the same id, so ids of equal names compare equal.
+	 *
+	 * Only registering locks: names are stored in fixed chunks that never
+	 * move, and the count of names is published once a name is in place, so
+	 * getName() reads without locking. Up to MAX_NAMES names can be registered,
+	 * further ones get NO_NAME.
+	 */
+	class StepNameRegistry
+	{
+	public:
+		static constexpr uint32_t NO_NAME = 0;
+		static constexpr size_t CHUNK_SIZE = 1024;
+		static constexpr size_t MAX_CHUNKS = 1024;
+		static constexpr size_t MAX_NAMES = CHUNK_SIZE * MAX_CHUNKS;
+
+		StepNameRegistry();
+		virtual ~StepNameRegistry() = default;
+
+		uint32_t registerName(const std::string&);
+		const std::string& getName(uint32_t id) const;
+		size_t getNameCount() const;
+
+		static StepNameRegistry& instance();
+
+	private:
+		std::mutex m_mutex;
+		std::array<std::unique_ptr<std::string[]>, MAX_CHUNKS> m_chunks;
+		std::atomic<size_t> m_nameCount;
+		std::unordered_map<std::string, uint32_t> m_ids;
+	};
+
+}} // namespace allure::model
@@ -0,0 +1,113 @@
+#include "StepStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace allure { namespace model {
+
+	StepStatistics::StepStatistics()
+		:m_count(0)
+		,m_total(0)
+		,m_min(0)
+		,m_max(0)
+		,m_samples()
+		,m_randomState(0x9E3779B97F4A7C15ULL)
+	{
+	}
+
+	StepStatistics::StepStatistics(const StepStatistics& other)
+		:m_count(other.m_count)
+		,m_total(other.m_total)
+		,m_min(other.m_min)
+		,m_max(other.m_max)
+		,m_samples(other.m_samples)
+		,m_randomState(other.m_randomState)
+	{
+	}
+
+	uint64_t StepStatistics::getCount() const
+	{
+		return m_count;
+	}
+
+	uint64_t StepStatistics::getTotal() const
+	{
+		return m_total;
+	}
+
+	uint64_t StepStatistics::getMin() const
+	{
+		return m_min;
+	}
+
+	uint64_t StepStatistics::getMax() const
+	{
+		return m_max;
+	}
+
+	uint64_t StepStatistics::getPercentile(double percentile) const
+	{
+		if (m_samples.empty())
+		{
+			return 0;
+		}
+
+		std::vector<uint64_t> sortedSamples = m_samples;
+		std::sort(sortedSamples.begin(), sortedSamples.end());
+		double rank = std::ceil((percentile / 100.0) * sortedSamples.size());
+		size_t index = (rank < 1.0) ? 0 : static_cast<size_t>(rank) - 1;
+		return sortedSamples[std::min(index, sortedSamples.size() - 1)];
+	}
+
+	void StepStatistics::addDuration(uint64_t duration)
+	{
+		m_min = (m_count == 0) ? duration : std::min(m_min, duration);
+		m_max = (m_count == 0) ? duration : std::max(m_max, duration);
+		m_total += duration;
+		m_count++;
+
+		// Reservoir sampling (algorithm R) with a xorshift generator
+		if (m_samples.size() < MAX_SAMPLES)
+		{
+			m_samples.push_back(duration);
+		}
+		else
+		{
+			m_randomState ^= m_randomState << 13;
+			m_randomState ^= m_randomState >> 7;
+			m_randomState ^= m_randomState << 17;
+			uint64_t slot = m_randomState % m_count;
+			if (slot < MAX_SAMPLES)
+			{
+				m_samples[slot] = duration;
+			}
+		}
+	}
+
+	StepStatistics& StepStatistics::operator= (const StepStatistics& other)
+	{
+		m_count = other.m_count;
+		m_total = other.m_total;
+		m_min = other.m_min;
+		m_max = other.m_max;
+		m_samples = other.m_samples;
+		m_randomState = other.m_randomState;
+		return *this;
+	}
+
+	bool operator== (const StepStatistics& lhs, const StepStatistics& rhs)
+	{
+		return (lhs.m_count == rhs.m_count) &&
+			   (lhs.m_total == rhs.m_total) &&
+			   (lhs.m_min == rhs.m_min) &&
+			   (lhs.m_max == rhs.m_max) &&
+			   (lhs.m_samples == rhs.m_samples);
+	}
+
+	bool operator!= (const StepStatistics& lhs, const StepStatistics& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+}} // namespace allure::model
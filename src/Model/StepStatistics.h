@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace allure { namespace model {
+
+	/**
+	 * Aggregated durations, in nanoseconds, of a run of coalesced sibling steps.
+	 *
+	 * Percentiles are estimated from a bounded reservoir sample, so memory
+	 * stays constant regardless of how many steps are merged.
+	 */
+	class StepStatistics
+	{
+	public:
+		static constexpr size_t MAX_SAMPLES = 1024;
+
+		StepStatistics();
+		StepStatistics(const StepStatistics&);
+		virtual ~StepStatistics() = default;
+
+		uint64_t getCount() const;
+		uint64_t getTotal() const;
+		uint64_t getMin() const;
+		uint64_t getMax() const;
+		uint64_t getPercentile(double percentile) const;
+
+		void addDuration(uint64_t);
+
+		virtual StepStatistics& operator= (const StepStatistics&);
+		friend bool operator== (const StepStatistics& lhs, const StepStatistics& rhs);
+		friend bool operator!= (const StepStatistics& lhs, const StepStatistics& rhs);
+
+	private:
+		uint64_t m_count;
+		uint64_t m_total;
+		uint64_t m_min;
+		uint64_t m_max;
+		std::vector<uint64_t> m_samples;
+		uint64_t m_randomState;
+	};
+
+}} // namespace allure::model
@@ -1,5 +1,7 @@
 #include "TestCase.h"
 
+#include <algorithm>
+
 
 namespace allure { namespace model {
 
@@ -15,11 +17,19 @@ namespace allure { namespace model {
 		,m_stage(Stage::PENDING)
 		,m_start(0)
 		,m_stop(0)
+		,m_startNs(0)
+		,m_durationNs(0)
 		,m_statusMessage("")
 		,m_statusTrace("")
 		,m_statusKnown(false)
 		,m_statusMuted(false)
 		,m_statusFlaky(false)
+		,m_recordedStepCount(0)
+		,m_droppedStepCount(0)
+		,m_openDroppedStepCount(0)
+		,m_budgetViolations()
+		,m_budgetViolationStatus(Status::UNKNOWN)
+		,m_deferredAttachments()
 		,m_steps()
 		,m_parameters()
 		,m_labels()
@@ -40,11 +50,19 @@ namespace allure { namespace model {
 		,m_stage(other.m_stage)
 		,m_start(other.m_start)
 		,m_stop(other.m_stop)
+		,m_startNs(other.m_startNs)
+		,m_durationNs(other.m_durationNs)
 		,m_statusMessage(other.m_statusMessage)
 		,m_statusTrace(other.m_statusTrace)
 		,m_statusKnown(other.m_statusKnown)
 		,m_statusMuted(other.m_statusMuted)
 		,m_statusFlaky(other.m_statusFlaky)
+		,m_recordedStepCount(other.m_recordedStepCount)
+		,m_droppedStepCount(other.m_droppedStepCount)
+		,m_openDroppedStepCount(other.m_openDroppedStepCount)
+		,m_budgetViolations(other.m_budgetViolations)
+		,m_budgetViolationStatus(other.m_budgetViolationStatus)
+		,m_deferredAttachments(other.m_deferredAttachments)
 		,m_steps()
 		,m_parameters(other.m_parameters)
 		,m_labels(other.m_labels)
@@ -112,6 +130,16 @@ namespace allure { namespace model {
 		return m_stop;
 	}
 
+	int64_t TestCase::getStartNs() const
+	{
+		return m_startNs;
+	}
+
+	uint64_t TestCase::getDurationNs() const
+	{
+		return m_durationNs;
+	}
+
 	void TestCase::setUUID(const std::string& uuid)
 	{
 		m_uuid = uuid;
@@ -167,6 +195,16 @@ namespace allure { namespace model {
 		m_stop = stop;
 	}
 
+	void TestCase::setStartNs(int64_t startNs)
+	{
+		m_startNs = startNs;
+	}
+
+	void TestCase::setDurationNs(uint64_t durationNs)
+	{
+		m_durationNs = durationNs;
+	}
+
 	unsigned int TestCase::getStepCount() const
 	{
 		return (unsigned int) m_steps.size();
@@ -189,30 +227,72 @@ namespace allure { namespace model {
 
 	Step* TestCase::getRunningStep()
 	{
-		// Search through all top-level steps for a running step
-		for (auto& step : m_steps)
+		// Steps are strictly nested, so only the last top-level step can still be running
+		if (m_steps.empty())
 		{
-			Step* runningStep = step->getRunningStep();
-			if (runningStep != nullptr)
-			{
-				return runningStep;
-			}
+			return nullptr;
 		}
-		return nullptr;
+		return m_steps.back()->getRunningStep();
 	}
 
 	const Step* TestCase::getRunningStep() const
 	{
-		// Search through all top-level steps for a running step
-		for (const auto& step : m_steps)
+		// Steps are strictly nested, so only the last top-level step can still be running
+		if (m_steps.empty())
 		{
-			const Step* runningStep = step->getRunningStep();
-			if (runningStep != nullptr)
-			{
-				return runningStep;
-			}
+			return nullptr;
 		}
-		return nullptr;
+		return m_steps.back()->getRunningStep();
+	}
+
+	unsigned int TestCase::getRecordedStepCount() const
+	{
+		return m_recordedStepCount;
+	}
+
+	unsigned int TestCase::getDroppedStepCount() const
+	{
+		return m_droppedStepCount;
+	}
+
+	unsigned int TestCase::getOpenDroppedStepCount() const
+	{
+		return m_openDroppedStepCount;
+	}
+
+	void TestCase::setRecordedStepCount(unsigned int recordedStepCount)
+	{
+		m_recordedStepCount = recordedStepCount;
+	}
+
+	void TestCase::setDroppedStepCount(unsigned int droppedStepCount)
+	{
+		m_droppedStepCount = droppedStepCount;
+	}
+
+	void TestCase::setOpenDroppedStepCount(unsigned int openDroppedStepCount)
+	{
+		m_openDroppedStepCount = openDroppedStepCount;
+	}
+
+	const std::vector<std::string>& TestCase::getBudgetViolations() const
+	{
+		return m_budgetViolations;
+	}
+
+	Status TestCase::getBudgetViolationStatus() const
+	{
+		return m_budgetViolationStatus;
+	}
+
+	void TestCase::addBudgetViolation(Status status, const std::string& message)
+	{
+		// The first violation decides the status of the test
+		if (m_budgetViolations.empty())
+		{
+			m_budgetViolationStatus = status;
+		}
+		m_budgetViolations.push_back(message);
 	}
 
 	const std::vector<Parameter>& TestCase::getParameters() const
@@ -255,11 +335,38 @@ namespace allure { namespace model {
 		m_attachments.push_back(attachment);
 	}
 
+	void TestCase::removeAttachment(const std::string& source)
+	{
+		m_attachments.erase(std::remove_if(m_attachments.begin(), m_attachments.end(),
+										   [&source](const Attachment& attachment) { return attachment.getSource() == source; }),
+							m_attachments.end());
+	}
+
+	const std::map<std::string, std::string>& TestCase::getDeferredAttachments() const
+	{
+		return m_deferredAttachments;
+	}
+
+	void TestCase::addDeferredAttachment(const std::string& source, const std::string& content)
+	{
+		m_deferredAttachments[source] = content;
+	}
+
+	void TestCase::clearDeferredAttachments()
+	{
+		m_deferredAttachments.clear();
+	}
+
 	void TestCase::clearSteps()
 	{
 		m_steps.clear();
 	}
 
+	void TestCase::removeLastSteps(unsigned int count)
+	{
+		m_steps.erase(m_steps.end() - std::min<size_t>(count, m_steps.size()), m_steps.end());
+	}
+
 	void TestCase::clearParameters()
 	{
 		m_parameters.clear();
@@ -293,11 +400,19 @@ namespace allure { namespace model {
 		m_stage = other.m_stage;
 		m_start = other.m_start;
 		m_stop = other.m_stop;
+		m_startNs = other.m_startNs;
+		m_durationNs = other.m_durationNs;
 		m_statusMessage = other.m_statusMessage;
 		m_statusTrace = other.m_statusTrace;
 		m_statusKnown = other.m_statusKnown;
 		m_statusMuted = other.m_statusMuted;
 		m_statusFlaky = other.m_statusFlaky;
+		m_recordedStepCount = other.m_recordedStepCount;
+		m_droppedStepCount = other.m_droppedStepCount;
+		m_openDroppedStepCount = other.m_openDroppedStepCount;
+		m_budgetViolations = other.m_budgetViolations;
+		m_budgetViolationStatus = other.m_budgetViolationStatus;
+		m_deferredAttachments = other.m_deferredAttachments;
 
 		m_steps = std::vector< std::unique_ptr<Step> >();
 		for (const auto& step : other.m_steps)
@@ -326,6 +441,8 @@ namespace allure { namespace model {
 			(lhs.m_stage != rhs.m_stage) ||
 			(lhs.m_start != rhs.m_start) ||
 			(lhs.m_stop != rhs.m_stop) ||
+			(lhs.m_startNs != rhs.m_startNs) ||
+			(lhs.m_durationNs != rhs.m_durationNs) ||
 			(lhs.m_statusMessage != rhs.m_statusMessage) ||
 			(lhs.m_statusTrace != rhs.m_statusTrace) ||
 			(lhs.m_statusKnown != rhs.m_statusKnown) ||
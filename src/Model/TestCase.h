@@ -8,6 +8,7 @@
 #include "Link.h"
 #include "Attachment.h"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,6 +34,8 @@ namespace allure { namespace model {
 		Stage getStage() const;
 		time_t getStart() const;
 		time_t getStop() const;
+		int64_t getStartNs() const;
+		uint64_t getDurationNs() const;
 		std::string getStatusMessage() const;
 		std::string getStatusTrace() const;
 		bool getStatusKnown() const;
@@ -50,6 +53,8 @@ namespace allure { namespace model {
 		void setStage(Stage);
 		void setStart(time_t);
 		void setStop(time_t);
+		void setStartNs(int64_t);
+		void setDurationNs(uint64_t);
 		void setStatusMessage(const std::string&);
 		void setStatusTrace(const std::string&);
 		void setStatusKnown(bool);
@@ -65,6 +70,19 @@ namespace allure { namespace model {
 	Step* getRunningStep();
 	const Step* getRunningStep() const;
 
+		// Step bookkeeping used to enforce the per-test step limits
+		unsigned int getRecordedStepCount() const;
+		unsigned int getDroppedStepCount() const;
+		unsigned int getOpenDroppedStepCount() const;
+		void setRecordedStepCount(unsigned int);
+		void setDroppedStepCount(unsigned int);
+		void setOpenDroppedStepCount(unsigned int);
+
+		// Steps that exceeded a time budget meant to fail the whole test
+		const std::vector<std::string>& getBudgetViolations() const;
+		Status getBudgetViolationStatus() const;
+		void addBudgetViolation(Status, const std::string& message);
+
 		const std::vector<Parameter>& getParameters() const;
 		void addParameter(const Parameter&);
 
@@ -76,9 +94,16 @@ namespace allure { namespace model {
 
 		const std::vector<Attachment>& getAttachments() const;
 		void addAttachment(const Attachment&);
+		void removeAttachment(const std::string& source);
+
+		// Attachment contents held back until the test ends, to be written only if it fails
+		const std::map<std::string, std::string>& getDeferredAttachments() const;
+		void addDeferredAttachment(const std::string& source, const std::string& content);
+		void clearDeferredAttachments();
 
 		// Clear methods to free memory after persisting to JSON
 		void clearSteps();
+		void removeLastSteps(unsigned int count);
 		void clearParameters();
 		void clearLabels();
 		void clearLinks();
@@ -100,11 +125,19 @@ namespace allure { namespace model {
 		Stage m_stage;
 		time_t m_start;
 		time_t m_stop;
+		int64_t m_startNs;
+		uint64_t m_durationNs;
 		std::string m_statusMessage;
 		std::string m_statusTrace;
 		bool m_statusKnown;
 		bool m_statusMuted;
 		bool m_statusFlaky;
+		unsigned int m_recordedStepCount;
+		unsigned int m_droppedStepCount;
+		unsigned int m_openDroppedStepCount;
+		std::vector<std::string> m_budgetViolations;
+		Status m_budgetViolationStatus;
+		std::map<std::string, std::string> m_deferredAttachments;
 
 		std::vector< std::unique_ptr<Step> > m_steps;
 		std::vector<Parameter> m_parameters;
@@ -11,6 +11,13 @@ namespace allure { namespace model {
 		,m_executorBuildName("")
 		,m_frameworkName("unknown")
 		,m_format(Format::DEFAULT)
+		,m_stepDetailPolicy(StepDetailPolicy::FULL)
+		,m_stepCoalescingThreshold(0)
+		,m_maxStepsPerTest(10000)
+		,m_maxStepDepth(64)
+		,m_maxStatusDetailBytes(64 * 1024)
+		,m_clockSource(ClockSource::SYSTEM)
+		,m_timelineScale(1)
 		,m_runningTestSuite(nullptr)
 		,m_runningTestCase(nullptr)
 	{
@@ -24,6 +31,13 @@ namespace allure { namespace model {
 		,m_executorBuildName(other.m_executorBuildName)
 		,m_frameworkName(other.m_frameworkName)
 		,m_format(other.m_format)
+		,m_stepDetailPolicy(other.m_stepDetailPolicy)
+		,m_stepCoalescingThreshold(other.m_stepCoalescingThreshold)
+		,m_maxStepsPerTest(other.m_maxStepsPerTest)
+		,m_maxStepDepth(other.m_maxStepDepth)
+		,m_maxStatusDetailBytes(other.m_maxStatusDetailBytes)
+		,m_clockSource(other.m_clockSource)
+		,m_timelineScale(other.m_timelineScale)
 		,m_testSuites(other.m_testSuites)
 		,m_runningTestSuite(nullptr)
 		,m_runningTestCase(nullptr)
@@ -100,6 +114,76 @@ namespace allure { namespace model {
 		m_format = format;
 	}
 
+	StepDetailPolicy TestProgram::getStepDetailPolicy() const
+	{
+		return m_stepDetailPolicy;
+	}
+
+	void TestProgram::setStepDetailPolicy(StepDetailPolicy stepDetailPolicy)
+	{
+		m_stepDetailPolicy = stepDetailPolicy;
+	}
+
+	unsigned int TestProgram::getStepCoalescingThreshold() const
+	{
+		return m_stepCoalescingThreshold;
+	}
+
+	void TestProgram::setStepCoalescingThreshold(unsigned int stepCoalescingThreshold)
+	{
+		m_stepCoalescingThreshold = stepCoalescingThreshold;
+	}
+
+	unsigned int TestProgram::getMaxStepsPerTest() const
+	{
+		return m_maxStepsPerTest;
+	}
+
+	void TestProgram::setMaxStepsPerTest(unsigned int maxStepsPerTest)
+	{
+		m_maxStepsPerTest = maxStepsPerTest;
+	}
+
+	unsigned int TestProgram::getMaxStepDepth() const
+	{
+		return m_maxStepDepth;
+	}
+
+	void TestProgram::setMaxStepDepth(unsigned int maxStepDepth)
+	{
+		m_maxStepDepth = maxStepDepth;
+	}
+
+	size_t TestProgram::getMaxStatusDetailBytes() const
+	{
+		return m_maxStatusDetailBytes;
+	}
+
+	void TestProgram::setMaxStatusDetailBytes(size_t maxStatusDetailBytes)
+	{
+		m_maxStatusDetailBytes = maxStatusDetailBytes;
+	}
+
+	ClockSource TestProgram::getClockSource() const
+	{
+		return m_clockSource;
+	}
+
+	void TestProgram::setClockSource(ClockSource clockSource)
+	{
+		m_clockSource = clockSource;
+	}
+
+	unsigned int TestProgram::getTimelineScale() const
+	{
+		return m_timelineScale;
+	}
+
+	void TestProgram::setTimelineScale(unsigned int timelineScale)
+	{
+		m_timelineScale = timelineScale;
+	}
+
 	size_t TestProgram::getTestSuitesCount() const
 	{
 		return m_testSuites.size();
@@ -164,6 +248,13 @@ namespace allure { namespace model {
 		m_executorBuildName = other.m_executorBuildName;
 		m_frameworkName = other.m_frameworkName;
 		m_format = other.m_format;
+		m_stepDetailPolicy = other.m_stepDetailPolicy;
+		m_stepCoalescingThreshold = other.m_stepCoalescingThreshold;
+		m_maxStepsPerTest = other.m_maxStepsPerTest;
+		m_maxStepDepth = other.m_maxStepDepth;
+		m_maxStatusDetailBytes = other.m_maxStatusDetailBytes;
+		m_clockSource = other.m_clockSource;
+		m_timelineScale = other.m_timelineScale;
 		m_testSuites = other.m_testSuites;
 		return *this;
 	}
@@ -177,7 +268,14 @@ namespace allure { namespace model {
 			   (lhs.m_executorBuildName == rhs.m_executorBuildName) &&
 			   (lhs.m_frameworkName == rhs.m_frameworkName) &&
 			   (lhs.m_testSuites == rhs.m_testSuites) &&
-			   (lhs.m_format == rhs.m_format);
+			   (lhs.m_format == rhs.m_format) &&
+			   (lhs.m_stepDetailPolicy == rhs.m_stepDetailPolicy) &&
+			   (lhs.m_stepCoalescingThreshold == rhs.m_stepCoalescingThreshold) &&
+			   (lhs.m_maxStepsPerTest == rhs.m_maxStepsPerTest) &&
+			   (lhs.m_maxStepDepth == rhs.m_maxStepDepth) &&
+			   (lhs.m_maxStatusDetailBytes == rhs.m_maxStatusDetailBytes) &&
+			   (lhs.m_clockSource == rhs.m_clockSource) &&
+			   (lhs.m_timelineScale == rhs.m_timelineScale);
 	}
 
 	bool operator!= (const TestProgram& lhs, const TestProgram& rhs)
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "ClockSource.h"
 #include "Format.h"
+#include "StepDetailPolicy.h"
 #include "TestSuite.h"
 
 
@@ -34,6 +36,27 @@ namespace allure { namespace model {
 		Format getFormat() const;
 		void setFormat(Format);
 
+		StepDetailPolicy getStepDetailPolicy() const;
+		void setStepDetailPolicy(StepDetailPolicy);
+
+		unsigned int getStepCoalescingThreshold() const;
+		void setStepCoalescingThreshold(unsigned int);
+
+		unsigned int getMaxStepsPerTest() const;
+		void setMaxStepsPerTest(unsigned int);
+
+		unsigned int getMaxStepDepth() const;
+		void setMaxStepDepth(unsigned int);
+
+		size_t getMaxStatusDetailBytes() const;
+		void setMaxStatusDetailBytes(size_t);
+
+		ClockSource getClockSource() const;
+		void setClockSource(ClockSource);
+
+		unsigned int getTimelineScale() const;
+		void setTimelineScale(unsigned int);
+
 		size_t getTestSuitesCount() const;
 		const TestSuite& getTestSuite(unsigned int index) const;
 		TestSuite& getTestSuite(unsigned int index);
@@ -61,6 +84,13 @@ namespace allure { namespace model {
 		std::string m_executorBuildName;
 		std::string m_frameworkName;
 		Format m_format;
+		StepDetailPolicy m_stepDetailPolicy;
+		unsigned int m_stepCoalescingThreshold;
+		unsigned int m_maxStepsPerTest;
+		unsigned int m_maxStepDepth;
+		size_t m_maxStatusDetailBytes;
+		ClockSource m_clockSource;
+		unsigned int m_timelineScale;
 		std::vector<TestSuite> m_testSuites;
 
 		// Cache pointers to currently running test suite and test case for performance
@@ -14,6 +14,7 @@ namespace allure { namespace model {
 		,m_stage(Stage::PENDING)
 		,m_start(0)
 		,m_stop(0)
+		,m_startNs(0)
 		,m_format(Format::DEFAULT)
 		,m_labels()
 		,m_links()
@@ -32,6 +33,7 @@ namespace allure { namespace model {
 		,m_stage(other.m_stage)
 		,m_start(other.m_start)
 		,m_stop(other.m_stop)
+		,m_startNs(other.m_startNs)
 		,m_format(other.m_format)
 		,m_labels(other.m_labels)
 		,m_links(other.m_links)
@@ -89,6 +91,11 @@ namespace allure { namespace model {
 		return m_stop;
 	}
 
+	int64_t TestSuite::getStartNs() const
+	{
+		return m_startNs;
+	}
+
 	Format TestSuite::getFormat() const
 	{
 		return m_format;
@@ -144,6 +151,11 @@ namespace allure { namespace model {
 		m_stop = stop;
 	}
 
+	void TestSuite::setStartNs(int64_t startNs)
+	{
+		m_startNs = startNs;
+	}
+
 	void TestSuite::setFormat(Format format)
 	{
 		m_format = format;
@@ -222,6 +234,7 @@ namespace allure { namespace model {
 		m_stage = other.m_stage;
 		m_start = other.m_start;
 		m_stop = other.m_stop;
+		m_startNs = other.m_startNs;
 
 		m_labels = other.m_labels;
 		m_links = other.m_links;
@@ -242,6 +255,7 @@ namespace allure { namespace model {
 			   (lhs.m_stage == rhs.m_stage) &&
 			   (lhs.m_start == rhs.m_start) &&
 			   (lhs.m_stop == rhs.m_stop) &&
+			   (lhs.m_startNs == rhs.m_startNs) &&
 			   (lhs.m_labels == rhs.m_labels) &&
 			   (lhs.m_links == rhs.m_links) &&
 			   (lhs.m_testCases == rhs.m_testCases);
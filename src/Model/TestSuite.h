@@ -27,6 +27,7 @@ namespace allure { namespace model {
 		Stage getStage() const;
 		time_t getStart() const;
 		time_t getStop() const;
+		int64_t getStartNs() const;
 		Format getFormat() const;
 
 		void setUUID(const std::string&);
@@ -39,6 +40,7 @@ namespace allure { namespace model {
 		void setStage(Stage);
 		void setStart(time_t);
 		void setStop(time_t);
+		void setStartNs(int64_t);
 		void setFormat(Format);
 
 		const std::vector<Label>& getLabels() const;
@@ -68,6 +70,7 @@ namespace allure { namespace model {
 		Stage m_stage;
 		time_t m_start;
 		time_t m_stop;
+		int64_t m_startNs;
 		Format m_format;
 
 		std::vector<Label> m_labels;
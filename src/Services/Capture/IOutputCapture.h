@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+namespace allure { namespace service {
+
+	class IOutputCapture
+	{
+	public:
+		virtual ~IOutputCapture() = default;
+
+		virtual bool isEnabled() const = 0;
+		virtual void setEnabled(bool) = 0;
+
+		virtual bool isOnlyOnFailure() const = 0;
+		virtual void setOnlyOnFailure(bool) = 0;
+
+		virtual bool isTee() const = 0;
+		virtual void setTee(bool) = 0;
+
+		virtual size_t getMemoryLimit() const = 0;
+		virtual void setMemoryLimit(size_t) = 0;
+
+		virtual void beginTest() = 0;
+		virtual void endTest() = 0;
+		virtual void shutdown() = 0;
+
+		virtual bool isEmpty() const = 0;
+		virtual uint64_t getCapturedBytes() const = 0;
+		virtual std::string getMemoryContent() const = 0;
+		virtual void appendSpilledContentTo(const std::string& filepath) const = 0;
+		virtual std::string getContent() const = 0;
+
+		virtual uint64_t getTotalDrainedBytes() const = 0;
+		virtual uint64_t getTotalDrainNanoseconds() const = 0;
+		virtual uint64_t getTotalSyncNanoseconds() const = 0;
+	};
+
+}} // namespace allure::service
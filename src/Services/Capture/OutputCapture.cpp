@@ -0,0 +1,437 @@
+#include "OutputCapture.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#if !defined(_WIN32)
+	#include <fcntl.h>
+	#include <poll.h>
+	#include <sys/ioctl.h>
+	#include <unistd.h>
+	#include <cerrno>
+#endif
+
+
+namespace allure { namespace service {
+
+	namespace {
+		uint64_t elapsedNanoseconds(std::chrono::steady_clock::time_point since)
+		{
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - since).count());
+		}
+	}
+
+	OutputCapture::OutputCapture()
+		:m_enabled(false)
+		,m_onlyOnFailure(false)
+		,m_tee(false)
+		,m_memoryLimit(DEFAULT_MEMORY_LIMIT)
+		,m_memory()
+		,m_memoryCapacity(0)
+		,m_memorySize(0)
+		,m_spilledSize(0)
+		,m_spillFd(-1)
+		,m_stdoutReadFd(-1)
+		,m_stderrReadFd(-1)
+		,m_originalStdout(-1)
+		,m_originalStderr(-1)
+		,m_drainThread()
+		,m_mutex()
+		,m_capturing(false)
+		,m_draining(false)
+		,m_testRunning(false)
+		,m_totalDrainedBytes(0)
+		,m_totalDrainNanoseconds(0)
+		,m_totalSyncNanoseconds(0)
+	{
+	}
+
+	OutputCapture::~OutputCapture()
+	{
+		shutdown();
+#if !defined(_WIN32)
+		if (m_spillFd >= 0)
+		{
+			close(m_spillFd);
+		}
+#endif
+	}
+
+	bool OutputCapture::isEnabled() const
+	{
+		return m_enabled;
+	}
+
+	void OutputCapture::setEnabled(bool enabled)
+	{
+		m_enabled = enabled;
+	}
+
+	bool OutputCapture::isOnlyOnFailure() const
+	{
+		return m_onlyOnFailure;
+	}
+
+	void OutputCapture::setOnlyOnFailure(bool onlyOnFailure)
+	{
+		m_onlyOnFailure = onlyOnFailure;
+	}
+
+	bool OutputCapture::isTee() const
+	{
+		return m_tee;
+	}
+
+	void OutputCapture::setTee(bool tee)
+	{
+		m_tee = tee;
+	}
+
+	size_t OutputCapture::getMemoryLimit() const
+	{
+		return m_memoryLimit;
+	}
+
+	void OutputCapture::setMemoryLimit(size_t memoryLimit)
+	{
+		m_memoryLimit = memoryLimit;
+	}
+
+	void OutputCapture::beginTest()
+	{
+		if (!m_enabled || !start())
+		{
+			return;
+		}
+
+		// Whatever was written before the test belongs to the original streams
+		waitUntilDrained();
+
+		// (Re)allocate here, outside of the test body, so that draining never allocates
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_memoryCapacity != m_memoryLimit)
+		{
+			m_memory = (m_memoryLimit > 0) ? std::make_unique<char[]>(m_memoryLimit) : nullptr;
+			m_memoryCapacity = m_memoryLimit;
+		}
+
+		m_memorySize = 0;
+		m_spilledSize = 0;
+#if !defined(_WIN32)
+		if (m_spillFd >= 0)
+		{
+			(void) ftruncate(m_spillFd, 0);
+		}
+#endif
+		m_testRunning = true;
+	}
+
+	void OutputCapture::endTest()
+	{
+		if (!m_capturing)
+		{
+			return;
+		}
+
+		auto syncStart = std::chrono::steady_clock::now();
+		waitUntilDrained();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_testRunning = false;
+		m_totalSyncNanoseconds += elapsedNanoseconds(syncStart);
+	}
+
+	void OutputCapture::shutdown()
+	{
+		if (!m_capturing)
+		{
+			return;
+		}
+
+#if !defined(_WIN32)
+		fflush(stdout);
+		fflush(stderr);
+
+		// Dropping the last write ends of the pipes makes the drain thread see EOF
+		dup2(m_originalStdout, STDOUT_FILENO);
+		dup2(m_originalStderr, STDERR_FILENO);
+		m_drainThread.join();
+
+		close(m_stdoutReadFd);
+		close(m_stderrReadFd);
+		close(m_originalStdout);
+		close(m_originalStderr);
+		m_stdoutReadFd = -1;
+		m_stderrReadFd = -1;
+		m_originalStdout = -1;
+		m_originalStderr = -1;
+#endif
+
+		m_testRunning = false;
+		m_capturing = false;
+	}
+
+	bool OutputCapture::isEmpty() const
+	{
+		return getCapturedBytes() == 0;
+	}
+
+	uint64_t OutputCapture::getCapturedBytes() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_memorySize + m_spilledSize;
+	}
+
+	std::string OutputCapture::getMemoryContent() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return std::string(m_memory.get(), m_memorySize);
+	}
+
+	void OutputCapture::appendSpilledContentTo(const std::string& filepath) const
+	{
+#if !defined(_WIN32)
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_spilledSize == 0)
+		{
+			return;
+		}
+
+		std::ofstream outputFileStream(filepath, std::ios::binary | std::ios::app);
+		char chunk[4096];
+		uint64_t offset = 0;
+		while (offset < m_spilledSize)
+		{
+			ssize_t bytesRead = pread(m_spillFd, chunk, sizeof(chunk), static_cast<off_t>(offset));
+			if (bytesRead <= 0)
+			{
+				break;
+			}
+			outputFileStream.write(chunk, bytesRead);
+			offset += static_cast<uint64_t>(bytesRead);
+		}
+#endif
+	}
+
+	std::string OutputCapture::getContent() const
+	{
+		std::string content = getMemoryContent();
+
+#if !defined(_WIN32)
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_spilledSize > 0)
+		{
+			size_t memorySize = content.size();
+			content.resize(memorySize + m_spilledSize);
+			ssize_t bytesRead = pread(m_spillFd, &content[memorySize], m_spilledSize, 0);
+			content.resize(memorySize + static_cast<size_t>(std::max<ssize_t>(bytesRead, 0)));
+		}
+#endif
+
+		return content;
+	}
+
+	uint64_t OutputCapture::getTotalDrainedBytes() const
+	{
+		return m_totalDrainedBytes.load();
+	}
+
+	uint64_t OutputCapture::getTotalDrainNanoseconds() const
+	{
+		return m_totalDrainNanoseconds.load();
+	}
+
+	uint64_t OutputCapture::getTotalSyncNanoseconds() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_totalSyncNanoseconds;
+	}
+
+	bool OutputCapture::start()
+	{
+#if defined(_WIN32)
+		return false;
+#else
+		if (m_capturing)
+		{
+			return true;
+		}
+
+		if (m_spillFd < 0)
+		{
+			const char* tempFolder = std::getenv("TMPDIR");
+			std::string spillPath = std::string((tempFolder && *tempFolder) ? tempFolder : "/tmp") + "/allure-output-XXXXXX";
+			m_spillFd = mkstemp(&spillPath[0]);
+			if (m_spillFd >= 0)
+			{
+				unlink(spillPath.c_str());
+				fcntl(m_spillFd, F_SETFD, FD_CLOEXEC);
+			}
+		}
+
+		// One pipe per stream, so that each one is passed through to where it was going
+		int stdoutPipeFds[2];
+		int stderrPipeFds[2];
+		if (pipe(stdoutPipeFds) != 0)
+		{
+			return false;
+		}
+		if (pipe(stderrPipeFds) != 0)
+		{
+			close(stdoutPipeFds[0]);
+			close(stdoutPipeFds[1]);
+			return false;
+		}
+		fcntl(stdoutPipeFds[0], F_SETFD, FD_CLOEXEC);
+		fcntl(stderrPipeFds[0], F_SETFD, FD_CLOEXEC);
+
+		fflush(stdout);
+		fflush(stderr);
+		m_originalStdout = dup(STDOUT_FILENO);
+		m_originalStderr = dup(STDERR_FILENO);
+		fcntl(m_originalStdout, F_SETFD, FD_CLOEXEC);
+		fcntl(m_originalStderr, F_SETFD, FD_CLOEXEC);
+		dup2(stdoutPipeFds[1], STDOUT_FILENO);
+		dup2(stderrPipeFds[1], STDERR_FILENO);
+		close(stdoutPipeFds[1]);
+		close(stderrPipeFds[1]);
+
+		m_stdoutReadFd = stdoutPipeFds[0];
+		m_stderrReadFd = stderrPipeFds[0];
+		m_capturing = true;
+		m_drainThread = std::thread(&OutputCapture::drainLoop, this);
+		return true;
+#endif
+	}
+
+	void OutputCapture::waitUntilDrained()
+	{
+#if !defined(_WIN32)
+		fflush(stdout);
+		fflush(stderr);
+
+		// Bytes are either still in the pipes or being handled by the drain thread
+		while (true)
+		{
+			int pendingStdoutBytes = 0;
+			int pendingStderrBytes = 0;
+			if ((ioctl(m_stdoutReadFd, FIONREAD, &pendingStdoutBytes) != 0) ||
+				(ioctl(m_stderrReadFd, FIONREAD, &pendingStderrBytes) != 0))
+			{
+				break;
+			}
+			if ((pendingStdoutBytes == 0) && (pendingStderrBytes == 0) && !m_draining.load())
+			{
+				break;
+			}
+			std::this_thread::yield();
+		}
+#endif
+	}
+
+	void OutputCapture::drainLoop()
+	{
+#if !defined(_WIN32)
+		// A negative fd is ignored by poll(), so a stream that reached EOF stops being polled
+		struct pollfd readPolls[2] = { { m_stdoutReadFd, POLLIN, 0 }, { m_stderrReadFd, POLLIN, 0 } };
+		const int originalFds[2] = { m_originalStdout, m_originalStderr };
+		char chunk[4096];
+		while ((readPolls[0].fd >= 0) || (readPolls[1].fd >= 0))
+		{
+			int pollResult = poll(readPolls, 2, -1);
+			if (pollResult < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				break;
+			}
+
+			for (int stream = 0; stream < 2; stream++)
+			{
+				if ((readPolls[stream].fd < 0) || (readPolls[stream].revents == 0))
+				{
+					continue;
+				}
+
+				m_draining.store(true);
+				ssize_t bytesRead = read(readPolls[stream].fd, chunk, sizeof(chunk));
+				if (bytesRead <= 0)
+				{
+					m_draining.store(false);
+					if ((bytesRead < 0) && (errno == EINTR))
+					{
+						continue;
+					}
+					readPolls[stream].fd = -1;
+					continue;
+				}
+
+				auto drainStart = std::chrono::steady_clock::now();
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (m_testRunning)
+					{
+						store(chunk, static_cast<size_t>(bytesRead));
+					}
+					if (!m_testRunning || m_tee)
+					{
+						writeToOriginal(originalFds[stream], chunk, static_cast<size_t>(bytesRead));
+					}
+				}
+				m_totalDrainedBytes += static_cast<uint64_t>(bytesRead);
+				m_totalDrainNanoseconds += elapsedNanoseconds(drainStart);
+				m_draining.store(false);
+			}
+		}
+#endif
+	}
+
+	void OutputCapture::store(const char* data, size_t size)
+	{
+		size_t inMemory = std::min(size, m_memoryCapacity - m_memorySize);
+		if (inMemory > 0)
+		{
+			std::memcpy(m_memory.get() + m_memorySize, data, inMemory);
+			m_memorySize += inMemory;
+		}
+
+#if !defined(_WIN32)
+		if ((inMemory < size) && (m_spillFd >= 0))
+		{
+			ssize_t written = pwrite(m_spillFd, data + inMemory, size - inMemory, static_cast<off_t>(m_spilledSize));
+			if (written > 0)
+			{
+				m_spilledSize += static_cast<uint64_t>(written);
+			}
+		}
+#endif
+	}
+
+	void OutputCapture::writeToOriginal(int fd, const char* data, size_t size) const
+	{
+#if !defined(_WIN32)
+		while (size > 0)
+		{
+			ssize_t written = write(fd, data, size);
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				return;
+			}
+			data += written;
+			size -= static_cast<size_t>(written);
+		}
+#endif
+	}
+
+}} // namespace allure::service
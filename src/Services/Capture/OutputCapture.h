@@ -0,0 +1,97 @@
+#pragma once
+
+#include "IOutputCapture.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Captures everything the process writes to stdout/stderr while a test runs.
+	 *
+	 * File descriptors 1 and 2 are redirected into one pipe each, both drained by
+	 * a background thread. Bytes received while a test is running are stored into
+	 * a preallocated buffer of getMemoryLimit() bytes, in the order the drain
+	 * thread reads them; anything beyond that spills into an unlinked temp file,
+	 * so the per-test memory footprint never grows past the limit. Output
+	 * produced between tests is passed through to the original stream it was
+	 * written to, and while capturing it can optionally be teed through as well.
+	 *
+	 * Only supported on POSIX platforms; elsewhere beginTest() is a no-op.
+	 */
+	class OutputCapture : public IOutputCapture
+	{
+	public:
+		static constexpr size_t DEFAULT_MEMORY_LIMIT = 256 * 1024;
+
+		OutputCapture();
+		virtual ~OutputCapture();
+
+		bool isEnabled() const override;
+		void setEnabled(bool) override;
+
+		bool isOnlyOnFailure() const override;
+		void setOnlyOnFailure(bool) override;
+
+		bool isTee() const override;
+		void setTee(bool) override;
+
+		size_t getMemoryLimit() const override;
+		void setMemoryLimit(size_t) override;
+
+		void beginTest() override;
+		void endTest() override;
+		void shutdown() override;
+
+		bool isEmpty() const override;
+		uint64_t getCapturedBytes() const override;
+		std::string getMemoryContent() const override;
+		void appendSpilledContentTo(const std::string& filepath) const override;
+		std::string getContent() const override;
+
+		uint64_t getTotalDrainedBytes() const override;
+		uint64_t getTotalDrainNanoseconds() const override;
+		uint64_t getTotalSyncNanoseconds() const override;
+
+	private:
+		bool start();
+		void waitUntilDrained();
+		void drainLoop();
+		void store(const char* data, size_t size);
+		void writeToOriginal(int fd, const char* data, size_t size) const;
+
+	private:
+		bool m_enabled;
+		bool m_onlyOnFailure;
+		bool m_tee;
+		size_t m_memoryLimit;
+
+		std::unique_ptr<char[]> m_memory;
+		size_t m_memoryCapacity;
+		size_t m_memorySize;
+		uint64_t m_spilledSize;
+		int m_spillFd;
+
+		int m_stdoutReadFd;
+		int m_stderrReadFd;
+		int m_originalStdout;
+		int m_originalStderr;
+		std::thread m_drainThread;
+		mutable std::mutex m_mutex;
+		bool m_capturing;
+		std::atomic<bool> m_draining;
+		bool m_testRunning;
+
+		std::atomic<uint64_t> m_totalDrainedBytes;
+		std::atomic<uint64_t> m_totalDrainNanoseconds;
+		uint64_t m_totalSyncNanoseconds;
+	};
+
+}} // namespace allure::service
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Model/Status.h"
+#include "Model/StepBudget.h"
 
 #include <string>
 #include <stdexcept>
@@ -14,6 +15,7 @@ namespace allure { namespace service {
 		virtual ~ITestStepEndEventHandler() = default;
 
 		virtual void handleTestStepEnd(model::Status) const = 0;
+		virtual void handleTestStepEnd(model::Status, const model::StepBudget&) const = 0;
 
 	public:
 		struct Exception : std::runtime_error
@@ -1,8 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 
+namespace allure { namespace model {
+	class DeferredName;
+}} // namespace allure::model
+
+
 namespace allure { namespace service {
 
 	class ITestStepStartEventHandler
@@ -11,6 +17,8 @@ namespace allure { namespace service {
 		virtual ~ITestStepStartEventHandler() = default;
 
 		virtual void handleTestStepStart(const std::string& testStepDescription, bool isAction) const = 0;
+		virtual void handleTestStepStart(const model::DeferredName& testStepDescription, bool isAction) const = 0;
+		virtual void handleTestStepStart(uint32_t testStepNameId, bool isAction) const = 0;
 	};
 
 }} // namespace allure::service
@@ -1,10 +1,26 @@
 #include "TestCaseEndEventHandler.h"
 
+#include "Model/Action.h"
+#include "Model/Step.h"
 #include "Model/TestProgram.h"
+#include "Services/Capture/IOutputCapture.h"
+#include "Services/Log/ILogRingBuffer.h"
+#include "Services/Metrics/AllocationTracker.h"
+#include "Services/Metrics/IPerfCounterGroup.h"
+#include "Services/Metrics/IResourceUsageMonitor.h"
+#include "Services/Metrics/OverheadGovernor.h"
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Metrics/TestMetricRegistry.h"
+#include "Services/Report/IChromeTraceWriter.h"
+#include "Services/Report/DurationBaselineStore.h"
+#include "Services/Report/FlameGraphBuilder.h"
+#include "Services/Report/StatusDetailsBuilder.h"
 #include "Services/System/ITimeService.h"
 #include "Services/Report/ITestCaseJSONSerializer.h"
 #include "Services/System/IFileService.h"
 
+#include <fmt/format.h>
+
 #ifdef _WIN32
 	#define PATH_SEPARATOR "\\"
 #else
@@ -14,59 +30,152 @@
 
 namespace allure { namespace service {
 
+	namespace {
+		unsigned int countSteps(const model::Step& step)
+		{
+			unsigned int count = step.getStepCount();
+			for (unsigned int i = 0; i < step.getStepCount(); i++)
+			{
+				count += countSteps(*step.getStep(i));
+			}
+			return count;
+		}
+
+		// Attachments of the nested steps, whose files are already in the output folder
+		void collectNestedAttachments(const model::Step& step, std::vector<model::Attachment>& attachments)
+		{
+			for (unsigned int i = 0; i < step.getStepCount(); i++)
+			{
+				const model::Step& nestedStep = *step.getStep(i);
+				attachments.insert(attachments.end(), nestedStep.getAttachments().begin(), nestedStep.getAttachments().end());
+				collectNestedAttachments(nestedStep, attachments);
+			}
+		}
+
+		void renderDeferredNames(model::Step& step)
+		{
+			step.renderDeferredName();
+			for (unsigned int i = 0; i < step.getStepCount(); i++)
+			{
+				renderDeferredNames(*step.getStep(i));
+			}
+		}
+
+		model::Parameter buildSummaryParameter(const std::string& name, int64_t count)
+		{
+			model::Parameter parameter;
+			parameter.setName(name);
+			parameter.setValue(std::to_string(count));
+			parameter.setExcluded(true);
+			return parameter;
+		}
+	}
+
 	TestCaseEndEventHandler::TestCaseEndEventHandler(model::TestProgram& testProgram,
 													 std::unique_ptr<ITimeService> timeService,
 													 std::unique_ptr<ITestCaseJSONSerializer> testCaseJSONSerializer,
-													 std::unique_ptr<IFileService> fileService)
+													 std::unique_ptr<IFileService> fileService,
+													 std::shared_ptr<ILogRingBuffer> logRingBuffer,
+													 std::shared_ptr<IOutputCapture> outputCapture,
+													 std::shared_ptr<IResourceUsageMonitor> resourceUsageMonitor,
+													 std::shared_ptr<IPerfCounterGroup> perfCounterGroup,
+													 std::shared_ptr<IAllocationTracker> allocationTracker,
+													 std::shared_ptr<IDurationBaselineStore> durationBaselineStore,
+													 std::shared_ptr<ITestMetricRegistry> testMetricRegistry,
+													 std::shared_ptr<IChromeTraceWriter> chromeTraceWriter,
+													 std::shared_ptr<IFlameGraphBuilder> flameGraphBuilder,
+													 std::shared_ptr<IOverheadGovernor> overheadGovernor)
 		:m_testProgram(testProgram)
 		,m_timeService(std::move(timeService))
 		,m_testCaseJSONSerializer(std::move(testCaseJSONSerializer))
 		,m_fileService(std::move(fileService))
+		,m_logRingBuffer(std::move(logRingBuffer))
+		,m_outputCapture(std::move(outputCapture))
+		,m_resourceUsageMonitor(std::move(resourceUsageMonitor))
+		,m_perfCounterGroup(std::move(perfCounterGroup))
+		,m_allocationTracker(std::move(allocationTracker))
+		,m_durationBaselineStore(std::move(durationBaselineStore))
+		,m_testMetricRegistry(std::move(testMetricRegistry))
+		,m_chromeTraceWriter(std::move(chromeTraceWriter))
+		,m_flameGraphBuilder(std::move(flameGraphBuilder))
+		,m_overheadGovernor(std::move(overheadGovernor))
 	{
 	}
 
 	void TestCaseEndEventHandler::handleTestCaseEnd(model::Status status) const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		AllocationTracker::Pause allocationPause;
 		model::TestCase& testCase = getRunningTestCase();
-		model::TestSuite& testSuite = getRunningTestSuite();
-
-		testCase.setStop(m_timeService->getCurrentTime());
-		testCase.setStage(model::Stage::FINISHED);
 		testCase.setStatus(status);
-
-		// Write JSON immediately after test completes
-		writeTestCaseJSON(testCase);
-
-		// Clear the test case cache since it's no longer running
-		m_testProgram.setRunningTestCase(nullptr);
+		finishTestCase(testCase);
 	}
 
 	void TestCaseEndEventHandler::handleTestCaseEnd(model::Status status,
 	                                                 const std::string& statusMessage,
 	                                                 const std::string& statusTrace) const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		AllocationTracker::Pause allocationPause;
 		model::TestCase& testCase = getRunningTestCase();
-		model::TestSuite& testSuite = getRunningTestSuite();
-
-		testCase.setStop(m_timeService->getCurrentTime());
-		testCase.setStage(model::Stage::FINISHED);
 		testCase.setStatus(status);
 
-		// Set failure details if provided
+		// Set failure details if provided (bounded, whatever adapter produced them)
+		size_t maxBytes = m_testProgram.getMaxStatusDetailBytes();
 		if (!statusMessage.empty())
 		{
-			testCase.setStatusMessage(statusMessage);
+			testCase.setStatusMessage(StatusDetailsBuilder::limitMessage(statusMessage, maxBytes));
 		}
 		if (!statusTrace.empty())
 		{
-			testCase.setStatusTrace(statusTrace);
+			testCase.setStatusTrace(StatusDetailsBuilder::limitTrace(statusTrace, maxBytes));
+		}
+		finishTestCase(testCase);
+	}
+
+	void TestCaseEndEventHandler::finishTestCase(model::TestCase& testCase) const
+	{
+		// A test case can only end inside a running suite
+		getRunningTestSuite();
+		m_outputCapture->endTest();
+
+		// Adapters that time the test themselves (e.g. benchmark reporters) have already set its duration
+		if (testCase.getDurationNs() == 0)
+		{
+			int64_t stopNs = m_timeService->getMonotonicNanoseconds();
+			testCase.setDurationNs((stopNs > testCase.getStartNs()) ? static_cast<uint64_t>(stopNs - testCase.getStartNs()) : 0);
+		}
+		testCase.setStop(m_timeService->getCurrentTime());
+		testCase.setStage(model::Stage::FINISHED);
+		addPerfCounters(testCase);
+		addResourceUsage(testCase);
+		addAllocationUsage(testCase);
+		addTestMetrics(testCase);
+		addCaptureLevel(testCase);
+		applyBudgetViolations(testCase);
+		checkDurationBaseline(testCase);
+		addFlameGraph(testCase);
+
+		// Keep the log and full step details only when they help diagnosing a failure
+		addStepOverflowSummary(testCase);
+		applyStepDetailPolicy(testCase);
+
+		// Formatted names of the steps kept are rendered once, before the report reads them
+		for (unsigned int i = 0; i < testCase.getStepCount(); i++)
+		{
+			renderDeferredNames(*testCase.getStep(i));
 		}
+		writeDeferredAttachments(testCase);
+		attachFailureLog(testCase);
+		attachCapturedOutput(testCase);
+		m_chromeTraceWriter->writeTestCase(testCase);
 
 		// Write JSON immediately after test completes
 		writeTestCaseJSON(testCase);
 
 		// Clear the test case cache since it's no longer running
 		m_testProgram.setRunningTestCase(nullptr);
+		m_overheadGovernor->endTest(testCase.getDurationNs());
 	}
 
 	void TestCaseEndEventHandler::writeTestCaseJSON(const model::TestCase& testCase) const
@@ -77,6 +186,346 @@ namespace allure { namespace service {
 		m_fileService->saveFile(filepath, content);
 	}
 
+	void TestCaseEndEventHandler::addFlameGraph(model::TestCase& testCase) const
+	{
+		if (!m_flameGraphBuilder->isEnabled())
+		{
+			return;
+		}
+
+		// Collapse before step details are dropped, the run graph needs passing tests too
+		FlameGraphBuilder::Stacks stacks;
+		FlameGraphBuilder::collapseTestCase(getRunningTestSuite().getName(), testCase, stacks);
+		m_flameGraphBuilder->addStacks(stacks);
+		if (stacks.empty() || isAttachmentDeferred(testCase))
+		{
+			return;
+		}
+
+		// Generate flame graph attachment files: {uuid}-flamegraph.svg and {uuid}-stacks.txt
+		std::string svgFilename = testCase.getUUID() + "-flamegraph.svg";
+		m_fileService->saveFile(m_testProgram.getOutputFolder() + PATH_SEPARATOR + svgFilename,
+								FlameGraphBuilder::renderSVG(stacks, testCase.getName()));
+
+		model::Attachment svgAttachment;
+		svgAttachment.setName("flame graph");
+		svgAttachment.setSource(svgFilename);
+		svgAttachment.setType("image/svg+xml");
+		testCase.addAttachment(svgAttachment);
+
+		std::string stacksFilename = testCase.getUUID() + "-stacks.txt";
+		m_fileService->saveFile(m_testProgram.getOutputFolder() + PATH_SEPARATOR + stacksFilename,
+								FlameGraphBuilder::formatCollapsed(stacks));
+
+		model::Attachment stacksAttachment;
+		stacksAttachment.setName("collapsed stacks");
+		stacksAttachment.setSource(stacksFilename);
+		stacksAttachment.setType("text/plain");
+		testCase.addAttachment(stacksAttachment);
+	}
+
+	void TestCaseEndEventHandler::addStepOverflowSummary(model::TestCase& testCase) const
+	{
+		unsigned int droppedSteps = testCase.getDroppedStepCount();
+		if (droppedSteps == 0)
+		{
+			return;
+		}
+
+		auto summaryStep = std::make_unique<model::Action>();
+		summaryStep->setName("Step limit reached: " + std::to_string(droppedSteps) + " steps not recorded");
+		summaryStep->setStatus(testCase.getStatus());
+		summaryStep->setStage(model::Stage::FINISHED);
+		summaryStep->setStart(testCase.getStop());
+		summaryStep->setStop(testCase.getStop());
+		summaryStep->addParameter(buildSummaryParameter("dropped steps", droppedSteps));
+		summaryStep->addParameter(buildSummaryParameter("max steps per test", m_testProgram.getMaxStepsPerTest()));
+		summaryStep->addParameter(buildSummaryParameter("max step depth", m_testProgram.getMaxStepDepth()));
+		testCase.addStep(std::move(summaryStep));
+	}
+
+	void TestCaseEndEventHandler::addPerfCounters(model::TestCase& testCase) const
+	{
+		for (const auto& metric : m_perfCounterGroup->endTest())
+		{
+			testCase.addParameter(buildSummaryParameter(metric.getName(), metric.getValue()));
+		}
+	}
+
+	void TestCaseEndEventHandler::addResourceUsage(model::TestCase& testCase) const
+	{
+		if (!m_resourceUsageMonitor->isEnabled())
+		{
+			return;
+		}
+
+		ResourceUsage usage = m_resourceUsageMonitor->endTest();
+		testCase.addParameter(buildSummaryParameter("cpu user (us)", usage.userCpuMicroseconds));
+		testCase.addParameter(buildSummaryParameter("cpu system (us)", usage.systemCpuMicroseconds));
+		testCase.addParameter(buildSummaryParameter("max rss growth (KiB)", usage.maxRssKilobytes));
+		testCase.addParameter(buildSummaryParameter("rss delta (KiB)", usage.rssKilobytes));
+		testCase.addParameter(buildSummaryParameter("minor faults", usage.minorFaults));
+		testCase.addParameter(buildSummaryParameter("major faults", usage.majorFaults));
+		testCase.addParameter(buildSummaryParameter("voluntary context switches", usage.voluntaryContextSwitches));
+		testCase.addParameter(buildSummaryParameter("involuntary context switches", usage.involuntaryContextSwitches));
+		testCase.addParameter(buildSummaryParameter("block reads", usage.blockInputOperations));
+		testCase.addParameter(buildSummaryParameter("block writes", usage.blockOutputOperations));
+	}
+
+	void TestCaseEndEventHandler::addAllocationUsage(model::TestCase& testCase) const
+	{
+		if (!m_allocationTracker->isEnabled() || !m_allocationTracker->isHooked())
+		{
+			return;
+		}
+
+		IAllocationTracker::Usage usage = m_allocationTracker->endTest();
+		testCase.addParameter(buildSummaryParameter("allocations", usage.allocations));
+		testCase.addParameter(buildSummaryParameter("bytes allocated", usage.bytesAllocated));
+		testCase.addParameter(buildSummaryParameter("peak live bytes", usage.peakLiveBytes));
+	}
+
+	void TestCaseEndEventHandler::addTestMetrics(model::TestCase& testCase) const
+	{
+		ITestMetricRegistry::Metrics metrics = m_testMetricRegistry->endTest();
+		for (const auto& counter : metrics.counters)
+		{
+			testCase.addParameter(buildSummaryParameter(counter.name, counter.value));
+		}
+
+		// Names beyond the per-test limits were not recorded
+		if (metrics.droppedCounters > 0)
+		{
+			testCase.addParameter(buildSummaryParameter("dropped counters", static_cast<int64_t>(metrics.droppedCounters)));
+		}
+		if (metrics.droppedGauges > 0)
+		{
+			testCase.addParameter(buildSummaryParameter("dropped gauges", static_cast<int64_t>(metrics.droppedGauges)));
+		}
+
+		if (metrics.gauges.empty())
+		{
+			return;
+		}
+
+		for (const auto& gauge : metrics.gauges)
+		{
+			model::Parameter parameter;
+			parameter.setName(gauge.name);
+			parameter.setValue(fmt::format("last {}, min {}, max {}, {} samples",
+										   gauge.lastValue, gauge.minValue, gauge.maxValue, gauge.samples.size()));
+			parameter.setExcluded(true);
+			testCase.addParameter(parameter);
+		}
+
+		if (isAttachmentDeferred(testCase))
+		{
+			return;
+		}
+
+		// Generate gauges attachment file: {uuid}-gauges-attachment.csv (or .json)
+		bool json = (m_testMetricRegistry->getSeriesFormat() == model::SeriesFormat::JSON);
+		std::string filename = testCase.getUUID() + (json ? "-gauges-attachment.json" : "-gauges-attachment.csv");
+		m_fileService->saveFile(m_testProgram.getOutputFolder() + PATH_SEPARATOR + filename,
+								json ? TestMetricRegistry::formatSeriesJSON(metrics.gauges)
+									 : TestMetricRegistry::formatSeriesCSV(metrics.gauges));
+
+		model::Attachment attachment;
+		attachment.setName("gauges");
+		attachment.setSource(filename);
+		attachment.setType(json ? "application/json" : "text/csv");
+		testCase.addAttachment(attachment);
+	}
+
+	void TestCaseEndEventHandler::addCaptureLevel(model::TestCase& testCase) const
+	{
+		if (!m_overheadGovernor->isEnabled())
+		{
+			return;
+		}
+
+		model::Parameter parameter;
+		parameter.setName("capture level");
+		parameter.setValue(OverheadGovernor::getLevelName(m_overheadGovernor->getLevel()));
+		parameter.setExcluded(true);
+		testCase.addParameter(parameter);
+	}
+
+	void TestCaseEndEventHandler::applyBudgetViolations(model::TestCase& testCase) const
+	{
+		const auto& violations = testCase.getBudgetViolations();
+		if (violations.empty())
+		{
+			return;
+		}
+
+		std::string message;
+		for (const auto& violation : violations)
+		{
+			message += (message.empty() ? "" : "\n") + violation;
+		}
+		std::string statusMessage = testCase.getStatusMessage();
+		testCase.setStatusMessage(statusMessage.empty() ? message : statusMessage + "\n\n" + message);
+		if (testCase.getStatus() == model::Status::PASSED)
+		{
+			testCase.setStatus(testCase.getBudgetViolationStatus());
+		}
+	}
+
+	void TestCaseEndEventHandler::checkDurationBaseline(model::TestCase& testCase) const
+	{
+		if (!m_durationBaselineStore->isEnabled() || testCase.getHistoryId().empty())
+		{
+			return;
+		}
+
+		const DurationBaseline* baseline = m_durationBaselineStore->getBaseline(testCase.getHistoryId());
+		if ((baseline != nullptr) && m_durationBaselineStore->isRegression(*baseline, testCase.getDurationNs()))
+		{
+			model::Label regressionLabel;
+			regressionLabel.setName("tag");
+			regressionLabel.setValue("performance-regression");
+			testCase.addLabel(regressionLabel);
+
+			std::string message = m_durationBaselineStore->buildRegressionMessage(*baseline, testCase.getDurationNs());
+			std::string statusMessage = testCase.getStatusMessage();
+			testCase.setStatusMessage(statusMessage.empty() ? message : statusMessage + "\n\n" + message);
+			testCase.setStatusFlaky(testCase.getStatusFlaky() || m_durationBaselineStore->isMarkFlaky());
+			testCase.setStatusKnown(testCase.getStatusKnown() || m_durationBaselineStore->isMarkKnown());
+		}
+
+		// Failed runs say little about how long the test normally takes
+		if (testCase.getStatus() == model::Status::PASSED)
+		{
+			m_durationBaselineStore->record(testCase.getHistoryId(), testCase.getDurationNs());
+		}
+	}
+
+	void TestCaseEndEventHandler::applyStepDetailPolicy(model::TestCase& testCase) const
+	{
+		model::StepDetailPolicy policy = m_overheadGovernor->getStepDetailPolicy(m_testProgram.getStepDetailPolicy());
+		model::Status status = testCase.getStatus();
+		if ((policy == model::StepDetailPolicy::FULL) || (status == model::Status::FAILED) || (status == model::Status::BROKEN))
+		{
+			return;
+		}
+
+		if (policy == model::StepDetailPolicy::TOP_LEVEL_ON_PASS)
+		{
+			for (unsigned int i = 0; i < testCase.getStepCount(); i++)
+			{
+				model::Step& step = *testCase.getStep(i);
+				unsigned int nestedSteps = countSteps(step);
+				if (nestedSteps > 0)
+				{
+					// Hoist attachments of dropped steps, so that their files stay referenced
+					std::vector<model::Attachment> attachments;
+					collectNestedAttachments(step, attachments);
+					step.clearSteps();
+					for (const auto& attachment : attachments)
+					{
+						step.addAttachment(attachment);
+					}
+					step.addParameter(buildSummaryParameter("nested steps", nestedSteps));
+				}
+			}
+		}
+		else if (testCase.getStepCount() > 0)
+		{
+			unsigned int totalSteps = testCase.getStepCount();
+			std::vector<model::Attachment> attachments;
+			for (unsigned int i = 0; i < testCase.getStepCount(); i++)
+			{
+				const model::Step& step = *testCase.getStep(i);
+				totalSteps += countSteps(step);
+				attachments.insert(attachments.end(), step.getAttachments().begin(), step.getAttachments().end());
+				collectNestedAttachments(step, attachments);
+			}
+			testCase.clearSteps();
+			for (const auto& attachment : attachments)
+			{
+				testCase.addAttachment(attachment);
+			}
+			testCase.addParameter(buildSummaryParameter("steps", totalSteps));
+		}
+	}
+
+	void TestCaseEndEventHandler::writeDeferredAttachments(model::TestCase& testCase) const
+	{
+		const auto& deferredAttachments = testCase.getDeferredAttachments();
+		if (deferredAttachments.empty())
+		{
+			return;
+		}
+
+		// Attachments of passing tests are dropped along with the steps holding them
+		bool failed = (testCase.getStatus() == model::Status::FAILED) || (testCase.getStatus() == model::Status::BROKEN);
+		for (const auto& deferredAttachment : deferredAttachments)
+		{
+			if (failed)
+			{
+				m_fileService->saveFile(m_testProgram.getOutputFolder() + PATH_SEPARATOR + deferredAttachment.first, deferredAttachment.second);
+			}
+			else
+			{
+				testCase.removeAttachment(deferredAttachment.first);
+			}
+		}
+		testCase.clearDeferredAttachments();
+	}
+
+	void TestCaseEndEventHandler::attachFailureLog(model::TestCase& testCase) const
+	{
+		model::Status status = testCase.getStatus();
+		if (!m_logRingBuffer->isEmpty() && ((status == model::Status::FAILED) || (status == model::Status::BROKEN)))
+		{
+			// Generate log attachment file: {uuid}-log-attachment.txt
+			std::string filename = testCase.getUUID() + "-log-attachment.txt";
+			m_fileService->saveFile(m_testProgram.getOutputFolder() + PATH_SEPARATOR + filename, m_logRingBuffer->getContent());
+
+			model::Attachment attachment;
+			attachment.setName("log");
+			attachment.setSource(filename);
+			attachment.setType("text/plain");
+			testCase.addAttachment(attachment);
+		}
+
+		m_logRingBuffer->reset();
+	}
+
+	void TestCaseEndEventHandler::attachCapturedOutput(model::TestCase& testCase) const
+	{
+		if (!m_outputCapture->isEnabled() || m_outputCapture->isEmpty())
+		{
+			return;
+		}
+
+		model::Status status = testCase.getStatus();
+		bool onlyOnFailure = m_outputCapture->isOnlyOnFailure() || m_overheadGovernor->isDeferringAttachments();
+		if (onlyOnFailure && (status != model::Status::FAILED) && (status != model::Status::BROKEN))
+		{
+			return;
+		}
+
+		// Generate output attachment file: {uuid}-output-attachment.txt
+		std::string filename = testCase.getUUID() + "-output-attachment.txt";
+		std::string filepath = m_testProgram.getOutputFolder() + PATH_SEPARATOR + filename;
+		m_fileService->saveFile(filepath, m_outputCapture->getMemoryContent());
+		m_outputCapture->appendSpilledContentTo(filepath);
+
+		model::Attachment attachment;
+		attachment.setName("output");
+		attachment.setSource(filename);
+		attachment.setType("text/plain");
+		testCase.addAttachment(attachment);
+	}
+
+	bool TestCaseEndEventHandler::isAttachmentDeferred(const model::TestCase& testCase) const
+	{
+		model::Status status = testCase.getStatus();
+		return m_overheadGovernor->isDeferringAttachments() && (status != model::Status::FAILED) && (status != model::Status::BROKEN);
+	}
+
 	model::TestCase& TestCaseEndEventHandler::getRunningTestCase() const
 	{
 		model::TestCase* testCase = m_testProgram.getRunningTestCase();
@@ -18,6 +18,16 @@ namespace allure { namespace service {
 	class IUUIDGeneratorService;
 	class ITestCaseJSONSerializer;
 	class IFileService;
+	class ILogRingBuffer;
+	class IOutputCapture;
+	class IResourceUsageMonitor;
+	class IPerfCounterGroup;
+	class IAllocationTracker;
+	class IDurationBaselineStore;
+	class ITestMetricRegistry;
+	class IChromeTraceWriter;
+	class IFlameGraphBuilder;
+	class IOverheadGovernor;
 
 	class TestCaseEndEventHandler : public ITestCaseEndEventHandler
 	{
@@ -25,7 +35,17 @@ namespace allure { namespace service {
 		TestCaseEndEventHandler(model::TestProgram&,
 		                        std::unique_ptr<ITimeService>,
 		                        std::unique_ptr<ITestCaseJSONSerializer>,
-		                        std::unique_ptr<IFileService>);
+		                        std::unique_ptr<IFileService>,
+		                        std::shared_ptr<ILogRingBuffer>,
+		                        std::shared_ptr<IOutputCapture>,
+		                        std::shared_ptr<IResourceUsageMonitor>,
+		                        std::shared_ptr<IPerfCounterGroup>,
+		                        std::shared_ptr<IAllocationTracker>,
+		                        std::shared_ptr<IDurationBaselineStore>,
+		                        std::shared_ptr<ITestMetricRegistry>,
+		                        std::shared_ptr<IChromeTraceWriter>,
+		                        std::shared_ptr<IFlameGraphBuilder>,
+		                        std::shared_ptr<IOverheadGovernor>);
 		virtual ~TestCaseEndEventHandler() = default;
 
 		void handleTestCaseEnd(model::Status) const override;
@@ -36,13 +56,38 @@ namespace allure { namespace service {
 	private:
 		model::TestCase& getRunningTestCase() const;
 		model::TestSuite& getRunningTestSuite() const;
+		void finishTestCase(model::TestCase& testCase) const;
+		void addPerfCounters(model::TestCase& testCase) const;
+		void addResourceUsage(model::TestCase& testCase) const;
+		void addAllocationUsage(model::TestCase& testCase) const;
+		void addTestMetrics(model::TestCase& testCase) const;
+		void addCaptureLevel(model::TestCase& testCase) const;
+		void applyBudgetViolations(model::TestCase& testCase) const;
+		void checkDurationBaseline(model::TestCase& testCase) const;
+		void addFlameGraph(model::TestCase& testCase) const;
+		void addStepOverflowSummary(model::TestCase& testCase) const;
+		void applyStepDetailPolicy(model::TestCase& testCase) const;
+		void writeDeferredAttachments(model::TestCase& testCase) const;
+		void attachFailureLog(model::TestCase& testCase) const;
+		void attachCapturedOutput(model::TestCase& testCase) const;
 		void writeTestCaseJSON(const model::TestCase& testCase) const;
+		bool isAttachmentDeferred(const model::TestCase& testCase) const;
 
 	private:
 		model::TestProgram& m_testProgram;
 		std::unique_ptr<ITimeService> m_timeService;
 		std::unique_ptr<ITestCaseJSONSerializer> m_testCaseJSONSerializer;
 		std::unique_ptr<IFileService> m_fileService;
+		std::shared_ptr<ILogRingBuffer> m_logRingBuffer;
+		std::shared_ptr<IOutputCapture> m_outputCapture;
+		std::shared_ptr<IResourceUsageMonitor> m_resourceUsageMonitor;
+		std::shared_ptr<IPerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<IAllocationTracker> m_allocationTracker;
+		std::shared_ptr<IDurationBaselineStore> m_durationBaselineStore;
+		std::shared_ptr<ITestMetricRegistry> m_testMetricRegistry;
+		std::shared_ptr<IChromeTraceWriter> m_chromeTraceWriter;
+		std::shared_ptr<IFlameGraphBuilder> m_flameGraphBuilder;
+		std::shared_ptr<IOverheadGovernor> m_overheadGovernor;
 	};
 
 }} // namespace allure::service
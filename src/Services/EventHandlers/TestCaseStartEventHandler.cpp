@@ -2,9 +2,18 @@
 
 #include "Model/TestProgram.h"
 #include "Model/Label.h"
+#include "Services/Capture/IOutputCapture.h"
+#include "Services/Metrics/AllocationTracker.h"
+#include "Services/Metrics/IPerfCounterGroup.h"
+#include "Services/Metrics/IResourceUsageMonitor.h"
+#include "Services/Metrics/IOverheadGovernor.h"
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Metrics/ITestMetricRegistry.h"
 #include "Services/System/ITimeService.h"
 #include "Services/System/IUUIDGeneratorService.h"
 
+#include <algorithm>
+#include <cctype>
 #include <sstream>
 #include <iomanip>
 #include <thread>
@@ -57,19 +66,47 @@ namespace allure { namespace service {
 			ss << std::this_thread::get_id();
 			return ss.str();
 		}
+
+		std::string getFrameworkLabel(const std::string& frameworkName)
+		{
+			// Results written before an adapter names the framework keep the historic label
+			if (frameworkName.empty() || (frameworkName == "unknown"))
+			{
+				return "googletest";
+			}
+
+			std::string label = frameworkName;
+			std::transform(label.begin(), label.end(), label.begin(),
+						   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+			return label;
+		}
 	}
 
 	TestCaseStartEventHandler::TestCaseStartEventHandler(model::TestProgram& testProgram,
 														 std::unique_ptr<IUUIDGeneratorService> uuidGeneratorService,
-														 std::unique_ptr<ITimeService> timeService)
+														 std::unique_ptr<ITimeService> timeService,
+														 std::shared_ptr<IOutputCapture> outputCapture,
+														 std::shared_ptr<IResourceUsageMonitor> resourceUsageMonitor,
+														 std::shared_ptr<IPerfCounterGroup> perfCounterGroup,
+														 std::shared_ptr<IAllocationTracker> allocationTracker,
+														 std::shared_ptr<ITestMetricRegistry> testMetricRegistry,
+														 std::shared_ptr<IOverheadGovernor> overheadGovernor)
 		:m_testProgram(testProgram)
 		,m_uuidGeneratorService(std::move(uuidGeneratorService))
 		,m_timeService(std::move(timeService))
+		,m_outputCapture(std::move(outputCapture))
+		,m_resourceUsageMonitor(std::move(resourceUsageMonitor))
+		,m_perfCounterGroup(std::move(perfCounterGroup))
+		,m_allocationTracker(std::move(allocationTracker))
+		,m_testMetricRegistry(std::move(testMetricRegistry))
+		,m_overheadGovernor(std::move(overheadGovernor))
 	{
 	}
 
 	void TestCaseStartEventHandler::handleTestCaseStart(const std::string& testCaseName) const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		AllocationTracker::Pause allocationPause;
 		auto& testSuite = getRunningTestSuite();
 
 		model::TestCase testCase;
@@ -92,6 +129,7 @@ namespace allure { namespace service {
 		testCase.addLabel(allureIdLabel);
 
 		testCase.setStart(m_timeService->getCurrentTime());
+		testCase.setStartNs(m_timeService->getMonotonicNanoseconds());
 		testCase.setStage(model::Stage::RUNNING);
 		testCase.setStatus(model::Status::UNKNOWN);
 
@@ -103,10 +141,15 @@ namespace allure { namespace service {
 		// Update cache pointer to the newly added test case
 		auto& testCases = testSuite.getTestCases();
 		m_testProgram.setRunningTestCase(&testCases[testCases.size() - 1]);
+
+		// Last, so that the bookkeeping above is not accounted to the test
+		beginMeasurements();
 	}
 
 	void TestCaseStartEventHandler::handleTestCaseStart(const ITestMetadata& metadata) const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		AllocationTracker::Pause allocationPause;
 		auto& testSuite = getRunningTestSuite();
 
 		model::TestCase testCase;
@@ -125,6 +168,7 @@ namespace allure { namespace service {
 		testCase.addLabel(allureIdLabel);
 
 		testCase.setStart(m_timeService->getCurrentTime());
+		testCase.setStartNs(m_timeService->getMonotonicNanoseconds());
 		testCase.setStage(model::Stage::RUNNING);
 		testCase.setStatus(model::Status::UNKNOWN);
 
@@ -153,6 +197,19 @@ namespace allure { namespace service {
 		// Update cache pointer to the newly added test case
 		auto& testCases = testSuite.getTestCases();
 		m_testProgram.setRunningTestCase(&testCases[testCases.size() - 1]);
+
+		// Last, so that the bookkeeping above is not accounted to the test
+		beginMeasurements();
+	}
+
+	void TestCaseStartEventHandler::beginMeasurements() const
+	{
+		m_resourceUsageMonitor->beginTest();
+		m_perfCounterGroup->beginTest();
+		m_allocationTracker->beginTest();
+		m_testMetricRegistry->beginTest();
+		m_overheadGovernor->beginTest();
+		m_outputCapture->beginTest();
 	}
 
 	void TestCaseStartEventHandler::addCommonLabels(model::TestCase& testCase, const std::string& suiteName) const
@@ -170,7 +227,7 @@ namespace allure { namespace service {
 
 		model::Label frameworkLabel;
 		frameworkLabel.setName("framework");
-		frameworkLabel.setValue("googletest");
+		frameworkLabel.setValue(getFrameworkLabel(m_testProgram.getFrameworkName()));
 		testCase.addLabel(frameworkLabel);
 
 		model::Label languageLabel;
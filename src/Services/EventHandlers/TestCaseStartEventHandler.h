@@ -16,13 +16,25 @@ namespace allure { namespace service {
 
 	class ITimeService;
 	class IUUIDGeneratorService;
+	class IOutputCapture;
+	class IResourceUsageMonitor;
+	class IPerfCounterGroup;
+	class IAllocationTracker;
+	class ITestMetricRegistry;
+	class IOverheadGovernor;
 
 	class TestCaseStartEventHandler : public ITestCaseStartEventHandler
 	{
 	public:
 		TestCaseStartEventHandler(model::TestProgram&,
 								  std::unique_ptr<IUUIDGeneratorService>,
-								  std::unique_ptr<ITimeService>);
+								  std::unique_ptr<ITimeService>,
+								  std::shared_ptr<IOutputCapture>,
+								  std::shared_ptr<IResourceUsageMonitor>,
+								  std::shared_ptr<IPerfCounterGroup>,
+								  std::shared_ptr<IAllocationTracker>,
+								  std::shared_ptr<ITestMetricRegistry>,
+								  std::shared_ptr<IOverheadGovernor>);
 		virtual ~TestCaseStartEventHandler() = default;
 
 		void handleTestCaseStart(const std::string& testCaseName) const override;
@@ -38,12 +50,19 @@ namespace allure { namespace service {
 
 	private:
 		model::TestSuite& getRunningTestSuite() const;
+		void beginMeasurements() const;
 		void addCommonLabels(model::TestCase& testCase, const std::string& suiteName) const;
 
 	private:
 		model::TestProgram& m_testProgram;
 		std::unique_ptr<IUUIDGeneratorService> m_uuidGeneratorService;
 		std::unique_ptr<ITimeService> m_timeService;
+		std::shared_ptr<IOutputCapture> m_outputCapture;
+		std::shared_ptr<IResourceUsageMonitor> m_resourceUsageMonitor;
+		std::shared_ptr<IPerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<IAllocationTracker> m_allocationTracker;
+		std::shared_ptr<ITestMetricRegistry> m_testMetricRegistry;
+		std::shared_ptr<IOverheadGovernor> m_overheadGovernor;
 	};
 
 }} // namespace allure::service
@@ -1,24 +1,35 @@
 #include "TestProgramEndEventHandler.h"
 
 #include "Model/TestProgram.h"
+#include "Services/Capture/IOutputCapture.h"
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Report/IChromeTraceWriter.h"
 #include "Services/Report/ITestProgramJSONBuilder.h"
 
 
 namespace allure { namespace service {
 
 	TestProgramEndEventHandler::TestProgramEndEventHandler(model::TestProgram& testProgram,
-														   std::unique_ptr<ITestProgramJSONBuilder> testProgramJSONBuilderService)
+														   std::unique_ptr<ITestProgramJSONBuilder> testProgramJSONBuilderService,
+														   std::shared_ptr<IOutputCapture> outputCapture,
+														   std::shared_ptr<IChromeTraceWriter> chromeTraceWriter)
 		:m_testProgram(testProgram)
 		,m_testProgramJSONBuilderService(std::move(testProgramJSONBuilderService))
+		,m_outputCapture(std::move(outputCapture))
+		,m_chromeTraceWriter(std::move(chromeTraceWriter))
 	{
 	}
 
 	void TestProgramEndEventHandler::handleTestProgramEnd() const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		m_outputCapture->shutdown();
+
 		// Note: Test case and container JSON files are now written immediately
 		// after each test/suite completes (by TestCaseEndEventHandler and TestSuiteEndEventHandler).
 		// Here we only need to write the metadata files.
 		m_testProgramJSONBuilderService->buildMetadataFiles(m_testProgram);
+		m_chromeTraceWriter->close();
 	}
 
 }} // namespace allure::service
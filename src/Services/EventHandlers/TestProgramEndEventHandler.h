@@ -12,12 +12,16 @@ namespace allure { namespace model {
 namespace allure { namespace service {
 
 	class ITestProgramJSONBuilder;
+	class IOutputCapture;
+	class IChromeTraceWriter;
 
 	class TestProgramEndEventHandler : public ITestProgramEndEventHandler
 	{
 	public:
 		TestProgramEndEventHandler(model::TestProgram&,
-								   std::unique_ptr<ITestProgramJSONBuilder>);
+								   std::unique_ptr<ITestProgramJSONBuilder>,
+								   std::shared_ptr<IOutputCapture>,
+								   std::shared_ptr<IChromeTraceWriter>);
 		virtual ~TestProgramEndEventHandler() = default;
 
 		void handleTestProgramEnd() const;
@@ -25,6 +29,8 @@ namespace allure { namespace service {
 	private:
 		model::TestProgram& m_testProgram;
 		std::unique_ptr<ITestProgramJSONBuilder> m_testProgramJSONBuilderService;
+		std::shared_ptr<IOutputCapture> m_outputCapture;
+		std::shared_ptr<IChromeTraceWriter> m_chromeTraceWriter;
 	};
 
 }} // namespace allure::service
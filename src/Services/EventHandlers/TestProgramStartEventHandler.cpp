@@ -1,12 +1,19 @@
 #include "TestProgramStartEventHandler.h"
 
 #include "Model/TestProgram.h"
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Report/ChromeTraceWriter.h"
+#include "Services/Report/DurationBaselineStore.h"
 
 
 namespace allure { namespace service {
 
-	TestProgramStartEventHandler::TestProgramStartEventHandler(model::TestProgram& testProgram)
+	TestProgramStartEventHandler::TestProgramStartEventHandler(model::TestProgram& testProgram,
+	                                                           std::shared_ptr<IDurationBaselineStore> durationBaselineStore,
+	                                                           std::shared_ptr<IChromeTraceWriter> chromeTraceWriter)
 		:m_testProgram(testProgram)
+		,m_durationBaselineStore(std::move(durationBaselineStore))
+		,m_chromeTraceWriter(std::move(chromeTraceWriter))
 	{
 	}
 
@@ -14,7 +21,18 @@ namespace allure { namespace service {
 
 	void TestProgramStartEventHandler::handleTestProgramStart() const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
 		m_testProgram.clearTestSuites();
+
+		if (m_durationBaselineStore->isEnabled())
+		{
+			m_durationBaselineStore->loadFile(DurationBaselineStore::getFilepath(m_testProgram.getOutputFolder()));
+		}
+
+		if (m_chromeTraceWriter->isEnabled())
+		{
+			m_chromeTraceWriter->open(ChromeTraceWriter::getFilepath(m_testProgram.getOutputFolder()));
+		}
 	}
 
 }} // namespace allure::service
@@ -11,16 +11,23 @@ namespace allure { namespace model {
 
 namespace allure { namespace service {
 
+	class IDurationBaselineStore;
+	class IChromeTraceWriter;
+
 	class TestProgramStartEventHandler : public ITestProgramStartEventHandler
 	{
 	public:
-		TestProgramStartEventHandler(model::TestProgram&);
+		TestProgramStartEventHandler(model::TestProgram&,
+		                             std::shared_ptr<IDurationBaselineStore>,
+		                             std::shared_ptr<IChromeTraceWriter>);
 		virtual ~TestProgramStartEventHandler();
 
 		void handleTestProgramStart() const;
 
 	private:
 		model::TestProgram& m_testProgram;
+		std::shared_ptr<IDurationBaselineStore> m_durationBaselineStore;
+		std::shared_ptr<IChromeTraceWriter> m_chromeTraceWriter;
 	};
 
 }} // namespace allure::service
@@ -1,24 +1,227 @@
 #include "TestStepEndEventHandler.h"
 
+#include "API/Utils.h"
+#include "Model/StepNameRegistry.h"
 #include "Model/TestProgram.h"
+#include "Services/Metrics/AllocationTracker.h"
+#include "Services/Metrics/IPerfCounterGroup.h"
+#include "Services/Metrics/IOverheadGovernor.h"
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Report/IChromeTraceWriter.h"
 #include "Services/System/ITimeService.h"
 
+#include <algorithm>
+#include <fmt/format.h>
+
 
 namespace allure { namespace service {
 
+	namespace {
+		bool isLeafStep(const model::Step& step)
+		{
+			return (step.getStepCount() == 0) && step.getAttachments().empty() && step.getStatusMessage().empty();
+		}
+
+		bool haveSameName(const model::Step& lhs, const model::Step& rhs)
+		{
+			// Registered names are unique, so static steps compare their ids only
+			if ((lhs.getNameId() != model::StepNameRegistry::NO_NAME) && (rhs.getNameId() != model::StepNameRegistry::NO_NAME))
+			{
+				return lhs.getNameId() == rhs.getNameId();
+			}
+
+			// Formatted names compare their format and arguments, so they are not rendered here
+			if (lhs.hasDeferredName() || rhs.hasDeferredName())
+			{
+				return lhs.getDeferredName() == rhs.getDeferredName();
+			}
+			return lhs.getName() == rhs.getName();
+		}
+
+		bool areCoalescible(const model::Step& lhs, const model::Step& rhs)
+		{
+			return isLeafStep(lhs) && isLeafStep(rhs) &&
+				   (lhs.getStepType() == rhs.getStepType()) &&
+				   (lhs.getStatus() == rhs.getStatus()) &&
+				   haveSameName(lhs, rhs) &&
+				   (lhs.getParameters() == rhs.getParameters());
+		}
+
+		void aggregateMetrics(model::Step& target, const model::Step& source)
+		{
+			for (const auto& sourceMetric : source.getMetrics())
+			{
+				auto& targetMetrics = target.getMetrics();
+				auto targetMetric = std::find_if(targetMetrics.begin(), targetMetrics.end(),
+					[&sourceMetric](const model::Metric& metric) { return metric.getName() == sourceMetric.getName(); });
+				if (targetMetric != targetMetrics.end())
+				{
+					targetMetric->aggregate(sourceMetric.getValue());
+				}
+				else
+				{
+					target.addMetric(sourceMetric);
+				}
+			}
+		}
+
+		// Merges the just-finished last step of the container with its identical predecessors
+		template<typename StepContainer>
+		unsigned int coalesceLastStep(StepContainer& container, unsigned int threshold)
+		{
+			unsigned int nSteps = container.getStepCount();
+			if ((threshold < 2) || (nSteps < 2))
+			{
+				return 0;
+			}
+
+			model::Step& lastStep = *container.getStep(nSteps - 1);
+			model::Step& previousStep = *container.getStep(nSteps - 2);
+			if (previousStep.isCoalesced())
+			{
+				if (areCoalescible(previousStep, lastStep))
+				{
+					previousStep.getStatistics().addDuration(lastStep.getDurationNs());
+					previousStep.setStop(lastStep.getStop());
+					previousStep.setDurationNs(previousStep.getDurationNs() + lastStep.getDurationNs());
+					aggregateMetrics(previousStep, lastStep);
+					container.removeLastSteps(1);
+					return 1;
+				}
+				return 0;
+			}
+
+			// Look back only as far as needed to reach the threshold
+			unsigned int runLength = 1;
+			while ((runLength < threshold) && (runLength < nSteps))
+			{
+				const model::Step& candidate = *container.getStep(nSteps - 1 - runLength);
+				if (candidate.isCoalesced() || !areCoalescible(candidate, lastStep))
+				{
+					break;
+				}
+				runLength++;
+			}
+
+			if (runLength < threshold)
+			{
+				return 0;
+			}
+
+			model::Step& firstStep = *container.getStep(nSteps - runLength);
+			uint64_t totalDurationNs = 0;
+			for (unsigned int i = nSteps - runLength; i < nSteps; i++)
+			{
+				const model::Step& step = *container.getStep(i);
+				firstStep.getStatistics().addDuration(step.getDurationNs());
+				totalDurationNs += step.getDurationNs();
+				if (i > nSteps - runLength)
+				{
+					aggregateMetrics(firstStep, step);
+				}
+			}
+			firstStep.setStop(lastStep.getStop());
+			firstStep.setDurationNs(totalDurationNs);
+			container.removeLastSteps(runLength - 1);
+			return runLength - 1;
+		}
+	}
+
 	TestStepEndEventHandler::TestStepEndEventHandler(model::TestProgram& testProgram,
-													 std::unique_ptr<ITimeService> timeService)
+													 std::unique_ptr<ITimeService> timeService,
+													 std::shared_ptr<IPerfCounterGroup> perfCounterGroup,
+													 std::shared_ptr<IAllocationTracker> allocationTracker,
+													 std::shared_ptr<IChromeTraceWriter> chromeTraceWriter,
+													 std::shared_ptr<IOverheadGovernor> overheadGovernor)
 		:m_testProgram(testProgram)
 		,m_timeService(std::move(timeService))
+		,m_perfCounterGroup(std::move(perfCounterGroup))
+		,m_allocationTracker(std::move(allocationTracker))
+		,m_chromeTraceWriter(std::move(chromeTraceWriter))
+		,m_overheadGovernor(std::move(overheadGovernor))
 	{
 	}
 
 	void TestStepEndEventHandler::handleTestStepEnd(model::Status status) const
 	{
+		handleTestStepEnd(status, model::StepBudget());
+	}
+
+	void TestStepEndEventHandler::handleTestStepEnd(model::Status status, const model::StepBudget& budget) const
+	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		AllocationTracker::Pause allocationPause;
+
+		// Steps dropped by the start handler have no model counterpart to finish
+		auto& testCase = getRunningTestCase();
+		if (testCase.getOpenDroppedStepCount() > 0)
+		{
+			testCase.setOpenDroppedStepCount(testCase.getOpenDroppedStepCount() - 1);
+			return;
+		}
+
 		model::Step& step = getRunningTestStep();
+		for (const auto& metric : m_perfCounterGroup->endStep())
+		{
+			step.addMetric(metric);
+		}
+
+		IAllocationTracker::Usage allocationUsage = m_allocationTracker->endStep();
+		if (m_allocationTracker->isEnabled() && m_allocationTracker->isHooked())
+		{
+			step.addMetric(model::Metric("allocations", allocationUsage.allocations));
+			step.addMetric(model::Metric("bytes allocated", allocationUsage.bytesAllocated));
+			step.addMetric(model::Metric("peak live bytes", allocationUsage.peakLiveBytes, model::Metric::Aggregation::MAX));
+		}
+
+		int64_t stopNs = m_timeService->getMonotonicNanoseconds();
+		step.setDurationNs((stopNs > step.getStartNs()) ? static_cast<uint64_t>(stopNs - step.getStartNs()) : 0);
 		step.setStop(m_timeService->getCurrentTime());
 		step.setStage(model::Stage::FINISHED);
 		step.setStatus(status);
+		if (budget.budgetNs > 0)
+		{
+			checkStepBudget(testCase, step, budget);
+		}
+		m_chromeTraceWriter->writeStep(step);
+
+		// Collapse runs of identical sibling steps (e.g. a step inside a hot loop)
+		unsigned int threshold = m_overheadGovernor->getStepCoalescingThreshold(m_testProgram.getStepCoalescingThreshold());
+		model::Step* parentStep = testCase.getRunningStep();
+		unsigned int removedSteps = (parentStep != nullptr) ? coalesceLastStep(*parentStep, threshold)
+		                                                    : coalesceLastStep(testCase, threshold);
+		testCase.setRecordedStepCount(testCase.getRecordedStepCount() - std::min(removedSteps, testCase.getRecordedStepCount()));
+	}
+
+	void TestStepEndEventHandler::checkStepBudget(model::TestCase& testCase, model::Step& step, const model::StepBudget& budget) const
+	{
+		model::Parameter budgetParameter;
+		budgetParameter.setName("budget");
+		budgetParameter.setValue(detail::formatNanoseconds(static_cast<double>(budget.budgetNs)));
+		budgetParameter.setExcluded(true);
+		step.addParameter(budgetParameter);
+
+		// Coalesced steps keep the slowest duration, the one that matters for the budget
+		step.addMetric(model::Metric("duration (ns)", static_cast<int64_t>(step.getDurationNs()), model::Metric::Aggregation::MAX));
+
+		if (step.getDurationNs() <= budget.budgetNs)
+		{
+			return;
+		}
+
+		double budgetNs = static_cast<double>(budget.budgetNs);
+		double durationNs = static_cast<double>(step.getDurationNs());
+		std::string message = fmt::format("Exceeded budget of {} by {} (took {})", detail::formatNanoseconds(budgetNs),
+										  detail::formatNanoseconds(durationNs - budgetNs), detail::formatNanoseconds(durationNs));
+		step.setStatusMessage(message);
+		if (step.getStatus() == model::Status::PASSED)
+		{
+			step.setStatus(budget.exceededStatus);
+		}
+		if (budget.failTest)
+		{
+			testCase.addBudgetViolation(budget.exceededStatus, "Step \"" + step.getName() + "\": " + message);
+		}
 	}
 
 	model::Step& TestStepEndEventHandler::getRunningTestStep() const
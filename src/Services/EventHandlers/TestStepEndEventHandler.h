@@ -17,23 +17,38 @@ namespace allure { namespace service {
 
 	class ITimeService;
 	class IUUIDGeneratorService;
+	class IPerfCounterGroup;
+	class IAllocationTracker;
+	class IChromeTraceWriter;
+	class IOverheadGovernor;
 
 	class TestStepEndEventHandler : public ITestStepEndEventHandler
 	{
 	public:
-		TestStepEndEventHandler(model::TestProgram&, std::unique_ptr<ITimeService>);
+		TestStepEndEventHandler(model::TestProgram&,
+		                        std::unique_ptr<ITimeService>,
+		                        std::shared_ptr<IPerfCounterGroup>,
+		                        std::shared_ptr<IAllocationTracker>,
+		                        std::shared_ptr<IChromeTraceWriter>,
+		                        std::shared_ptr<IOverheadGovernor>);
 		virtual ~TestStepEndEventHandler() = default;
 
-		void handleTestStepEnd(model::Status) const;
+		void handleTestStepEnd(model::Status) const override;
+		void handleTestStepEnd(model::Status, const model::StepBudget&) const override;
 
 	private:
 		model::Step& getRunningTestStep() const;
 		model::TestCase& getRunningTestCase() const;
 		model::TestSuite& getRunningTestSuite() const;
+		void checkStepBudget(model::TestCase&, model::Step&, const model::StepBudget&) const;
 
 	private:
 		model::TestProgram& m_testProgram;
 		std::unique_ptr<ITimeService> m_timeService;
+		std::shared_ptr<IPerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<IAllocationTracker> m_allocationTracker;
+		std::shared_ptr<IChromeTraceWriter> m_chromeTraceWriter;
+		std::shared_ptr<IOverheadGovernor> m_overheadGovernor;
 	};
 
 }} // namespace allure::service
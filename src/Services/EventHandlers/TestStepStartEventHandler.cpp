@@ -3,27 +3,77 @@
 #include "Model/Action.h"
 #include "Model/ExpectedResult.h"
 #include "Model/TestProgram.h"
+#include "Services/Metrics/AllocationTracker.h"
+#include "Services/Metrics/IPerfCounterGroup.h"
+#include "Services/Metrics/SelfProfiler.h"
 #include "Services/System/ITimeService.h"
 
 
 namespace allure { namespace service {
 
 	TestStepStartEventHandler::TestStepStartEventHandler(model::TestProgram& testProgram,
-														 std::unique_ptr<ITimeService> timeService)
+														 std::unique_ptr<ITimeService> timeService,
+														 std::shared_ptr<IPerfCounterGroup> perfCounterGroup,
+														 std::shared_ptr<IAllocationTracker> allocationTracker)
 		:m_testProgram(testProgram)
 		,m_timeService(std::move(timeService))
+		,m_perfCounterGroup(std::move(perfCounterGroup))
+		,m_allocationTracker(std::move(allocationTracker))
 	{
 	}
 
 	void TestStepStartEventHandler::handleTestStepStart(const std::string& testStepName, bool isAction) const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		AllocationTracker::Pause allocationPause;
+		model::Step* step = startStep(isAction);
+		if (step)
+		{
+			step->setName(testStepName);
+		}
+	}
+
+	void TestStepStartEventHandler::handleTestStepStart(const model::DeferredName& testStepName, bool isAction) const
+	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		AllocationTracker::Pause allocationPause;
+		model::Step* step = startStep(isAction);
+		if (step)
+		{
+			step->setDeferredName(testStepName);
+		}
+	}
+
+	void TestStepStartEventHandler::handleTestStepStart(uint32_t testStepNameId, bool isAction) const
+	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
+		AllocationTracker::Pause allocationPause;
+		model::Step* step = startStep(isAction);
+		if (step)
+		{
+			step->setNameId(testStepNameId);
+		}
+	}
+
+	model::Step* TestStepStartEventHandler::startStep(bool isAction) const
+	{
+		auto& testCase = getRunningTestCase();
+
+		// Past the limits, only count the step (its end event is swallowed as well)
+		if (isOverStepLimits(testCase))
+		{
+			testCase.setDroppedStepCount(testCase.getDroppedStepCount() + 1);
+			testCase.setOpenDroppedStepCount(testCase.getOpenDroppedStepCount() + 1);
+			return nullptr;
+		}
+
 		auto step = buildStep(isAction);
-		step->setName(testStepName);
+		model::Step* startedStep = step.get();
 		step->setStart(m_timeService->getCurrentTime());
+		step->setStartNs(m_timeService->getMonotonicNanoseconds());
 		step->setStage(model::Stage::RUNNING);
 		step->setStatus(model::Status::UNKNOWN);
-
-		auto& testCase = getRunningTestCase();
+		testCase.setRecordedStepCount(testCase.getRecordedStepCount() + 1);
 
 		// Check if there's a running step to nest within
 		model::Step* runningStep = testCase.getRunningStep();
@@ -37,10 +87,48 @@ namespace allure { namespace service {
 			// No running step, add as top-level step to test case
 			testCase.addStep(std::move(step));
 		}
+
+		m_perfCounterGroup->beginStep();
+		m_allocationTracker->beginStep();
+		return startedStep;
+	}
+
+	bool TestStepStartEventHandler::isOverStepLimits(const model::TestCase& testCase) const
+	{
+		if (testCase.getOpenDroppedStepCount() > 0)
+		{
+			return true;
+		}
+
+		unsigned int maxSteps = m_testProgram.getMaxStepsPerTest();
+		if ((maxSteps > 0) && (testCase.getRecordedStepCount() >= maxSteps))
+		{
+			return true;
+		}
+
+		unsigned int maxDepth = m_testProgram.getMaxStepDepth();
+		if (maxDepth > 0)
+		{
+			unsigned int runningDepth = 0;
+			const model::Step* step = (testCase.getStepCount() > 0) ? testCase.getStep(testCase.getStepCount() - 1) : nullptr;
+			while ((step != nullptr) && (step->getStage() == model::Stage::RUNNING))
+			{
+				runningDepth++;
+				step = (step->getStepCount() > 0) ? step->getStep(step->getStepCount() - 1) : nullptr;
+			}
+
+			if (runningDepth >= maxDepth)
+			{
+				return true;
+			}
+		}
+
+		return false;
 	}
 
 	std::unique_ptr<model::Step> TestStepStartEventHandler::buildStep(bool isAction) const
 	{
+		AllocationTracker::Pause allocationPause;
 		if (isAction)
 		{
 			return std::make_unique<model::Action>();
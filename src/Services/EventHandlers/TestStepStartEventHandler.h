@@ -16,15 +16,21 @@ namespace allure { namespace model {
 namespace allure { namespace service {
 
 	class ITimeService;
+	class IPerfCounterGroup;
+	class IAllocationTracker;
 
 	class TestStepStartEventHandler : public ITestStepStartEventHandler
 	{
 	public:
 		TestStepStartEventHandler(model::TestProgram&,
-								  std::unique_ptr<ITimeService>);
+								  std::unique_ptr<ITimeService>,
+								  std::shared_ptr<IPerfCounterGroup>,
+								  std::shared_ptr<IAllocationTracker>);
 		virtual ~TestStepStartEventHandler() = default;
 
 		void handleTestStepStart(const std::string& testStepDescription, bool isAction) const override;
+		void handleTestStepStart(const model::DeferredName& testStepDescription, bool isAction) const override;
+		void handleTestStepStart(uint32_t testStepNameId, bool isAction) const override;
 
 	public:
 		struct NoRunningTestSuiteException : std::runtime_error
@@ -42,6 +48,8 @@ namespace allure { namespace service {
 		};
 
 	private:
+		model::Step* startStep(bool isAction) const;
+		bool isOverStepLimits(const model::TestCase&) const;
 		std::unique_ptr<model::Step> buildStep(bool isAction) const;
 		model::TestCase& getRunningTestCase() const;
 		model::TestSuite& getRunningTestSuite() const;
@@ -49,6 +57,8 @@ namespace allure { namespace service {
 	private:
 		model::TestProgram& m_testProgram;
 		std::unique_ptr<ITimeService> m_timeService;
+		std::shared_ptr<IPerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<IAllocationTracker> m_allocationTracker;
 	};
 
 }} // namespace allure::service
@@ -2,7 +2,9 @@
 
 #include "Model/TestProgram.h"
 #include "Model/Container.h"
+#include "Services/Metrics/SelfProfiler.h"
 #include "Services/System/ITimeService.h"
+#include "Services/Report/IChromeTraceWriter.h"
 #include "Services/Report/IContainerJSONSerializer.h"
 #include "Services/System/IFileService.h"
 
@@ -20,22 +22,28 @@ namespace allure { namespace service {
 	TestSuiteEndEventHandler::TestSuiteEndEventHandler(model::TestProgram& testProgram,
 													   std::unique_ptr<ITimeService> timeService,
 													   std::unique_ptr<IContainerJSONSerializer> containerJSONSerializer,
-													   std::unique_ptr<IFileService> fileService)
+													   std::unique_ptr<IFileService> fileService,
+													   std::shared_ptr<IChromeTraceWriter> chromeTraceWriter)
 		:m_testProgram(testProgram)
 		,m_timeService(std::move(timeService))
 		,m_containerJSONSerializer(std::move(containerJSONSerializer))
 		,m_fileService(std::move(fileService))
+		,m_chromeTraceWriter(std::move(chromeTraceWriter))
 	{
 	}
 
 	void TestSuiteEndEventHandler::handleTestSuiteEnd(model::Status status) const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
 		model::TestSuite& testSuite = getRunningTestSuite();
 		testSuite.setStop(m_timeService->getCurrentTime());
 		testSuite.setStage(model::Stage::FINISHED);
 		testSuite.setStatus(status);
 		addTMSLink(testSuite);
 
+		int64_t stopNs = m_timeService->getMonotonicNanoseconds();
+		m_chromeTraceWriter->writeTestSuite(testSuite, (stopNs > testSuite.getStartNs()) ? static_cast<uint64_t>(stopNs - testSuite.getStartNs()) : 0);
+
 		// Write container JSON immediately after suite completes
 		writeContainerJSON(testSuite);
 
@@ -16,6 +16,7 @@ namespace allure { namespace service {
 	class IUUIDGeneratorService;
 	class IContainerJSONSerializer;
 	class IFileService;
+	class IChromeTraceWriter;
 
 	class TestSuiteEndEventHandler : public ITestSuiteEndEventHandler
 	{
@@ -23,7 +24,8 @@ namespace allure { namespace service {
 		TestSuiteEndEventHandler(model::TestProgram&,
 								 std::unique_ptr<ITimeService>,
 								 std::unique_ptr<IContainerJSONSerializer>,
-								 std::unique_ptr<IFileService>);
+								 std::unique_ptr<IFileService>,
+								 std::shared_ptr<IChromeTraceWriter>);
 		virtual ~TestSuiteEndEventHandler() = default;
 
 		void handleTestSuiteEnd(model::Status) const override;
@@ -38,6 +40,7 @@ namespace allure { namespace service {
 		std::unique_ptr<ITimeService> m_timeService;
 		std::unique_ptr<IContainerJSONSerializer> m_containerJSONSerializer;
 		std::unique_ptr<IFileService> m_fileService;
+		std::shared_ptr<IChromeTraceWriter> m_chromeTraceWriter;
 	};
 
 }} // namespace allure::service
@@ -1,6 +1,7 @@
 #include "TestSuiteStartEventHandler.h"
 
 #include "Model/TestProgram.h"
+#include "Services/Metrics/SelfProfiler.h"
 #include "Services/Report/ITestSuiteJSONSerializer.h"
 #include "Services/System/IFileService.h"
 #include "Services/System/ITimeService.h"
@@ -37,6 +38,7 @@ namespace allure { namespace service {
 
 	void TestSuiteStartEventHandler::handleTestSuiteStart(const std::string& testSuiteName) const
 	{
+		ALLURE_PROFILE_SCOPE(EVENT_HANDLERS);
 		model::TestSuite testSuite;
 		std::string uuid = m_uuidGeneratorService->generateUUID();
 
@@ -54,6 +56,7 @@ namespace allure { namespace service {
 		testSuite.setTestCaseId(stableId);
 
 		testSuite.setStart(m_timeService->getCurrentTime());
+		testSuite.setStartNs(m_timeService->getMonotonicNanoseconds());
 		testSuite.setStage(model::Stage::RUNNING);
 		testSuite.setStatus(model::Status::UNKNOWN);
 
@@ -9,11 +9,22 @@ namespace testing { class TestEventListener; }
 
 namespace allure { namespace service {
 
+	class IAllocationTracker;
+	class IChromeTraceWriter;
+	class IDurationBaselineStore;
 	class IFileService;
+	class IFlameGraphBuilder;
 	class IGTestStatusChecker;
+	class ILogRingBuffer;
+	class IOutputCapture;
+	class IOverheadGovernor;
+	class IPerfCounterGroup;
+	class IResourceUsageMonitor;
+	class ISelfProfiler;
 	class ITestCaseEndEventHandler;
 	class ITestCasePropertySetter;
 	class ITestCaseStartEventHandler;
+	class ITestMetricRegistry;
 	class ITestProgramEndEventHandler;
 	class ITestProgramStartEventHandler;
 	class ITestProgramJSONBuilder;
@@ -59,6 +70,19 @@ namespace allure { namespace service {
 		virtual std::unique_ptr<IUUIDGeneratorService> buildUUIDGeneratorService() const = 0;
 		virtual std::unique_ptr<IFileService> buildFileService() const = 0;
 		virtual std::unique_ptr<ITimeService> buildTimeService() const = 0;
+
+		// Shared services (every call returns the same instance, so handlers and API share its state)
+		virtual std::shared_ptr<ILogRingBuffer> buildLogRingBuffer() const = 0;
+		virtual std::shared_ptr<IOutputCapture> buildOutputCapture() const = 0;
+		virtual std::shared_ptr<IResourceUsageMonitor> buildResourceUsageMonitor() const = 0;
+		virtual std::shared_ptr<IPerfCounterGroup> buildPerfCounterGroup() const = 0;
+		virtual std::shared_ptr<IAllocationTracker> buildAllocationTracker() const = 0;
+		virtual std::shared_ptr<IDurationBaselineStore> buildDurationBaselineStore() const = 0;
+		virtual std::shared_ptr<ITestMetricRegistry> buildTestMetricRegistry() const = 0;
+		virtual std::shared_ptr<IChromeTraceWriter> buildChromeTraceWriter() const = 0;
+		virtual std::shared_ptr<IFlameGraphBuilder> buildFlameGraphBuilder() const = 0;
+		virtual std::shared_ptr<ISelfProfiler> buildSelfProfiler() const = 0;
+		virtual std::shared_ptr<IOverheadGovernor> buildOverheadGovernor() const = 0;
 	};
 
 }} // namespace allure::service
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+
+namespace allure { namespace service {
+
+	class ILogRingBuffer
+	{
+	public:
+		virtual ~ILogRingBuffer() = default;
+
+		virtual size_t getCapacity() const = 0;
+		virtual void setCapacity(size_t) = 0;
+
+		virtual bool isEnabled() const = 0;
+		virtual bool isEmpty() const = 0;
+
+		virtual void append(std::string_view) = 0;
+		virtual std::string getContent() const = 0;
+		virtual void reset() = 0;
+	};
+
+}} // namespace allure::service
@@ -0,0 +1,91 @@
+#include "LogRingBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace allure { namespace service {
+
+	LogRingBuffer::LogRingBuffer(size_t capacity)
+		:m_data()
+		,m_capacity(0)
+		,m_head(0)
+	{
+		setCapacity(capacity);
+	}
+
+	size_t LogRingBuffer::getCapacity() const
+	{
+		return m_capacity;
+	}
+
+	void LogRingBuffer::setCapacity(size_t capacity)
+	{
+		m_data = (capacity > 0) ? std::make_unique<char[]>(capacity) : nullptr;
+		m_capacity = capacity;
+		m_head.store(0, std::memory_order_release);
+	}
+
+	bool LogRingBuffer::isEnabled() const
+	{
+		return m_capacity > 0;
+	}
+
+	bool LogRingBuffer::isEmpty() const
+	{
+		return m_head.load(std::memory_order_acquire) == 0;
+	}
+
+	void LogRingBuffer::append(std::string_view text)
+	{
+		if (text.empty() || (m_capacity == 0))
+		{
+			return;
+		}
+
+		// Only the tail of an oversized message can survive anyway
+		if (text.size() > m_capacity)
+		{
+			text.remove_prefix(text.size() - m_capacity);
+		}
+
+		const uint64_t start = m_head.fetch_add(text.size(), std::memory_order_acq_rel);
+		const size_t offset = static_cast<size_t>(start % m_capacity);
+		const size_t firstChunk = std::min(text.size(), m_capacity - offset);
+		std::memcpy(m_data.get() + offset, text.data(), firstChunk);
+		if (firstChunk < text.size())
+		{
+			std::memcpy(m_data.get(), text.data() + firstChunk, text.size() - firstChunk);
+		}
+	}
+
+	std::string LogRingBuffer::getContent() const
+	{
+		const uint64_t head = m_head.load(std::memory_order_acquire);
+		if (head <= m_capacity)
+		{
+			return std::string(m_data.get(), static_cast<size_t>(head));
+		}
+
+		const size_t offset = static_cast<size_t>(head % m_capacity);
+		std::string content;
+		content.reserve(m_capacity);
+		content.append(m_data.get() + offset, m_capacity - offset);
+		content.append(m_data.get(), offset);
+
+		// Oldest line was partially overwritten, so drop it
+		size_t firstLineEnd = content.find('\n');
+		if ((firstLineEnd != std::string::npos) && (firstLineEnd + 1 < content.size()))
+		{
+			content.erase(0, firstLineEnd + 1);
+		}
+
+		return "[... " + std::to_string(head - content.size()) + " earlier bytes dropped ...]\n" + content;
+	}
+
+	void LogRingBuffer::reset()
+	{
+		m_head.store(0, std::memory_order_release);
+	}
+
+}} // namespace allure::service
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "ILogRingBuffer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Fixed-capacity byte ring buffer backing allure::log().
+	 *
+	 * Writers reserve space with a single atomic fetch_add and copy their bytes
+	 * in place, so appending never locks nor allocates. When the buffer wraps,
+	 * the oldest bytes are overwritten. Reading and resetting are expected to
+	 * happen while no writer is active (i.e. at test case start/end).
+	 */
+	class LogRingBuffer : public ILogRingBuffer
+	{
+	public:
+		static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+		explicit LogRingBuffer(size_t capacity = DEFAULT_CAPACITY);
+		virtual ~LogRingBuffer() = default;
+
+		size_t getCapacity() const override;
+		void setCapacity(size_t) override;
+
+		bool isEnabled() const override;
+		bool isEmpty() const override;
+
+		void append(std::string_view) override;
+		std::string getContent() const override;
+		void reset() override;
+
+	private:
+		std::unique_ptr<char[]> m_data;
+		size_t m_capacity;
+		std::atomic<uint64_t> m_head;
+	};
+
+}} // namespace allure::service
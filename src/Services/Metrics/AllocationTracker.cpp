@@ -0,0 +1,174 @@
+#include "AllocationTracker.h"
+
+#include "SelfProfiler.h"
+
+#include <algorithm>
+#include <type_traits>
+
+
+namespace allure { namespace service {
+
+	namespace {
+		thread_local unsigned int pauseDepth = 0;
+
+		// Tracker constructed at compile time: usable from hooks before main() and after exit()
+		AllocationTracker tracker;
+		static_assert(std::is_trivially_destructible<AllocationTracker>::value, "AllocationTracker must outlive the allocation hooks");
+	}
+
+	AllocationTracker::Pause::Pause()
+	{
+		pauseDepth++;
+	}
+
+	AllocationTracker::Pause::~Pause()
+	{
+		pauseDepth--;
+	}
+
+	bool AllocationTracker::isEnabled() const
+	{
+		return m_enabled.load(std::memory_order_relaxed);
+	}
+
+	void AllocationTracker::setEnabled(bool enabled)
+	{
+		m_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	bool AllocationTracker::isHooked() const
+	{
+		return m_hooked.load(std::memory_order_relaxed);
+	}
+
+	void AllocationTracker::setHooked(bool hooked)
+	{
+		m_hooked.store(hooked, std::memory_order_relaxed);
+	}
+
+	bool AllocationTracker::recordAllocation(size_t requestedBytes, size_t usableBytes)
+	{
+		// Paused allocations are Allure's own work
+		if (pauseDepth > 0)
+		{
+			ALLURE_PROFILE_ALLOCATION(requestedBytes);
+			return false;
+		}
+
+		if (!m_enabled.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		m_allocations.fetch_add(1, std::memory_order_relaxed);
+		m_bytesAllocated.fetch_add(static_cast<int64_t>(requestedBytes), std::memory_order_relaxed);
+		int64_t liveBytes = m_liveBytes.fetch_add(static_cast<int64_t>(usableBytes), std::memory_order_relaxed) + static_cast<int64_t>(usableBytes);
+
+		int64_t peakLiveBytes = m_peakLiveBytes.load(std::memory_order_relaxed);
+		while ((liveBytes > peakLiveBytes) &&
+			   !m_peakLiveBytes.compare_exchange_weak(peakLiveBytes, liveBytes, std::memory_order_relaxed))
+		{
+		}
+		return true;
+	}
+
+	void AllocationTracker::recordDeallocation(size_t usableBytes)
+	{
+		if ((pauseDepth > 0) || !m_enabled.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		// The block may not have been counted (e.g. allocated while paused): never go below zero
+		int64_t liveBytes = m_liveBytes.load(std::memory_order_relaxed);
+		while (!m_liveBytes.compare_exchange_weak(liveBytes, std::max<int64_t>(liveBytes - static_cast<int64_t>(usableBytes), 0),
+												  std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void AllocationTracker::recordCountedDeallocation(size_t usableBytes)
+	{
+		// Whatever the state now, the allocation of the block was counted
+		m_liveBytes.fetch_sub(static_cast<int64_t>(usableBytes), std::memory_order_relaxed);
+	}
+
+	void AllocationTracker::beginTest()
+	{
+		m_scopeDepth = 0;
+		pushScope();
+	}
+
+	AllocationTracker::Usage AllocationTracker::endTest()
+	{
+		// Steps left open (e.g. by an exception) are closed along with the test
+		Usage usage;
+		while (m_scopeDepth > 0)
+		{
+			usage = popScope();
+		}
+		return usage;
+	}
+
+	void AllocationTracker::beginStep()
+	{
+		if (m_scopeDepth > 0)
+		{
+			pushScope();
+		}
+	}
+
+	AllocationTracker::Usage AllocationTracker::endStep()
+	{
+		return (m_scopeDepth > 1) ? popScope() : Usage();
+	}
+
+	bool AllocationTracker::isPaused()
+	{
+		return pauseDepth > 0;
+	}
+
+	AllocationTracker& AllocationTracker::instance()
+	{
+		return tracker;
+	}
+
+	void AllocationTracker::pushScope()
+	{
+		int64_t liveBytes = m_liveBytes.load(std::memory_order_relaxed);
+		if (m_scopeDepth < MAX_SCOPE_DEPTH)
+		{
+			Scope& scope = m_scopes[m_scopeDepth];
+			scope.allocations = m_allocations.load(std::memory_order_relaxed);
+			scope.bytesAllocated = m_bytesAllocated.load(std::memory_order_relaxed);
+			scope.liveBytes = liveBytes;
+			scope.outerPeakLiveBytes = m_peakLiveBytes.load(std::memory_order_relaxed);
+		}
+		m_scopeDepth++;
+
+		// The peak seen by the new scope starts from what is live right now
+		m_peakLiveBytes.store(liveBytes, std::memory_order_relaxed);
+	}
+
+	AllocationTracker::Usage AllocationTracker::popScope()
+	{
+		m_scopeDepth--;
+		if (m_scopeDepth >= MAX_SCOPE_DEPTH)
+		{
+			return Usage();
+		}
+
+		const Scope& scope = m_scopes[m_scopeDepth];
+		int64_t peakLiveBytes = m_peakLiveBytes.load(std::memory_order_relaxed);
+
+		Usage usage;
+		usage.allocations = m_allocations.load(std::memory_order_relaxed) - scope.allocations;
+		usage.bytesAllocated = m_bytesAllocated.load(std::memory_order_relaxed) - scope.bytesAllocated;
+		usage.peakLiveBytes = std::max<int64_t>(peakLiveBytes - scope.liveBytes, 0);
+
+		// The enclosing scope saw this peak as well
+		m_peakLiveBytes.store(std::max(peakLiveBytes, scope.outerPeakLiveBytes), std::memory_order_relaxed);
+		return usage;
+	}
+
+}} // namespace allure::service
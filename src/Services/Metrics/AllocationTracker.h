@@ -0,0 +1,106 @@
+#pragma once
+
+#include "IAllocationTracker.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Counts heap allocations made while each test case and step runs.
+	 *
+	 * Allocations are reported by hooks (the global operator new/delete
+	 * replacements built with ALLURE_TRACK_ALLOCATIONS, or the counting
+	 * allocator the CppUTest adapter chains in front of CppUTest's own) and
+	 * recorded with relaxed atomics, so allocations of every thread count.
+	 * Allocations made by Allure itself happen inside a Pause and are ignored.
+	 *
+	 * A block may be freed in another state than it was allocated in (paused,
+	 * disabled or before the hooks were installed). Hooks that remember whether
+	 * the allocation was counted report its release with
+	 * recordCountedDeallocation(), so live bytes stay exact. Hooks that cannot
+	 * tell use recordDeallocation(): frees are then ignored while paused and
+	 * live bytes never drop below zero.
+	 *
+	 * The tracker is constant-initialized and trivially destructible, so the
+	 * hooks can use it during static initialization and destruction. They
+	 * reach it through instance(), since they run before any services
+	 * factory exists; everything else gets it from the services factory.
+	 */
+	class AllocationTracker : public IAllocationTracker
+	{
+	public:
+		/**
+		 * Excludes the allocations of the current thread while in scope.
+		 */
+		class Pause
+		{
+		public:
+			Pause();
+			~Pause();
+
+			Pause(const Pause&) = delete;
+			Pause& operator= (const Pause&) = delete;
+		};
+
+		static constexpr size_t MAX_SCOPE_DEPTH = 66;
+
+		constexpr AllocationTracker()
+			:m_enabled(false)
+			,m_hooked(false)
+			,m_allocations(0)
+			,m_bytesAllocated(0)
+			,m_liveBytes(0)
+			,m_peakLiveBytes(0)
+			,m_scopes()
+			,m_scopeDepth(0)
+		{
+		}
+
+		bool isEnabled() const override;
+		void setEnabled(bool) override;
+
+		bool isHooked() const override;
+		void setHooked(bool) override;
+
+		bool recordAllocation(size_t requestedBytes, size_t usableBytes) override;
+		void recordDeallocation(size_t usableBytes) override;
+		void recordCountedDeallocation(size_t usableBytes) override;
+
+		void beginTest() override;
+		Usage endTest() override;
+
+		void beginStep() override;
+		Usage endStep() override;
+
+		static bool isPaused();
+		static AllocationTracker& instance();
+
+	private:
+		struct Scope
+		{
+			int64_t allocations;
+			int64_t bytesAllocated;
+			int64_t liveBytes;
+			int64_t outerPeakLiveBytes;
+		};
+
+		void pushScope();
+		Usage popScope();
+
+	private:
+		std::atomic<bool> m_enabled;
+		std::atomic<bool> m_hooked;
+		std::atomic<int64_t> m_allocations;
+		std::atomic<int64_t> m_bytesAllocated;
+		std::atomic<int64_t> m_liveBytes;
+		std::atomic<int64_t> m_peakLiveBytes;
+		std::array<Scope, MAX_SCOPE_DEPTH> m_scopes;
+		size_t m_scopeDepth;
+	};
+
+}} // namespace allure::service
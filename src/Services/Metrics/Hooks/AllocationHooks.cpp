@@ -0,0 +1,204 @@
+// Replacements of the global allocation functions feeding AllocationTracker.
+// Only built with ALLURE_TRACK_ALLOCATIONS=ON: a program can replace them only once, so
+// this must stay out of builds where something else (e.g. CppUTest's leak detector) does.
+
+#include "Services/Metrics/AllocationTracker.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+	#include <malloc.h>
+#elif defined(__APPLE__)
+	#include <malloc/malloc.h>
+#else
+	#include <malloc.h>
+#endif
+
+
+namespace {
+
+	using allure::service::AllocationTracker;
+
+	size_t getUsableSize(void* memory)
+	{
+#if defined(_WIN32)
+		return _msize(memory);
+#elif defined(__APPLE__)
+		return malloc_size(memory);
+#else
+		return malloc_usable_size(memory);
+#endif
+	}
+
+	size_t getAlignedUsableSize(void* memory, std::align_val_t alignment)
+	{
+#if defined(_WIN32)
+		return _aligned_msize(memory, static_cast<size_t>(alignment), 0);
+#else
+		(void) alignment;
+		return getUsableSize(memory);
+#endif
+	}
+
+	// Each block starts with a header holding the usable bytes the tracker counted for it (0 if
+	// it was not counted), so its release is balanced whether it is freed paused or not
+	constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
+	size_t getHeaderSize(std::align_val_t alignment)
+	{
+		return std::max(HEADER_SIZE, static_cast<size_t>(alignment));
+	}
+
+	size_t& getCountedBytes(void* memory)
+	{
+		return static_cast<size_t*>(memory)[-1];
+	}
+
+	void* allocate(size_t size) noexcept
+	{
+		if (size > SIZE_MAX - HEADER_SIZE)
+		{
+			return nullptr;
+		}
+
+		void* block = std::malloc(HEADER_SIZE + size);
+		if (block == nullptr)
+		{
+			return nullptr;
+		}
+
+		void* memory = static_cast<char*>(block) + HEADER_SIZE;
+		size_t usableBytes = getUsableSize(block) - HEADER_SIZE;
+		getCountedBytes(memory) = AllocationTracker::instance().recordAllocation(size, usableBytes) ? usableBytes : 0;
+		return memory;
+	}
+
+	void* allocateAligned(size_t size, std::align_val_t alignment) noexcept
+	{
+		size_t alignmentBytes = static_cast<size_t>(alignment);
+		size_t headerSize = getHeaderSize(alignment);
+		if (size > SIZE_MAX - headerSize)
+		{
+			return nullptr;
+		}
+
+		void* block = nullptr;
+#if defined(_WIN32)
+		block = _aligned_malloc(headerSize + size, alignmentBytes);
+#else
+		if (posix_memalign(&block, alignmentBytes, headerSize + size) != 0)
+		{
+			block = nullptr;
+		}
+#endif
+		if (block == nullptr)
+		{
+			return nullptr;
+		}
+
+		void* memory = static_cast<char*>(block) + headerSize;
+		size_t usableBytes = getAlignedUsableSize(block, alignment) - headerSize;
+		getCountedBytes(memory) = AllocationTracker::instance().recordAllocation(size, usableBytes) ? usableBytes : 0;
+		return memory;
+	}
+
+	void deallocate(void* memory) noexcept
+	{
+		if (memory != nullptr)
+		{
+			size_t countedBytes = getCountedBytes(memory);
+			if (countedBytes > 0)
+			{
+				AllocationTracker::instance().recordCountedDeallocation(countedBytes);
+			}
+			std::free(static_cast<char*>(memory) - HEADER_SIZE);
+		}
+	}
+
+	void deallocateAligned(void* memory, std::align_val_t alignment) noexcept
+	{
+		if (memory != nullptr)
+		{
+			size_t countedBytes = getCountedBytes(memory);
+			if (countedBytes > 0)
+			{
+				AllocationTracker::instance().recordCountedDeallocation(countedBytes);
+			}
+			void* block = static_cast<char*>(memory) - getHeaderSize(alignment);
+#if defined(_WIN32)
+			_aligned_free(block);
+#else
+			std::free(block);
+#endif
+		}
+	}
+
+	void* allocateOrThrow(size_t size)
+	{
+		while (true)
+		{
+			void* memory = allocate(size);
+			if (memory != nullptr)
+			{
+				return memory;
+			}
+
+			std::new_handler handler = std::get_new_handler();
+			if (handler == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			handler();
+		}
+	}
+
+	void* allocateAlignedOrThrow(size_t size, std::align_val_t alignment)
+	{
+		while (true)
+		{
+			void* memory = allocateAligned(size, alignment);
+			if (memory != nullptr)
+			{
+				return memory;
+			}
+
+			std::new_handler handler = std::get_new_handler();
+			if (handler == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			handler();
+		}
+	}
+
+	[[maybe_unused]] const bool hooksRegistered = (AllocationTracker::instance().setHooked(true), true);
+}
+
+
+void* operator new(size_t size) { return allocateOrThrow(size); }
+void* operator new[](size_t size) { return allocateOrThrow(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void operator delete(void* memory) noexcept { deallocate(memory); }
+void operator delete[](void* memory) noexcept { deallocate(memory); }
+void operator delete(void* memory, size_t) noexcept { deallocate(memory); }
+void operator delete[](void* memory, size_t) noexcept { deallocate(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { deallocate(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { deallocate(memory); }
+
+void* operator new(size_t size, std::align_val_t alignment) { return allocateAlignedOrThrow(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return allocateAlignedOrThrow(size, alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocateAligned(size, alignment); }
+
+void operator delete(void* memory, std::align_val_t alignment) noexcept { deallocateAligned(memory, alignment); }
+void operator delete[](void* memory, std::align_val_t alignment) noexcept { deallocateAligned(memory, alignment); }
+void operator delete(void* memory, size_t, std::align_val_t alignment) noexcept { deallocateAligned(memory, alignment); }
+void operator delete[](void* memory, size_t, std::align_val_t alignment) noexcept { deallocateAligned(memory, alignment); }
+void operator delete(void* memory, std::align_val_t alignment, const std::nothrow_t&) noexcept { deallocateAligned(memory, alignment); }
+void operator delete[](void* memory, std::align_val_t alignment, const std::nothrow_t&) noexcept { deallocateAligned(memory, alignment); }
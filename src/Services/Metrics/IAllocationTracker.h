@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace allure { namespace service {
+
+	class IAllocationTracker
+	{
+	public:
+		struct Usage
+		{
+			int64_t allocations = 0;
+			int64_t bytesAllocated = 0;
+			int64_t peakLiveBytes = 0;
+		};
+
+		virtual bool isEnabled() const = 0;
+		virtual void setEnabled(bool) = 0;
+
+		virtual bool isHooked() const = 0;
+		virtual void setHooked(bool) = 0;
+
+		virtual bool recordAllocation(size_t requestedBytes, size_t usableBytes) = 0;
+		virtual void recordDeallocation(size_t usableBytes) = 0;
+		virtual void recordCountedDeallocation(size_t usableBytes) = 0;
+
+		virtual void beginTest() = 0;
+		virtual Usage endTest() = 0;
+
+		virtual void beginStep() = 0;
+		virtual Usage endStep() = 0;
+
+	protected:
+		// Not virtual, so that the process-wide tracker stays trivially destructible
+		~IAllocationTracker() = default;
+	};
+
+}} // namespace allure::service
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Model/CaptureLevel.h"
+#include "Model/StepDetailPolicy.h"
+
+#include <cstdint>
+
+
+namespace allure { namespace service {
+
+	class IOverheadGovernor
+	{
+	public:
+		virtual ~IOverheadGovernor() = default;
+
+		virtual bool isEnabled() const = 0;
+		virtual void setEnabled(bool) = 0;
+
+		virtual double getBudget() const = 0;
+		virtual void setBudget(double) = 0;
+
+		virtual unsigned int getWindow() const = 0;
+		virtual void setWindow(unsigned int) = 0;
+
+		virtual model::CaptureLevel getLevel() const = 0;
+		virtual void reset() = 0;
+
+		virtual void beginTest() = 0;
+		virtual void endTest(uint64_t testDurationNs) = 0;
+		virtual void recordTest(uint64_t libraryNs, uint64_t testDurationNs) = 0;
+
+		virtual unsigned int getStepCoalescingThreshold(unsigned int configuredThreshold) const = 0;
+		virtual model::StepDetailPolicy getStepDetailPolicy(model::StepDetailPolicy configuredPolicy) const = 0;
+		virtual bool isDeferringAttachments() const = 0;
+	};
+
+}} // namespace allure::service
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Model/Metric.h"
+#include "Model/PerfCounter.h"
+
+#include <vector>
+
+
+namespace allure { namespace service {
+
+	class IPerfCounterGroup
+	{
+	public:
+		virtual ~IPerfCounterGroup() = default;
+
+		virtual bool isEnabled() const = 0;
+		virtual const std::vector<model::PerfCounter>& getCounters() const = 0;
+		virtual void setCounters(const std::vector<model::PerfCounter>&) = 0;
+
+		virtual bool isPerStep() const = 0;
+		virtual void setPerStep(bool) = 0;
+
+		virtual bool isAvailable() = 0;
+		virtual const std::vector<model::PerfCounter>& getOpenCounters() = 0;
+
+		virtual void beginTest() = 0;
+		virtual std::vector<model::Metric> endTest() = 0;
+
+		virtual void beginStep() = 0;
+		virtual std::vector<model::Metric> endStep() = 0;
+	};
+
+}} // namespace allure::service
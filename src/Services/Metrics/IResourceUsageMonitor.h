@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Resource usage counters of the calling thread (CPU, faults, context
+	 * switches, block I/O) plus the resident set size of the process.
+	 */
+	struct ResourceUsage
+	{
+		int64_t userCpuMicroseconds = 0;
+		int64_t systemCpuMicroseconds = 0;
+		int64_t maxRssKilobytes = 0;
+		int64_t rssKilobytes = 0;
+		int64_t minorFaults = 0;
+		int64_t majorFaults = 0;
+		int64_t voluntaryContextSwitches = 0;
+		int64_t involuntaryContextSwitches = 0;
+		int64_t blockInputOperations = 0;
+		int64_t blockOutputOperations = 0;
+	};
+
+	class IResourceUsageMonitor
+	{
+	public:
+		virtual ~IResourceUsageMonitor() = default;
+
+		virtual bool isEnabled() const = 0;
+		virtual void setEnabled(bool) = 0;
+
+		virtual void beginTest() = 0;
+		virtual ResourceUsage endTest() = 0;
+
+		virtual ResourceUsage sample(bool includeRss = true) = 0;
+
+		virtual uint64_t getMeasuredTestCount() const = 0;
+		virtual uint64_t getTotalOverheadNanoseconds() const = 0;
+	};
+
+}} // namespace allure::service
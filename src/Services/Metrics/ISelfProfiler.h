@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace allure { namespace service {
+
+	class ISelfProfiler
+	{
+	public:
+		enum class Phase
+		{
+			STEP_GUARDS = 0,
+			EVENT_HANDLERS,
+			SERIALIZATION,
+			FILE_IO,
+			UUID_GENERATION,
+			COUNT
+		};
+
+		struct PhaseTotals
+		{
+			uint64_t calls = 0;
+			uint64_t totalNs = 0;
+		};
+
+		struct Totals
+		{
+			std::array<PhaseTotals, static_cast<size_t>(Phase::COUNT)> phases;
+			uint64_t filesWritten = 0;
+			uint64_t bytesWritten = 0;
+			uint64_t allocations = 0;
+			uint64_t bytesAllocated = 0;
+		};
+
+		virtual bool isEnabled() const = 0;
+		virtual void setEnabled(bool) = 0;
+
+		virtual void recordPhase(Phase, uint64_t durationNs) = 0;
+		virtual void recordFileWritten(uint64_t bytes) = 0;
+		virtual void recordAllocation(uint64_t bytes) = 0;
+
+		virtual Totals getTotals() const = 0;
+		virtual uint64_t getTotalNs() const = 0;
+		virtual void reset() = 0;
+
+	protected:
+		// Not virtual, so that the process-wide profiler stays trivially destructible
+		~ISelfProfiler() = default;
+	};
+
+}} // namespace allure::service
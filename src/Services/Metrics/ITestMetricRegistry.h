@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Model/SeriesFormat.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace allure { namespace service {
+
+	static constexpr size_t CACHE_LINE_SIZE = 64;
+
+	struct GaugeSample
+	{
+		int64_t timeNs;
+		double value;
+	};
+
+	/**
+	 * Last value, extremes and sampled time series of a gauge.
+	 *
+	 * set() always stores the value and updates the minimum and maximum (so
+	 * spikes between samples are not lost), and appends a sample once per sampling
+	 * interval. When the series is full, every other sample is dropped and the
+	 * interval doubles, so the series keeps covering the whole test.
+	 */
+	struct alignas(CACHE_LINE_SIZE) GaugeSlot
+	{
+		std::atomic<double> value{0.0};
+		std::atomic<double> minValue{0.0};
+		std::atomic<double> maxValue{0.0};
+		std::atomic<int64_t> nextSampleNs{0};
+		std::atomic<int64_t> intervalNs{0};
+		std::atomic<bool> used{false};
+		std::mutex samplesMutex;
+		std::vector<GaugeSample> samples;
+	};
+
+	class ITestMetricRegistry
+	{
+	public:
+		struct CounterValue
+		{
+			std::string name;
+			int64_t value;
+		};
+
+		struct GaugeSeries
+		{
+			std::string name;
+			double lastValue;
+			double minValue;
+			double maxValue;
+			std::vector<GaugeSample> samples;
+		};
+
+		struct Metrics
+		{
+			std::vector<CounterValue> counters;
+			std::vector<GaugeSeries> gauges;
+			size_t droppedCounters = 0;
+			size_t droppedGauges = 0;
+		};
+
+		virtual ~ITestMetricRegistry() = default;
+
+		virtual bool isTestRunning() const = 0;
+
+		virtual int64_t getSampleIntervalNanoseconds() const = 0;
+		virtual void setSampleIntervalNanoseconds(int64_t) = 0;
+
+		virtual size_t getMaxSamples() const = 0;
+		virtual void setMaxSamples(size_t) = 0;
+
+		virtual model::SeriesFormat getSeriesFormat() const = 0;
+		virtual void setSeriesFormat(model::SeriesFormat) = 0;
+
+		/**
+		 * Slot of the calling thread for a counter, or null when no test runs
+		 * or the test uses all counter names already.
+		 */
+		virtual std::atomic<int64_t>* getCounter(std::string_view name) = 0;
+
+		/**
+		 * Slot of a gauge, or null when no test runs or the test uses all gauge names already.
+		 */
+		virtual GaugeSlot* getGauge(std::string_view name) = 0;
+
+		virtual void setGauge(GaugeSlot& gauge, double value) = 0;
+
+		virtual void beginTest() = 0;
+		virtual Metrics endTest() = 0;
+	};
+
+}} // namespace allure::service
@@ -0,0 +1,183 @@
+#include "OverheadGovernor.h"
+
+#include "ISelfProfiler.h"
+
+#include <algorithm>
+
+
+namespace allure { namespace service {
+
+	OverheadGovernor::OverheadGovernor(std::shared_ptr<ISelfProfiler> selfProfiler)
+		:m_selfProfiler(std::move(selfProfiler))
+		,m_enabled(false)
+		,m_level(static_cast<int>(model::CaptureLevel::FULL))
+		,m_mutex()
+		,m_budget(DEFAULT_BUDGET)
+		,m_window(DEFAULT_WINDOW)
+		,m_samples()
+		,m_windowLibraryNs(0)
+		,m_windowTestNs(0)
+		,m_lastLibraryNs(0)
+		,m_pendingTestNs(0)
+		,m_testPending(false)
+	{
+	}
+
+	bool OverheadGovernor::isEnabled() const
+	{
+		return m_enabled.load(std::memory_order_relaxed);
+	}
+
+	void OverheadGovernor::setEnabled(bool enabled)
+	{
+		m_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	double OverheadGovernor::getBudget() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_budget;
+	}
+
+	void OverheadGovernor::setBudget(double budget)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_budget = (budget > 0.0) ? budget : DEFAULT_BUDGET;
+	}
+
+	unsigned int OverheadGovernor::getWindow() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_window;
+	}
+
+	void OverheadGovernor::setWindow(unsigned int window)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_window = (window > 0) ? window : 1;
+	}
+
+	model::CaptureLevel OverheadGovernor::getLevel() const
+	{
+		if (!isEnabled())
+		{
+			return model::CaptureLevel::FULL;
+		}
+		return static_cast<model::CaptureLevel>(m_level.load(std::memory_order_relaxed));
+	}
+
+	void OverheadGovernor::reset()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		setLevel(model::CaptureLevel::FULL);
+		m_lastLibraryNs = 0;
+		m_pendingTestNs = 0;
+		m_testPending = false;
+	}
+
+	void OverheadGovernor::beginTest()
+	{
+		if (!isEnabled())
+		{
+			return;
+		}
+
+		// Everything Allure did since the previous test started belongs to that test
+		uint64_t libraryNs = m_selfProfiler->getTotalNs();
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_testPending)
+		{
+			addSample(libraryNs - std::min(libraryNs, m_lastLibraryNs), m_pendingTestNs);
+		}
+		m_lastLibraryNs = libraryNs;
+		m_testPending = false;
+	}
+
+	void OverheadGovernor::endTest(uint64_t testDurationNs)
+	{
+		if (!isEnabled())
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_pendingTestNs = testDurationNs;
+		m_testPending = true;
+	}
+
+	void OverheadGovernor::recordTest(uint64_t libraryNs, uint64_t testDurationNs)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		addSample(libraryNs, testDurationNs);
+	}
+
+	unsigned int OverheadGovernor::getStepCoalescingThreshold(unsigned int configuredThreshold) const
+	{
+		if (getLevel() < model::CaptureLevel::COALESCED_STEPS)
+		{
+			return configuredThreshold;
+		}
+		return (configuredThreshold > 0) ? std::min(configuredThreshold, COALESCING_THRESHOLD) : COALESCING_THRESHOLD;
+	}
+
+	model::StepDetailPolicy OverheadGovernor::getStepDetailPolicy(model::StepDetailPolicy configuredPolicy) const
+	{
+		return (getLevel() < model::CaptureLevel::STEPS_ON_FAILURE) ? configuredPolicy : model::StepDetailPolicy::SUMMARY_ON_PASS;
+	}
+
+	bool OverheadGovernor::isDeferringAttachments() const
+	{
+		return getLevel() >= model::CaptureLevel::ATTACHMENTS_ON_FAILURE;
+	}
+
+	std::string OverheadGovernor::getLevelName(model::CaptureLevel level)
+	{
+		switch (level)
+		{
+			case model::CaptureLevel::FULL: return "full";
+			case model::CaptureLevel::COALESCED_STEPS: return "coalesced steps";
+			case model::CaptureLevel::STEPS_ON_FAILURE: return "steps on failure";
+			case model::CaptureLevel::ATTACHMENTS_ON_FAILURE: return "attachments on failure";
+			default: return "unknown";
+		}
+	}
+
+	void OverheadGovernor::addSample(uint64_t libraryNs, uint64_t testDurationNs)
+	{
+		m_samples.emplace_back(libraryNs, testDurationNs);
+		m_windowLibraryNs += libraryNs;
+		m_windowTestNs += testDurationNs;
+		while (m_samples.size() > m_window)
+		{
+			m_windowLibraryNs -= m_samples.front().first;
+			m_windowTestNs -= m_samples.front().second;
+			m_samples.pop_front();
+		}
+
+		if ((m_samples.size() < m_window) || (m_windowTestNs == 0))
+		{
+			return;
+		}
+
+		// Half of the budget as headroom before restoring detail, so the level does not flap
+		double ratio = static_cast<double>(m_windowLibraryNs) / static_cast<double>(m_windowTestNs);
+		int level = m_level.load(std::memory_order_relaxed);
+		if ((ratio > m_budget) && (level < static_cast<int>(model::CaptureLevel::ATTACHMENTS_ON_FAILURE)))
+		{
+			setLevel(static_cast<model::CaptureLevel>(level + 1));
+		}
+		else if ((ratio < m_budget / 2) && (level > static_cast<int>(model::CaptureLevel::FULL)))
+		{
+			setLevel(static_cast<model::CaptureLevel>(level - 1));
+		}
+	}
+
+	void OverheadGovernor::setLevel(model::CaptureLevel level)
+	{
+		m_level.store(static_cast<int>(level), std::memory_order_relaxed);
+		m_samples.clear();
+		m_windowLibraryNs = 0;
+		m_windowTestNs = 0;
+	}
+
+}} // namespace allure::service
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "IOverheadGovernor.h"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+
+namespace allure { namespace service {
+
+	class ISelfProfiler;
+
+	/**
+	 * Lowers the detail captured by Allure when its overhead gets too high.
+	 *
+	 * The library time of each test (from the SelfProfiler, so it needs a build
+	 * with ALLURE_SELF_PROFILING) is compared with the duration of the test over
+	 * a sliding window of the last tests. When the ratio exceeds the budget, the
+	 * capture level goes one step down: steps get coalesced, then step trees of
+	 * passing tests are dropped, then attachments are only kept for failures.
+	 * When the ratio falls below half of the budget, detail goes one step back
+	 * up. The window starts over after every change, so each decision is based
+	 * on tests captured at the current level.
+	 *
+	 * The library time of a test is taken from one test start to the next one,
+	 * so it includes the whole end handler of the test. The level only changes
+	 * when a test starts, and is constant while it runs.
+	 */
+	class OverheadGovernor : public IOverheadGovernor
+	{
+	public:
+		static constexpr double DEFAULT_BUDGET = 0.03;
+		static constexpr unsigned int DEFAULT_WINDOW = 20;
+		static constexpr unsigned int COALESCING_THRESHOLD = 2;
+
+		explicit OverheadGovernor(std::shared_ptr<ISelfProfiler>);
+		virtual ~OverheadGovernor() = default;
+
+		bool isEnabled() const override;
+		void setEnabled(bool) override;
+
+		double getBudget() const override;
+		void setBudget(double) override;
+
+		unsigned int getWindow() const override;
+		void setWindow(unsigned int) override;
+
+		model::CaptureLevel getLevel() const override;
+		void reset() override;
+
+		void beginTest() override;
+		void endTest(uint64_t testDurationNs) override;
+		void recordTest(uint64_t libraryNs, uint64_t testDurationNs) override;
+
+		unsigned int getStepCoalescingThreshold(unsigned int configuredThreshold) const override;
+		model::StepDetailPolicy getStepDetailPolicy(model::StepDetailPolicy configuredPolicy) const override;
+		bool isDeferringAttachments() const override;
+
+		static std::string getLevelName(model::CaptureLevel);
+
+	private:
+		void addSample(uint64_t libraryNs, uint64_t testDurationNs);
+		void setLevel(model::CaptureLevel);
+
+	private:
+		std::shared_ptr<ISelfProfiler> m_selfProfiler;
+		std::atomic<bool> m_enabled;
+		std::atomic<int> m_level;
+		mutable std::mutex m_mutex;
+		double m_budget;
+		unsigned int m_window;
+		std::deque<std::pair<uint64_t, uint64_t>> m_samples;
+		uint64_t m_windowLibraryNs;
+		uint64_t m_windowTestNs;
+		uint64_t m_lastLibraryNs;
+		uint64_t m_pendingTestNs;
+		bool m_testPending;
+	};
+
+}} // namespace allure::service
@@ -0,0 +1,295 @@
+#include "PerfCounterGroup.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+	#include <cstring>
+#endif
+
+
+namespace allure { namespace service {
+
+	namespace {
+		bool isHardwareCounter(model::PerfCounter counter)
+		{
+			return (counter == model::PerfCounter::INSTRUCTIONS) ||
+				   (counter == model::PerfCounter::CYCLES) ||
+				   (counter == model::PerfCounter::CACHE_MISSES) ||
+				   (counter == model::PerfCounter::BRANCH_MISSES);
+		}
+
+#if defined(__linux__)
+		int openCounter(model::PerfCounter counter, int groupFd)
+		{
+			struct perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+
+			switch (counter)
+			{
+				case model::PerfCounter::INSTRUCTIONS:
+					attr.type = PERF_TYPE_HARDWARE;
+					attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+					break;
+				case model::PerfCounter::CYCLES:
+					attr.type = PERF_TYPE_HARDWARE;
+					attr.config = PERF_COUNT_HW_CPU_CYCLES;
+					break;
+				case model::PerfCounter::CACHE_MISSES:
+					attr.type = PERF_TYPE_HARDWARE;
+					attr.config = PERF_COUNT_HW_CACHE_MISSES;
+					break;
+				case model::PerfCounter::BRANCH_MISSES:
+					attr.type = PERF_TYPE_HARDWARE;
+					attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+					break;
+				case model::PerfCounter::TASK_CLOCK:
+					attr.type = PERF_TYPE_SOFTWARE;
+					attr.config = PERF_COUNT_SW_TASK_CLOCK;
+					break;
+				case model::PerfCounter::PAGE_FAULTS:
+					attr.type = PERF_TYPE_SOFTWARE;
+					attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+					break;
+				case model::PerfCounter::CONTEXT_SWITCHES:
+					attr.type = PERF_TYPE_SOFTWARE;
+					attr.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+					break;
+			}
+
+			return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+		}
+#endif
+	}
+
+	PerfCounterGroup::PerfCounterGroup()
+		:m_counters()
+		,m_perStep(false)
+		,m_openAttempted(false)
+		,m_fds()
+		,m_openCounters()
+		,m_testRunning(false)
+		,m_testStart()
+		,m_stepStarts()
+	{
+	}
+
+	PerfCounterGroup::~PerfCounterGroup()
+	{
+		close();
+	}
+
+	bool PerfCounterGroup::isEnabled() const
+	{
+		return !m_counters.empty();
+	}
+
+	const std::vector<model::PerfCounter>& PerfCounterGroup::getCounters() const
+	{
+		return m_counters;
+	}
+
+	void PerfCounterGroup::setCounters(const std::vector<model::PerfCounter>& counters)
+	{
+		close();
+		m_counters = counters;
+	}
+
+	bool PerfCounterGroup::isPerStep() const
+	{
+		return m_perStep;
+	}
+
+	void PerfCounterGroup::setPerStep(bool perStep)
+	{
+		m_perStep = perStep;
+	}
+
+	bool PerfCounterGroup::isAvailable()
+	{
+		return open();
+	}
+
+	const std::vector<model::PerfCounter>& PerfCounterGroup::getOpenCounters()
+	{
+		open();
+		return m_openCounters;
+	}
+
+	void PerfCounterGroup::beginTest()
+	{
+		m_stepStarts.clear();
+		m_testRunning = isEnabled() && open() && read(m_testStart);
+	}
+
+	std::vector<model::Metric> PerfCounterGroup::endTest()
+	{
+		if (!m_testRunning)
+		{
+			return {};
+		}
+
+		m_testRunning = false;
+		m_stepStarts.clear();
+		return buildDelta(m_testStart);
+	}
+
+	void PerfCounterGroup::beginStep()
+	{
+		if (!m_testRunning || !m_perStep)
+		{
+			return;
+		}
+
+		std::vector<uint64_t> start;
+		read(start);
+		m_stepStarts.push_back(std::move(start));
+	}
+
+	std::vector<model::Metric> PerfCounterGroup::endStep()
+	{
+		if (m_stepStarts.empty())
+		{
+			return {};
+		}
+
+		std::vector<model::Metric> delta = buildDelta(m_stepStarts.back());
+		m_stepStarts.pop_back();
+		return delta;
+	}
+
+	std::string PerfCounterGroup::getCounterName(model::PerfCounter counter)
+	{
+		switch (counter)
+		{
+			case model::PerfCounter::INSTRUCTIONS: return "instructions";
+			case model::PerfCounter::CYCLES: return "cycles";
+			case model::PerfCounter::CACHE_MISSES: return "cache misses";
+			case model::PerfCounter::BRANCH_MISSES: return "branch misses";
+			case model::PerfCounter::TASK_CLOCK: return "task clock (ns)";
+			case model::PerfCounter::PAGE_FAULTS: return "page faults";
+			case model::PerfCounter::CONTEXT_SWITCHES: return "context switches";
+		}
+		return "unknown";
+	}
+
+	bool PerfCounterGroup::open()
+	{
+		if (m_openAttempted)
+		{
+			return !m_fds.empty();
+		}
+		m_openAttempted = true;
+
+#if defined(__linux__)
+		std::vector<model::PerfCounter> candidates = m_counters;
+		bool hardwareRequested = std::any_of(candidates.begin(), candidates.end(), isHardwareCounter);
+
+		for (model::PerfCounter counter : candidates)
+		{
+			int fd = openCounter(counter, m_fds.empty() ? -1 : m_fds.front());
+			if (fd >= 0)
+			{
+				m_fds.push_back(fd);
+				m_openCounters.push_back(counter);
+			}
+		}
+
+		// No PMU access: report what the kernel can always count instead
+		bool hardwareOpened = std::any_of(m_openCounters.begin(), m_openCounters.end(), isHardwareCounter);
+		if (hardwareRequested && !hardwareOpened)
+		{
+			const model::PerfCounter fallbacks[] = { model::PerfCounter::TASK_CLOCK, model::PerfCounter::PAGE_FAULTS,
+													 model::PerfCounter::CONTEXT_SWITCHES };
+			for (model::PerfCounter counter : fallbacks)
+			{
+				if (std::find(m_openCounters.begin(), m_openCounters.end(), counter) != m_openCounters.end())
+				{
+					continue;
+				}
+
+				int fd = openCounter(counter, m_fds.empty() ? -1 : m_fds.front());
+				if (fd >= 0)
+				{
+					m_fds.push_back(fd);
+					m_openCounters.push_back(counter);
+				}
+			}
+		}
+#endif
+
+		return !m_fds.empty();
+	}
+
+	void PerfCounterGroup::close()
+	{
+#if defined(__linux__)
+		// Members first, the group leader last
+		for (auto fd = m_fds.rbegin(); fd != m_fds.rend(); ++fd)
+		{
+			::close(*fd);
+		}
+#endif
+		m_fds.clear();
+		m_openCounters.clear();
+		m_openAttempted = false;
+		m_testRunning = false;
+		m_stepStarts.clear();
+	}
+
+	bool PerfCounterGroup::read(std::vector<uint64_t>& values) const
+	{
+		values.assign(m_openCounters.size(), 0);
+
+#if defined(__linux__)
+		// Layout for PERF_FORMAT_GROUP: nr, time_enabled, time_running, value[nr]
+		uint64_t buffer[3 + 16];
+		size_t nCounters = std::min<size_t>(m_openCounters.size(), 16);
+		ssize_t expectedBytes = static_cast<ssize_t>((3 + nCounters) * sizeof(uint64_t));
+		if (m_fds.empty() || (::read(m_fds.front(), buffer, sizeof(buffer)) < expectedBytes))
+		{
+			return false;
+		}
+
+		uint64_t timeEnabled = buffer[1];
+		uint64_t timeRunning = buffer[2];
+		for (size_t i = 0; i < nCounters; i++)
+		{
+			uint64_t value = buffer[3 + i];
+			if ((timeRunning > 0) && (timeRunning < timeEnabled))
+			{
+				value = static_cast<uint64_t>(static_cast<double>(value) * timeEnabled / timeRunning);
+			}
+			values[i] = value;
+		}
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	std::vector<model::Metric> PerfCounterGroup::buildDelta(const std::vector<uint64_t>& start) const
+	{
+		std::vector<uint64_t> end;
+		if (!read(end) || (end.size() != start.size()))
+		{
+			return {};
+		}
+
+		std::vector<model::Metric> metrics;
+		for (size_t i = 0; i < end.size(); i++)
+		{
+			int64_t delta = (end[i] > start[i]) ? static_cast<int64_t>(end[i] - start[i]) : 0;
+			metrics.push_back(model::Metric(getCounterName(m_openCounters[i]), delta));
+		}
+		return metrics;
+	}
+
+}} // namespace allure::service
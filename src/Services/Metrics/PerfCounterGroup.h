@@ -0,0 +1,69 @@
+#pragma once
+
+#include "IPerfCounterGroup.h"
+#include "Model/Metric.h"
+#include "Model/PerfCounter.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Performance counters of the calling thread, read around each test and step.
+	 *
+	 * The configured counters are opened once with perf_event_open() as a single
+	 * group (user space only, so perf_event_paranoid <= 2 is enough) and keep
+	 * running; each test or step reads the whole group with one read() at its
+	 * start and end and reports the difference, scaled when the kernel had to
+	 * multiplex the group. Hardware counters that cannot be opened (VMs, CI
+	 * containers) are dropped and replaced with the task-clock, page-faults and
+	 * context-switches software counters. Linux only; elsewhere nothing is
+	 * reported.
+	 */
+	class PerfCounterGroup : public IPerfCounterGroup
+	{
+	public:
+		PerfCounterGroup();
+		virtual ~PerfCounterGroup();
+
+		bool isEnabled() const override;
+		const std::vector<model::PerfCounter>& getCounters() const override;
+		void setCounters(const std::vector<model::PerfCounter>&) override;
+
+		bool isPerStep() const override;
+		void setPerStep(bool) override;
+
+		bool isAvailable() override;
+		const std::vector<model::PerfCounter>& getOpenCounters() override;
+
+		void beginTest() override;
+		std::vector<model::Metric> endTest() override;
+
+		void beginStep() override;
+		std::vector<model::Metric> endStep() override;
+
+		static std::string getCounterName(model::PerfCounter);
+
+	private:
+		bool open();
+		void close();
+		bool read(std::vector<uint64_t>& values) const;
+		std::vector<model::Metric> buildDelta(const std::vector<uint64_t>& start) const;
+
+	private:
+		std::vector<model::PerfCounter> m_counters;
+		bool m_perStep;
+
+		bool m_openAttempted;
+		std::vector<int> m_fds;
+		std::vector<model::PerfCounter> m_openCounters;
+
+		bool m_testRunning;
+		std::vector<uint64_t> m_testStart;
+		std::vector< std::vector<uint64_t> > m_stepStarts;
+	};
+
+}} // namespace allure::service
@@ -0,0 +1,169 @@
+#include "ResourceUsageMonitor.h"
+
+#include <chrono>
+#include <cstdlib>
+
+#if !defined(_WIN32)
+	#include <fcntl.h>
+	#include <sys/resource.h>
+	#include <unistd.h>
+#endif
+
+
+namespace {
+	uint64_t elapsedNanoseconds(std::chrono::steady_clock::time_point since)
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - since).count());
+	}
+}
+
+
+namespace allure { namespace service {
+
+	ResourceUsageMonitor::ResourceUsageMonitor()
+		:m_enabled(false)
+		,m_testRunning(false)
+		,m_start()
+		,m_statmFd(-1)
+		,m_pageKilobytes(4)
+		,m_measuredTestCount(0)
+		,m_totalOverheadNanoseconds(0)
+	{
+#if !defined(_WIN32)
+		long pageSize = sysconf(_SC_PAGESIZE);
+		m_pageKilobytes = (pageSize > 0) ? (pageSize / 1024) : 4;
+#endif
+	}
+
+	ResourceUsageMonitor::~ResourceUsageMonitor()
+	{
+#if !defined(_WIN32)
+		if (m_statmFd >= 0)
+		{
+			close(m_statmFd);
+		}
+#endif
+	}
+
+	bool ResourceUsageMonitor::isEnabled() const
+	{
+		return m_enabled;
+	}
+
+	void ResourceUsageMonitor::setEnabled(bool enabled)
+	{
+		m_enabled = enabled;
+	}
+
+	void ResourceUsageMonitor::beginTest()
+	{
+		m_testRunning = m_enabled;
+		if (m_testRunning)
+		{
+			auto sampleStart = std::chrono::steady_clock::now();
+			m_start = sample();
+			m_totalOverheadNanoseconds += elapsedNanoseconds(sampleStart);
+		}
+	}
+
+	ResourceUsage ResourceUsageMonitor::endTest()
+	{
+		if (!m_testRunning)
+		{
+			return ResourceUsage();
+		}
+
+		auto sampleStart = std::chrono::steady_clock::now();
+		ResourceUsage end = sample(false);
+		bool faultedPagesIn = (end.minorFaults != m_start.minorFaults) || (end.majorFaults != m_start.majorFaults);
+		end.rssKilobytes = faultedPagesIn ? readRssKilobytes() : m_start.rssKilobytes;
+		m_totalOverheadNanoseconds += elapsedNanoseconds(sampleStart);
+		m_measuredTestCount++;
+		m_testRunning = false;
+
+		ResourceUsage delta;
+		delta.userCpuMicroseconds = end.userCpuMicroseconds - m_start.userCpuMicroseconds;
+		delta.systemCpuMicroseconds = end.systemCpuMicroseconds - m_start.systemCpuMicroseconds;
+		delta.maxRssKilobytes = end.maxRssKilobytes - m_start.maxRssKilobytes;
+		delta.rssKilobytes = end.rssKilobytes - m_start.rssKilobytes;
+		delta.minorFaults = end.minorFaults - m_start.minorFaults;
+		delta.majorFaults = end.majorFaults - m_start.majorFaults;
+		delta.voluntaryContextSwitches = end.voluntaryContextSwitches - m_start.voluntaryContextSwitches;
+		delta.involuntaryContextSwitches = end.involuntaryContextSwitches - m_start.involuntaryContextSwitches;
+		delta.blockInputOperations = end.blockInputOperations - m_start.blockInputOperations;
+		delta.blockOutputOperations = end.blockOutputOperations - m_start.blockOutputOperations;
+		return delta;
+	}
+
+	ResourceUsage ResourceUsageMonitor::sample(bool includeRss)
+	{
+		ResourceUsage usage;
+
+#if !defined(_WIN32)
+	#if defined(RUSAGE_THREAD)
+		const int who = RUSAGE_THREAD;
+	#else
+		const int who = RUSAGE_SELF;
+	#endif
+		struct rusage counters;
+		if (getrusage(who, &counters) == 0)
+		{
+			usage.userCpuMicroseconds = static_cast<int64_t>(counters.ru_utime.tv_sec) * 1000000 + counters.ru_utime.tv_usec;
+			usage.systemCpuMicroseconds = static_cast<int64_t>(counters.ru_stime.tv_sec) * 1000000 + counters.ru_stime.tv_usec;
+			usage.maxRssKilobytes = counters.ru_maxrss;
+			usage.minorFaults = counters.ru_minflt;
+			usage.majorFaults = counters.ru_majflt;
+			usage.voluntaryContextSwitches = counters.ru_nvcsw;
+			usage.involuntaryContextSwitches = counters.ru_nivcsw;
+			usage.blockInputOperations = counters.ru_inblock;
+			usage.blockOutputOperations = counters.ru_oublock;
+		}
+		usage.rssKilobytes = includeRss ? readRssKilobytes() : 0;
+#else
+		(void) includeRss;
+#endif
+
+		return usage;
+	}
+
+	uint64_t ResourceUsageMonitor::getMeasuredTestCount() const
+	{
+		return m_measuredTestCount;
+	}
+
+	uint64_t ResourceUsageMonitor::getTotalOverheadNanoseconds() const
+	{
+		return m_totalOverheadNanoseconds;
+	}
+
+	int64_t ResourceUsageMonitor::readRssKilobytes()
+	{
+#if defined(__linux__)
+		if (m_statmFd < 0)
+		{
+			m_statmFd = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+			if (m_statmFd < 0)
+			{
+				return 0;
+			}
+		}
+
+		// Format: "size resident shared text lib data dt", in pages
+		char buffer[128];
+		ssize_t bytesRead = pread(m_statmFd, buffer, sizeof(buffer) - 1, 0);
+		if (bytesRead <= 0)
+		{
+			return 0;
+		}
+		buffer[bytesRead] = '\0';
+
+		char* field = buffer;
+		std::strtoll(field, &field, 10);
+		return std::strtoll(field, nullptr, 10) * m_pageKilobytes;
+#else
+		return 0;
+#endif
+	}
+
+}} // namespace allure::service
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "IResourceUsageMonitor.h"
+
+#include <cstdint>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Measures the resources consumed by each test case.
+	 *
+	 * beginTest() snapshots getrusage(RUSAGE_THREAD) and /proc/self/statm and
+	 * endTest() returns the difference with a second snapshot. The statm file
+	 * is kept open and re-read with pread(), so a snapshot costs two syscalls.
+	 * When the test thread did not fault any page in, its RSS cannot have
+	 * grown and the end snapshot skips re-reading statm.
+	 * Linux only; on other POSIX systems RUSAGE_SELF is used and the current
+	 * RSS is not available, and on Windows snapshots are all zeros.
+	 */
+	class ResourceUsageMonitor : public IResourceUsageMonitor
+	{
+	public:
+		ResourceUsageMonitor();
+		virtual ~ResourceUsageMonitor();
+
+		bool isEnabled() const override;
+		void setEnabled(bool) override;
+
+		void beginTest() override;
+		ResourceUsage endTest() override;
+
+		ResourceUsage sample(bool includeRss = true) override;
+
+		uint64_t getMeasuredTestCount() const override;
+		uint64_t getTotalOverheadNanoseconds() const override;
+
+	private:
+		int64_t readRssKilobytes();
+
+	private:
+		bool m_enabled;
+		bool m_testRunning;
+		ResourceUsage m_start;
+		int m_statmFd;
+		int64_t m_pageKilobytes;
+		uint64_t m_measuredTestCount;
+		uint64_t m_totalOverheadNanoseconds;
+	};
+
+}} // namespace allure::service
@@ -0,0 +1,184 @@
+#include "SelfProfiler.h"
+
+#include "Services/System/MonotonicTimeService.h"
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <type_traits>
+
+#ifdef _WIN32
+	#define PATH_SEPARATOR "\\"
+#else
+	#define PATH_SEPARATOR "/"
+#endif
+
+
+namespace allure { namespace service {
+
+	namespace {
+		thread_local SelfProfiler::Scope* currentScope = nullptr;
+
+		uint64_t sumPhaseTimes(const SelfProfiler::Totals& totals)
+		{
+			uint64_t totalNs = 0;
+			for (const auto& phase : totals.phases)
+			{
+				totalNs += phase.totalNs;
+			}
+			return totalNs;
+		}
+
+		// Profiler constructed at compile time: usable from hooks before main() and after exit()
+		SelfProfiler profiler;
+		static_assert(std::is_trivially_destructible<SelfProfiler>::value, "SelfProfiler must outlive the allocation hooks");
+	}
+
+	SelfProfiler::Scope::Scope(Phase phase)
+		:m_phase(phase)
+		,m_parent(currentScope)
+		,m_startNs(MonotonicTimeService::readMonotonicNanoseconds(false))
+		,m_selfNs(0)
+	{
+		// The enclosing scope stops being charged while this one runs
+		if (m_parent)
+		{
+			m_parent->m_selfNs += static_cast<uint64_t>(m_startNs - m_parent->m_startNs);
+		}
+		currentScope = this;
+	}
+
+	SelfProfiler::Scope::~Scope()
+	{
+		int64_t stopNs = MonotonicTimeService::readMonotonicNanoseconds(false);
+		profiler.recordPhase(m_phase, m_selfNs + static_cast<uint64_t>(stopNs - m_startNs));
+
+		currentScope = m_parent;
+		if (m_parent)
+		{
+			m_parent->m_startNs = stopNs;
+		}
+	}
+
+	bool SelfProfiler::isEnabled() const
+	{
+		return m_enabled.load(std::memory_order_relaxed);
+	}
+
+	void SelfProfiler::setEnabled(bool enabled)
+	{
+		m_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	void SelfProfiler::recordPhase(Phase phase, uint64_t durationNs)
+	{
+		PhaseCounters& counters = m_phases[static_cast<size_t>(phase)];
+		counters.calls.fetch_add(1, std::memory_order_relaxed);
+		counters.totalNs.fetch_add(durationNs, std::memory_order_relaxed);
+	}
+
+	void SelfProfiler::recordFileWritten(uint64_t bytes)
+	{
+		m_filesWritten.fetch_add(1, std::memory_order_relaxed);
+		m_bytesWritten.fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	void SelfProfiler::recordAllocation(uint64_t bytes)
+	{
+		m_allocations.fetch_add(1, std::memory_order_relaxed);
+		m_bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	SelfProfiler::Totals SelfProfiler::getTotals() const
+	{
+		Totals totals;
+		for (size_t i = 0; i < m_phases.size(); i++)
+		{
+			totals.phases[i].calls = m_phases[i].calls.load(std::memory_order_relaxed);
+			totals.phases[i].totalNs = m_phases[i].totalNs.load(std::memory_order_relaxed);
+		}
+		totals.filesWritten = m_filesWritten.load(std::memory_order_relaxed);
+		totals.bytesWritten = m_bytesWritten.load(std::memory_order_relaxed);
+		totals.allocations = m_allocations.load(std::memory_order_relaxed);
+		totals.bytesAllocated = m_bytesAllocated.load(std::memory_order_relaxed);
+		return totals;
+	}
+
+	uint64_t SelfProfiler::getTotalNs() const
+	{
+		uint64_t totalNs = 0;
+		for (const auto& counters : m_phases)
+		{
+			totalNs += counters.totalNs.load(std::memory_order_relaxed);
+		}
+		return totalNs;
+	}
+
+	void SelfProfiler::reset()
+	{
+		for (auto& counters : m_phases)
+		{
+			counters.calls.store(0, std::memory_order_relaxed);
+			counters.totalNs.store(0, std::memory_order_relaxed);
+		}
+		m_filesWritten.store(0, std::memory_order_relaxed);
+		m_bytesWritten.store(0, std::memory_order_relaxed);
+		m_allocations.store(0, std::memory_order_relaxed);
+		m_bytesAllocated.store(0, std::memory_order_relaxed);
+	}
+
+	const char* SelfProfiler::getPhaseName(Phase phase)
+	{
+		switch (phase)
+		{
+			case Phase::STEP_GUARDS: return "stepGuards";
+			case Phase::EVENT_HANDLERS: return "eventHandlers";
+			case Phase::SERIALIZATION: return "serialization";
+			case Phase::FILE_IO: return "fileIO";
+			case Phase::UUID_GENERATION: return "uuidGeneration";
+			default: return "unknown";
+		}
+	}
+
+	std::string SelfProfiler::formatJSON(const Totals& totals)
+	{
+		nlohmann::ordered_json phases = nlohmann::ordered_json::object();
+		for (size_t i = 0; i < totals.phases.size(); i++)
+		{
+			phases[getPhaseName(static_cast<Phase>(i))] = { { "calls", totals.phases[i].calls }, { "totalNs", totals.phases[i].totalNs } };
+		}
+
+		nlohmann::ordered_json j;
+		j["totalNs"] = sumPhaseTimes(totals);
+		j["phases"] = phases;
+		j["filesWritten"] = totals.filesWritten;
+		j["bytesWritten"] = totals.bytesWritten;
+		j["allocations"] = totals.allocations;
+		j["bytesAllocated"] = totals.bytesAllocated;
+		return j.dump(2);
+	}
+
+	std::string SelfProfiler::formatProperties(const Totals& totals)
+	{
+		std::string properties = fmt::format("AllureOverhead={:.3f} ms\n", sumPhaseTimes(totals) / 1e6);
+		for (size_t i = 0; i < totals.phases.size(); i++)
+		{
+			properties += fmt::format("AllureOverhead.{}={:.3f} ms ({} calls)\n", getPhaseName(static_cast<Phase>(i)),
+									  totals.phases[i].totalNs / 1e6, totals.phases[i].calls);
+		}
+		properties += fmt::format("AllureFilesWritten={}\n", totals.filesWritten);
+		properties += fmt::format("AllureBytesWritten={}\n", totals.bytesWritten);
+		properties += fmt::format("AllureAllocations={}\n", totals.allocations);
+		return properties;
+	}
+
+	std::string SelfProfiler::getFilepath(const std::string& outputFolder)
+	{
+		return outputFolder + PATH_SEPARATOR + "allure-stats.json";
+	}
+
+	SelfProfiler& SelfProfiler::instance()
+	{
+		return profiler;
+	}
+
+}} // namespace allure::service
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "ISelfProfiler.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Accounts for the time and resources spent by Allure itself.
+	 *
+	 * Hot paths of the library are wrapped in ALLURE_PROFILE_SCOPE(phase),
+	 * which only expands to a Scope when built with ALLURE_SELF_PROFILING
+	 * (ALLURE_SELF_PROFILING_ENABLED); otherwise the instrumentation is
+	 * compiled out. Scopes nest: each phase is charged its own (self) time,
+	 * excluding the time of scopes opened inside it, so phase totals add up
+	 * to the total overhead. Files written are counted by FileService and
+	 * allocations made inside an AllocationTracker::Pause (Allure's own work)
+	 * by the allocation hooks, when they are built in. Totals are always
+	 * recorded when built in; being enabled only adds them to the report.
+	 *
+	 * The profiler is constant-initialized and trivially destructible, so the
+	 * allocation hooks can use it during static initialization and destruction.
+	 * Hooks and the profiling macros reach it through instance(); everything
+	 * else gets it from the services factory.
+	 */
+	class SelfProfiler : public ISelfProfiler
+	{
+	public:
+		/**
+		 * Charges the time until destruction to a phase of the calling thread.
+		 */
+		class Scope
+		{
+		public:
+			explicit Scope(Phase);
+			~Scope();
+
+			Scope(const Scope&) = delete;
+			Scope& operator= (const Scope&) = delete;
+
+		private:
+			Phase m_phase;
+			Scope* m_parent;
+			int64_t m_startNs;
+			uint64_t m_selfNs;
+		};
+
+		constexpr SelfProfiler()
+			:m_enabled(false)
+			,m_phases()
+			,m_filesWritten(0)
+			,m_bytesWritten(0)
+			,m_allocations(0)
+			,m_bytesAllocated(0)
+		{
+		}
+
+		bool isEnabled() const override;
+		void setEnabled(bool) override;
+
+		void recordPhase(Phase, uint64_t durationNs) override;
+		void recordFileWritten(uint64_t bytes) override;
+		void recordAllocation(uint64_t bytes) override;
+
+		Totals getTotals() const override;
+		uint64_t getTotalNs() const override;
+		void reset() override;
+
+		static constexpr bool isCompiledIn();
+		static const char* getPhaseName(Phase);
+		static std::string formatJSON(const Totals&);
+		static std::string formatProperties(const Totals&);
+		static std::string getFilepath(const std::string& outputFolder);
+		static SelfProfiler& instance();
+
+	private:
+		struct PhaseCounters
+		{
+			std::atomic<uint64_t> calls{0};
+			std::atomic<uint64_t> totalNs{0};
+		};
+
+	private:
+		std::atomic<bool> m_enabled;
+		std::array<PhaseCounters, static_cast<size_t>(Phase::COUNT)> m_phases;
+		std::atomic<uint64_t> m_filesWritten;
+		std::atomic<uint64_t> m_bytesWritten;
+		std::atomic<uint64_t> m_allocations;
+		std::atomic<uint64_t> m_bytesAllocated;
+	};
+
+	constexpr bool SelfProfiler::isCompiledIn()
+	{
+#ifdef ALLURE_SELF_PROFILING_ENABLED
+		return true;
+#else
+		return false;
+#endif
+	}
+
+}} // namespace allure::service
+
+#ifdef ALLURE_SELF_PROFILING_ENABLED
+	#define ALLURE_PROFILE_SCOPE(phase) \
+		::allure::service::SelfProfiler::Scope allureProfileScope(::allure::service::SelfProfiler::Phase::phase)
+	#define ALLURE_PROFILE_FILE_WRITTEN(bytes) \
+		::allure::service::SelfProfiler::instance().recordFileWritten(bytes)
+	#define ALLURE_PROFILE_ALLOCATION(bytes) \
+		::allure::service::SelfProfiler::instance().recordAllocation(bytes)
+#else
+	#define ALLURE_PROFILE_SCOPE(phase)
+	#define ALLURE_PROFILE_FILE_WRITTEN(bytes)
+	#define ALLURE_PROFILE_ALLOCATION(bytes)
+#endif
@@ -0,0 +1,414 @@
+#include "TestMetricRegistry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fmt/format.h>
+#include <limits>
+#include <nlohmann/json.hpp>
+
+
+namespace allure { namespace service {
+
+	namespace {
+		constexpr int64_t DEFAULT_SAMPLE_INTERVAL_NS = 10 * 1000 * 1000;
+		constexpr size_t DEFAULT_MAX_SAMPLES = 1024;
+		constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+		struct NameCache
+		{
+			std::vector<std::pair<std::string, size_t>> ids;
+
+			size_t find(std::string_view name) const
+			{
+				for (const auto& entry : ids)
+				{
+					if (entry.first == name)
+					{
+						return entry.second;
+					}
+				}
+				return NOT_FOUND;
+			}
+		};
+
+		// Lookups of the calling thread, valid for the registry they were made on
+		// (identified by a serial number, as a new registry may reuse an address)
+		struct ThreadCache
+		{
+			uint64_t registryId = 0;
+			uint64_t testId = 0;
+			NameCache counters;
+			NameCache gauges;
+			std::shared_ptr<void> counterBlock;
+		};
+
+		thread_local ThreadCache threadCache;
+
+		std::atomic<uint64_t> lastRegistryId(0);
+
+		ThreadCache& getThreadCache(uint64_t registryId)
+		{
+			if (threadCache.registryId != registryId)
+			{
+				threadCache = ThreadCache();
+				threadCache.registryId = registryId;
+			}
+			return threadCache;
+		}
+
+		// Names get new ids in each test: lookups cached during an earlier test are forgotten
+		ThreadCache& getThreadCache(uint64_t registryId, uint64_t testId)
+		{
+			ThreadCache& cache = getThreadCache(registryId);
+			if (cache.testId != testId)
+			{
+				cache.testId = testId;
+				cache.counters.ids.clear();
+				cache.gauges.ids.clear();
+			}
+			return cache;
+		}
+
+		int64_t getSteadyNanoseconds()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		std::string quoteCSV(const std::string& field)
+		{
+			if (field.find_first_of(",\"\n") == std::string::npos)
+			{
+				return field;
+			}
+
+			std::string quoted = "\"";
+			for (char c : field)
+			{
+				quoted += (c == '"') ? "\"\"" : std::string(1, c);
+			}
+			return quoted + "\"";
+		}
+	}
+
+	TestMetricRegistry::TestMetricRegistry()
+		:m_registryId(++lastRegistryId)
+		,m_testRunning(false)
+		,m_testId(0)
+		,m_usedCounters(0)
+		,m_testStartNs(0)
+		,m_sampleIntervalNs(DEFAULT_SAMPLE_INTERVAL_NS)
+		,m_maxSamples(DEFAULT_MAX_SAMPLES)
+		,m_seriesFormat(model::SeriesFormat::CSV)
+		,m_mutex()
+		,m_counterNames()
+		,m_gaugeNames()
+		,m_droppedCounterNames()
+		,m_droppedGaugeNames()
+		,m_counterBlocks()
+		,m_gauges(new GaugeSlot[MAX_GAUGES])
+	{
+	}
+
+	TestMetricRegistry::~TestMetricRegistry() = default;
+
+	bool TestMetricRegistry::isTestRunning() const
+	{
+		return m_testRunning.load(std::memory_order_relaxed);
+	}
+
+	int64_t TestMetricRegistry::getSampleIntervalNanoseconds() const
+	{
+		return m_sampleIntervalNs;
+	}
+
+	void TestMetricRegistry::setSampleIntervalNanoseconds(int64_t intervalNs)
+	{
+		m_sampleIntervalNs = std::max<int64_t>(intervalNs, 0);
+	}
+
+	size_t TestMetricRegistry::getMaxSamples() const
+	{
+		return m_maxSamples;
+	}
+
+	void TestMetricRegistry::setMaxSamples(size_t maxSamples)
+	{
+		m_maxSamples = std::max<size_t>(maxSamples, 2);
+	}
+
+	model::SeriesFormat TestMetricRegistry::getSeriesFormat() const
+	{
+		return m_seriesFormat;
+	}
+
+	void TestMetricRegistry::setSeriesFormat(model::SeriesFormat format)
+	{
+		m_seriesFormat = format;
+	}
+
+	std::atomic<int64_t>* TestMetricRegistry::getCounter(std::string_view name)
+	{
+		if (!m_testRunning.load(std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+
+		ThreadCache& cache = getThreadCache(m_registryId, m_testId.load(std::memory_order_relaxed));
+		size_t id = cache.counters.find(name);
+		if (id == NOT_FOUND)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			id = findOrAddName(m_counterNames, MAX_COUNTERS, m_droppedCounterNames, name);
+			cache.counters.ids.emplace_back(std::string(name), id);
+		}
+		if (id == NOT_FOUND)
+		{
+			return nullptr;
+		}
+
+		uint64_t mask = uint64_t(1) << id;
+		if ((m_usedCounters.load(std::memory_order_relaxed) & mask) == 0)
+		{
+			m_usedCounters.fetch_or(mask, std::memory_order_relaxed);
+		}
+		return &getThreadBlock().slots[id].value;
+	}
+
+	GaugeSlot* TestMetricRegistry::getGauge(std::string_view name)
+	{
+		if (!m_testRunning.load(std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+
+		ThreadCache& cache = getThreadCache(m_registryId, m_testId.load(std::memory_order_relaxed));
+		size_t id = cache.gauges.find(name);
+		if (id == NOT_FOUND)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			id = findOrAddName(m_gaugeNames, MAX_GAUGES, m_droppedGaugeNames, name);
+			cache.gauges.ids.emplace_back(std::string(name), id);
+		}
+		if (id == NOT_FOUND)
+		{
+			return nullptr;
+		}
+
+		GaugeSlot& gauge = m_gauges[id];
+		if (!gauge.used.load(std::memory_order_relaxed))
+		{
+			gauge.used.store(true, std::memory_order_relaxed);
+		}
+		return &gauge;
+	}
+
+	void TestMetricRegistry::setGauge(GaugeSlot& gauge, double value)
+	{
+		gauge.value.store(value, std::memory_order_relaxed);
+
+		double minValue = gauge.minValue.load(std::memory_order_relaxed);
+		while ((value < minValue) && !gauge.minValue.compare_exchange_weak(minValue, value, std::memory_order_relaxed))
+		{
+		}
+		double maxValue = gauge.maxValue.load(std::memory_order_relaxed);
+		while ((value > maxValue) && !gauge.maxValue.compare_exchange_weak(maxValue, value, std::memory_order_relaxed))
+		{
+		}
+
+		// One thread per interval wins the right to append a sample
+		int64_t now = getSteadyNanoseconds();
+		int64_t nextSampleNs = gauge.nextSampleNs.load(std::memory_order_relaxed);
+		if ((now >= nextSampleNs) &&
+			gauge.nextSampleNs.compare_exchange_strong(nextSampleNs, now + gauge.intervalNs.load(std::memory_order_relaxed),
+													   std::memory_order_relaxed))
+		{
+			appendSample(gauge, now - m_testStartNs.load(std::memory_order_relaxed), value);
+		}
+	}
+
+	void TestMetricRegistry::beginTest()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (auto& block : m_counterBlocks)
+		{
+			for (auto& slot : block->slots)
+			{
+				slot.value.store(0, std::memory_order_relaxed);
+			}
+		}
+		for (size_t i = 0; i < MAX_GAUGES; i++)
+		{
+			GaugeSlot& gauge = m_gauges[i];
+			std::lock_guard<std::mutex> samplesLock(gauge.samplesMutex);
+			gauge.value.store(0.0, std::memory_order_relaxed);
+			gauge.minValue.store(std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+			gauge.maxValue.store(-std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+			gauge.nextSampleNs.store(0, std::memory_order_relaxed);
+			gauge.intervalNs.store(m_sampleIntervalNs, std::memory_order_relaxed);
+			gauge.used.store(false, std::memory_order_relaxed);
+			gauge.samples.clear();
+		}
+
+		m_counterNames.clear();
+		m_gaugeNames.clear();
+		m_droppedCounterNames.clear();
+		m_droppedGaugeNames.clear();
+		m_testId.fetch_add(1, std::memory_order_relaxed);
+
+		m_usedCounters.store(0, std::memory_order_relaxed);
+		m_testStartNs.store(getSteadyNanoseconds(), std::memory_order_relaxed);
+		m_testRunning.store(true, std::memory_order_release);
+	}
+
+	TestMetricRegistry::Metrics TestMetricRegistry::endTest()
+	{
+		Metrics metrics;
+		if (!m_testRunning.exchange(false))
+		{
+			return metrics;
+		}
+
+		int64_t endNs = getSteadyNanoseconds() - m_testStartNs.load(std::memory_order_relaxed);
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		uint64_t usedCounters = m_usedCounters.load(std::memory_order_relaxed);
+		for (size_t id = 0; id < m_counterNames.size(); id++)
+		{
+			if ((usedCounters & (uint64_t(1) << id)) == 0)
+			{
+				continue;
+			}
+
+			int64_t value = 0;
+			for (const auto& block : m_counterBlocks)
+			{
+				value += block->slots[id].value.load(std::memory_order_relaxed);
+			}
+			metrics.counters.push_back({ m_counterNames[id], value });
+		}
+
+		// Blocks only referenced here belong to threads that have exited
+		m_counterBlocks.erase(std::remove_if(m_counterBlocks.begin(), m_counterBlocks.end(),
+			[](const std::shared_ptr<CounterBlock>& block) { return block.use_count() == 1; }),
+			m_counterBlocks.end());
+
+		for (size_t id = 0; id < m_gaugeNames.size(); id++)
+		{
+			GaugeSlot& gauge = m_gauges[id];
+			if (!gauge.used.load(std::memory_order_relaxed))
+			{
+				continue;
+			}
+
+			double lastValue = gauge.value.load(std::memory_order_relaxed);
+			appendSample(gauge, endNs, lastValue);
+
+			GaugeSeries series;
+			series.name = m_gaugeNames[id];
+			series.lastValue = lastValue;
+			{
+				std::lock_guard<std::mutex> samplesLock(gauge.samplesMutex);
+				series.samples = gauge.samples;
+			}
+
+			// The last value counts too, so a gauge never set reports 0 like its series
+			series.minValue = std::min(gauge.minValue.load(std::memory_order_relaxed), lastValue);
+			series.maxValue = std::max(gauge.maxValue.load(std::memory_order_relaxed), lastValue);
+			metrics.gauges.push_back(std::move(series));
+		}
+
+		metrics.droppedCounters = m_droppedCounterNames.size();
+		metrics.droppedGauges = m_droppedGaugeNames.size();
+
+		return metrics;
+	}
+
+	std::string TestMetricRegistry::formatSeriesCSV(const std::vector<GaugeSeries>& gauges)
+	{
+		std::string csv = "gauge,time_ms,value\n";
+		for (const auto& gauge : gauges)
+		{
+			std::string name = quoteCSV(gauge.name);
+			for (const auto& sample : gauge.samples)
+			{
+				csv += fmt::format("{},{:.3f},{}\n", name, sample.timeNs / 1e6, sample.value);
+			}
+		}
+		return csv;
+	}
+
+	std::string TestMetricRegistry::formatSeriesJSON(const std::vector<GaugeSeries>& gauges)
+	{
+		nlohmann::ordered_json series;
+		series["unit"] = "ms";
+		nlohmann::ordered_json samplesByGauge = nlohmann::ordered_json::object();
+		for (const auto& gauge : gauges)
+		{
+			nlohmann::ordered_json samples = nlohmann::ordered_json::array();
+			for (const auto& sample : gauge.samples)
+			{
+				samples.push_back({ std::round(sample.timeNs / 1e3) / 1e3, sample.value });
+			}
+			samplesByGauge[gauge.name] = samples;
+		}
+		series["gauges"] = samplesByGauge;
+		return series.dump();
+	}
+
+	size_t TestMetricRegistry::findOrAddName(std::vector<std::string>& names, size_t maxNames,
+											 std::unordered_set<std::string>& droppedNames, std::string_view name)
+	{
+		auto it = std::find(names.begin(), names.end(), name);
+		if (it != names.end())
+		{
+			return static_cast<size_t>(it - names.begin());
+		}
+		if (names.size() >= maxNames)
+		{
+			droppedNames.emplace(name);
+			return NOT_FOUND;
+		}
+
+		names.emplace_back(name);
+		return names.size() - 1;
+	}
+
+	TestMetricRegistry::CounterBlock& TestMetricRegistry::getThreadBlock()
+	{
+		ThreadCache& cache = getThreadCache(m_registryId);
+		if (!cache.counterBlock)
+		{
+			auto block = std::make_shared<CounterBlock>();
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_counterBlocks.push_back(block);
+			cache.counterBlock = block;
+		}
+		return *static_cast<CounterBlock*>(cache.counterBlock.get());
+	}
+
+	void TestMetricRegistry::appendSample(GaugeSlot& gauge, int64_t timeNs, double value)
+	{
+		std::lock_guard<std::mutex> lock(gauge.samplesMutex);
+		gauge.samples.push_back({ timeNs, value });
+		if (gauge.samples.size() < m_maxSamples)
+		{
+			return;
+		}
+
+		// Halve the resolution, keeping the first and the latest sample
+		size_t kept = 0;
+		for (size_t i = 0; i < gauge.samples.size(); i += 2)
+		{
+			gauge.samples[kept++] = gauge.samples[i];
+		}
+		if ((gauge.samples.size() % 2) == 0)
+		{
+			gauge.samples[kept++] = gauge.samples.back();
+		}
+		gauge.samples.resize(kept);
+		gauge.intervalNs.store(gauge.intervalNs.load(std::memory_order_relaxed) * 2, std::memory_order_relaxed);
+	}
+
+}} // namespace allure::service
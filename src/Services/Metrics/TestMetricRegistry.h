@@ -0,0 +1,100 @@
+#pragma once
+
+#include "ITestMetricRegistry.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Value of a counter accumulated by one thread, alone on its cache line
+	 * so that threads counting concurrently do not share lines.
+	 */
+	struct alignas(CACHE_LINE_SIZE) CounterSlot
+	{
+		std::atomic<int64_t> value{0};
+	};
+
+	/**
+	 * Counters and gauges recorded by the code under test while a test case runs.
+	 *
+	 * Counter names get an index shared by all threads, given anew for each
+	 * test, so the limits apply per test; names beyond them are counted as
+	 * dropped and reported with the metrics. Each thread adds into
+	 * its own block of cache-line-padded slots, registered once per thread, and
+	 * the blocks are summed at the end of the test. Lookups of the calling
+	 * thread are cached, so only the first use of a name per thread locks.
+	 * Outside of test cases lookups return null and nothing is recorded.
+	 */
+	class TestMetricRegistry : public ITestMetricRegistry
+	{
+	public:
+		static constexpr size_t MAX_COUNTERS = 64;
+		static constexpr size_t MAX_GAUGES = 32;
+
+		TestMetricRegistry();
+		virtual ~TestMetricRegistry();
+
+		bool isTestRunning() const override;
+
+		int64_t getSampleIntervalNanoseconds() const override;
+		void setSampleIntervalNanoseconds(int64_t) override;
+
+		size_t getMaxSamples() const override;
+		void setMaxSamples(size_t) override;
+
+		model::SeriesFormat getSeriesFormat() const override;
+		void setSeriesFormat(model::SeriesFormat) override;
+
+		std::atomic<int64_t>* getCounter(std::string_view name) override;
+		GaugeSlot* getGauge(std::string_view name) override;
+
+		void setGauge(GaugeSlot& gauge, double value) override;
+
+		void beginTest() override;
+		Metrics endTest() override;
+
+		static std::string formatSeriesCSV(const std::vector<GaugeSeries>& gauges);
+		static std::string formatSeriesJSON(const std::vector<GaugeSeries>& gauges);
+
+	private:
+		struct CounterBlock
+		{
+			std::array<CounterSlot, MAX_COUNTERS> slots;
+		};
+
+		size_t findOrAddName(std::vector<std::string>& names, size_t maxNames,
+							 std::unordered_set<std::string>& droppedNames, std::string_view name);
+		CounterBlock& getThreadBlock();
+		void appendSample(GaugeSlot& gauge, int64_t timeNs, double value);
+
+	private:
+		const uint64_t m_registryId;
+		std::atomic<bool> m_testRunning;
+		std::atomic<uint64_t> m_testId;
+		std::atomic<uint64_t> m_usedCounters;
+		std::atomic<int64_t> m_testStartNs;
+		int64_t m_sampleIntervalNs;
+		size_t m_maxSamples;
+		model::SeriesFormat m_seriesFormat;
+
+		std::mutex m_mutex;
+		std::vector<std::string> m_counterNames;
+		std::vector<std::string> m_gaugeNames;
+		std::unordered_set<std::string> m_droppedCounterNames;
+		std::unordered_set<std::string> m_droppedGaugeNames;
+		std::vector<std::shared_ptr<CounterBlock>> m_counterBlocks;
+		std::unique_ptr<GaugeSlot[]> m_gauges;
+	};
+
+}} // namespace allure::service
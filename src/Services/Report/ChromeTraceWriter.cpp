@@ -0,0 +1,260 @@
+#include "ChromeTraceWriter.h"
+
+#include "Model/TestSuite.h"
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <variant>
+
+#ifdef _WIN32
+	#define PATH_SEPARATOR "\\"
+#else
+	#define PATH_SEPARATOR "/"
+#endif
+
+
+namespace allure { namespace service {
+
+	namespace {
+		constexpr unsigned int PROCESS_ID = 1;
+
+		std::string translateStatusToString(model::Status status)
+		{
+			switch (status)
+			{
+				case model::Status::SKIPPED: return "skipped";
+				case model::Status::BROKEN: return "broken";
+				case model::Status::FAILED: return "failed";
+				case model::Status::PASSED: return "passed";
+				default: return "unknown";
+			}
+		}
+
+		void addParametersToArgs(const std::vector<model::Parameter>& parameters, nlohmann::ordered_json& args)
+		{
+			for (const auto& parameter : parameters)
+			{
+				// Numbers stay numbers, so trace viewers can sort and plot them
+				std::visit([&](const auto& value) { args[parameter.getName()] = value; }, parameter.getTypedValue());
+			}
+		}
+
+		void addAttachmentsToArgs(const std::vector<model::Attachment>& attachments, nlohmann::ordered_json& args)
+		{
+			if (attachments.empty())
+			{
+				return;
+			}
+
+			nlohmann::ordered_json attachmentsArray = nlohmann::ordered_json::array();
+			for (const auto& attachment : attachments)
+			{
+				attachmentsArray.push_back({ { "name", attachment.getName() }, { "source", attachment.getSource() } });
+			}
+			args["attachments"] = attachmentsArray;
+		}
+	}
+
+	ChromeTraceWriter::ChromeTraceWriter()
+		:m_enabled(false)
+		,m_mutex()
+		,m_stream()
+		,m_open(false)
+		,m_firstEvent(true)
+		,m_threadTracks()
+	{
+	}
+
+	ChromeTraceWriter::~ChromeTraceWriter()
+	{
+		close();
+	}
+
+	bool ChromeTraceWriter::isEnabled() const
+	{
+		return m_enabled;
+	}
+
+	void ChromeTraceWriter::setEnabled(bool enabled)
+	{
+		m_enabled = enabled;
+	}
+
+	bool ChromeTraceWriter::isOpen() const
+	{
+		return m_open;
+	}
+
+	void ChromeTraceWriter::open(const std::string& filepath)
+	{
+		close();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stream.open(filepath, std::ios::out | std::ios::trunc);
+		if (!m_stream.is_open())
+		{
+			return;
+		}
+
+		m_open = true;
+		m_firstEvent = true;
+		m_threadTracks.clear();
+		m_stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+		writeEvent(fmt::format("{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{},\"tid\":0,\"args\":{{\"name\":\"allure-cpp\"}}}}", PROCESS_ID));
+	}
+
+	void ChromeTraceWriter::close()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_stream.is_open())
+		{
+			m_stream << "\n]}\n";
+			m_stream.close();
+		}
+		m_open = false;
+	}
+
+	void ChromeTraceWriter::writeStep(const model::Step& step)
+	{
+		// Skip building the event when tracing is off, the stream is checked again under the lock
+		if (!isOpen())
+		{
+			return;
+		}
+
+		nlohmann::ordered_json args;
+		args["status"] = translateStatusToString(step.getStatus());
+		if (!step.getStatusMessage().empty())
+		{
+			args["message"] = step.getStatusMessage();
+		}
+		addParametersToArgs(step.getParameters(), args);
+		for (const auto& metric : step.getMetrics())
+		{
+			args[metric.getName()] = metric.getValue();
+		}
+		addAttachmentsToArgs(step.getAttachments(), args);
+
+		nlohmann::ordered_json event;
+		event["name"] = step.getName();
+		event["cat"] = "step";
+		event["ph"] = "X";
+		event["ts"] = step.getStartNs() / 1e3;
+		event["dur"] = step.getDurationNs() / 1e3;
+		event["pid"] = PROCESS_ID;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (!m_stream.is_open())
+		{
+			return;
+		}
+
+		event["tid"] = getThreadTrack();
+		event["args"] = args;
+		writeEvent(event.dump());
+	}
+
+	void ChromeTraceWriter::writeTestCase(const model::TestCase& testCase)
+	{
+		if (!isOpen())
+		{
+			return;
+		}
+
+		nlohmann::ordered_json args;
+		args["uuid"] = testCase.getUUID();
+		args["fullName"] = testCase.getFullName();
+		args["status"] = translateStatusToString(testCase.getStatus());
+		if (!testCase.getStatusMessage().empty())
+		{
+			args["message"] = testCase.getStatusMessage();
+		}
+		addParametersToArgs(testCase.getParameters(), args);
+		addAttachmentsToArgs(testCase.getAttachments(), args);
+
+		nlohmann::ordered_json event;
+		event["name"] = testCase.getName();
+		event["cat"] = "test";
+		event["ph"] = "X";
+		event["ts"] = testCase.getStartNs() / 1e3;
+		event["dur"] = testCase.getDurationNs() / 1e3;
+		event["pid"] = PROCESS_ID;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (!m_stream.is_open())
+		{
+			return;
+		}
+
+		event["tid"] = getThreadTrack();
+		event["args"] = args;
+		writeEvent(event.dump());
+
+		// Keep what was recorded so far if the run crashes
+		m_stream.flush();
+	}
+
+	void ChromeTraceWriter::writeTestSuite(const model::TestSuite& testSuite, uint64_t durationNs)
+	{
+		if (!isOpen())
+		{
+			return;
+		}
+
+		nlohmann::ordered_json event;
+		event["name"] = testSuite.getName();
+		event["cat"] = "suite";
+		event["ph"] = "X";
+		event["ts"] = testSuite.getStartNs() / 1e3;
+		event["dur"] = durationNs / 1e3;
+		event["pid"] = PROCESS_ID;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (!m_stream.is_open())
+		{
+			return;
+		}
+
+		event["tid"] = getThreadTrack();
+		event["args"] = { { "uuid", testSuite.getUUID() }, { "status", translateStatusToString(testSuite.getStatus()) },
+						  { "tests", testSuite.getTestCases().size() } };
+		writeEvent(event.dump());
+	}
+
+	std::string ChromeTraceWriter::getFilepath(const std::string& outputFolder)
+	{
+		return outputFolder + PATH_SEPARATOR + "trace.json";
+	}
+
+	void ChromeTraceWriter::writeEvent(const std::string& event)
+	{
+		if (!m_stream.is_open())
+		{
+			return;
+		}
+
+		if (!m_firstEvent)
+		{
+			m_stream << ",\n";
+		}
+		m_stream << event;
+		m_firstEvent = false;
+	}
+
+	unsigned int ChromeTraceWriter::getThreadTrack()
+	{
+		auto it = m_threadTracks.find(std::this_thread::get_id());
+		if (it != m_threadTracks.end())
+		{
+			return it->second;
+		}
+
+		// Name each new track, as thread ids are meaningless in the viewer
+		unsigned int track = static_cast<unsigned int>(m_threadTracks.size()) + 1;
+		m_threadTracks[std::this_thread::get_id()] = track;
+		writeEvent(fmt::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":\"thread {}\"}}}}",
+							   PROCESS_ID, track, track));
+		return track;
+	}
+
+}} // namespace allure::service
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "IChromeTraceWriter.h"
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Streams the whole run as a Chrome Trace Event file (trace.json).
+	 *
+	 * Every suite, test case and step is written as a complete ("X") event as
+	 * soon as it ends, on the track of the thread that ran it, so nothing is
+	 * kept in memory besides the open file. Timestamps are the monotonic start
+	 * times of the model in microseconds. Test case events carry the uuid of
+	 * their result file, so both can be correlated. The file can be opened
+	 * with Perfetto (ui.perfetto.dev) or chrome://tracing.
+	 */
+	class ChromeTraceWriter : public IChromeTraceWriter
+	{
+	public:
+		ChromeTraceWriter();
+		virtual ~ChromeTraceWriter();
+
+		bool isEnabled() const override;
+		void setEnabled(bool) override;
+
+		bool isOpen() const override;
+		void open(const std::string& filepath) override;
+		void close() override;
+
+		void writeStep(const model::Step&) override;
+		void writeTestCase(const model::TestCase&) override;
+		void writeTestSuite(const model::TestSuite&, uint64_t durationNs) override;
+
+		static std::string getFilepath(const std::string& outputFolder);
+
+	private:
+		void writeEvent(const std::string& event);
+		unsigned int getThreadTrack();
+
+	private:
+		bool m_enabled;
+		std::mutex m_mutex;
+		std::ofstream m_stream;
+		std::atomic<bool> m_open;
+		bool m_firstEvent;
+		std::map<std::thread::id, unsigned int> m_threadTracks;
+	};
+
+}} // namespace allure::service
@@ -1,12 +1,14 @@
 #include "ContainerJSONSerializer.h"
 
 #include "Model/Container.h"
+#include "Services/Metrics/SelfProfiler.h"
 
 
 namespace allure { namespace service {
 
 	std::string ContainerJSONSerializer::serialize(const model::Container& container) const
 	{
+		ALLURE_PROFILE_SCOPE(SERIALIZATION);
 		json j = json::object();
 		addContainerToJSON(container, j);
 		return j.dump();
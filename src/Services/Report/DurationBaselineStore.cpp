@@ -0,0 +1,262 @@
+#include "DurationBaselineStore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <nlohmann/json.hpp>
+
+#ifdef _WIN32
+	#define PATH_SEPARATOR "\\"
+#else
+	#define PATH_SEPARATOR "/"
+#endif
+
+
+namespace allure { namespace service {
+
+	namespace {
+		std::string formatMilliseconds(double nanoseconds)
+		{
+			std::ostringstream stream;
+			stream << std::fixed << std::setprecision(3) << (nanoseconds / 1e6) << " ms";
+			return stream.str();
+		}
+
+		uint64_t percentile(const std::vector<uint64_t>& sortedSamples, double fraction)
+		{
+			size_t rank = static_cast<size_t>(std::ceil(fraction * sortedSamples.size()));
+			return sortedSamples[(rank > 0) ? rank - 1 : 0];
+		}
+	}
+
+	DurationBaselineStore::DurationBaselineStore()
+		:m_enabled(false)
+		,m_window(DEFAULT_WINDOW)
+		,m_threshold(DEFAULT_THRESHOLD)
+		,m_markFlaky(false)
+		,m_markKnown(false)
+		,m_baselines()
+		,m_recorded()
+	{
+	}
+
+	bool DurationBaselineStore::isEnabled() const
+	{
+		return m_enabled;
+	}
+
+	void DurationBaselineStore::setEnabled(bool enabled)
+	{
+		m_enabled = enabled;
+	}
+
+	unsigned int DurationBaselineStore::getWindow() const
+	{
+		return m_window;
+	}
+
+	void DurationBaselineStore::setWindow(unsigned int window)
+	{
+		m_window = std::max(window, MIN_SAMPLES);
+	}
+
+	double DurationBaselineStore::getThreshold() const
+	{
+		return m_threshold;
+	}
+
+	void DurationBaselineStore::setThreshold(double threshold)
+	{
+		m_threshold = threshold;
+	}
+
+	bool DurationBaselineStore::isMarkFlaky() const
+	{
+		return m_markFlaky;
+	}
+
+	void DurationBaselineStore::setMarkFlaky(bool markFlaky)
+	{
+		m_markFlaky = markFlaky;
+	}
+
+	bool DurationBaselineStore::isMarkKnown() const
+	{
+		return m_markKnown;
+	}
+
+	void DurationBaselineStore::setMarkKnown(bool markKnown)
+	{
+		m_markKnown = markKnown;
+	}
+
+	void DurationBaselineStore::load(const std::string& content)
+	{
+		m_baselines.clear();
+		m_recorded.clear();
+
+		std::istringstream stream(content);
+		std::string line;
+		while (std::getline(stream, line))
+		{
+			// A damaged line only loses the baseline of one test
+			nlohmann::json entry = nlohmann::json::parse(line, nullptr, false);
+			if (!entry.is_object() || !entry.contains("historyId") || !entry.contains("samples") ||
+				!entry["historyId"].is_string() || !entry["samples"].is_array())
+			{
+				continue;
+			}
+
+			DurationBaseline baseline;
+			for (const auto& sample : entry["samples"])
+			{
+				if (sample.is_number_unsigned())
+				{
+					baseline.samples.push_back(sample.get<uint64_t>());
+				}
+			}
+			if (baseline.samples.size() > m_window)
+			{
+				baseline.samples.erase(baseline.samples.begin(), baseline.samples.end() - m_window);
+			}
+			baseline.runs = entry.value("runs", static_cast<uint64_t>(baseline.samples.size()));
+			computeStatistics(baseline);
+			m_baselines[entry["historyId"].get<std::string>()] = std::move(baseline);
+		}
+	}
+
+	void DurationBaselineStore::loadFile(const std::string& filepath)
+	{
+		std::ifstream file(filepath, std::ios::binary);
+		if (!file.is_open())
+		{
+			load("");
+			return;
+		}
+
+		std::ostringstream content;
+		content << file.rdbuf();
+		load(content.str());
+	}
+
+	std::string DurationBaselineStore::serialize() const
+	{
+		std::string content;
+		for (const auto& entry : m_baselines)
+		{
+			const DurationBaseline& baseline = entry.second;
+			nlohmann::ordered_json line;
+			line["historyId"] = entry.first;
+			line["runs"] = baseline.runs;
+			line["mean"] = std::round(baseline.mean);
+			line["stddev"] = std::round(baseline.stddev);
+			line["p50"] = baseline.p50;
+			line["p95"] = baseline.p95;
+			line["samples"] = baseline.samples;
+			content += line.dump();
+			content += "\n";
+		}
+
+		return content;
+	}
+
+	void DurationBaselineStore::clear()
+	{
+		m_baselines.clear();
+		m_recorded.clear();
+	}
+
+	const DurationBaseline* DurationBaselineStore::getBaseline(const std::string& historyId) const
+	{
+		auto it = m_baselines.find(historyId);
+		return (it != m_baselines.end()) ? &it->second : nullptr;
+	}
+
+	bool DurationBaselineStore::isRegression(const DurationBaseline& baseline, uint64_t durationNs) const
+	{
+		if (baseline.samples.size() < MIN_SAMPLES)
+		{
+			return false;
+		}
+
+		// Baselines with (nearly) no variance would flag any jitter otherwise
+		double allowedIncrease = std::max(m_threshold * baseline.stddev, MIN_RELATIVE_INCREASE * baseline.mean);
+		return static_cast<double>(durationNs) > (baseline.mean + allowedIncrease);
+	}
+
+	std::string DurationBaselineStore::buildRegressionMessage(const DurationBaseline& baseline, uint64_t durationNs) const
+	{
+		std::ostringstream message;
+		message << "Duration regression: " << formatMilliseconds(static_cast<double>(durationNs))
+				<< " exceeds baseline mean " << formatMilliseconds(baseline.mean);
+		if (baseline.stddev > 0.0)
+		{
+			message << " by " << std::fixed << std::setprecision(1)
+					<< ((static_cast<double>(durationNs) - baseline.mean) / baseline.stddev) << " standard deviations";
+		}
+		message << " (p95 " << formatMilliseconds(static_cast<double>(baseline.p95))
+				<< ", last " << baseline.samples.size() << " runs)";
+		return message.str();
+	}
+
+	void DurationBaselineStore::record(const std::string& historyId, uint64_t durationNs)
+	{
+		m_recorded.emplace_back(historyId, durationNs);
+	}
+
+	void DurationBaselineStore::update()
+	{
+		for (const auto& recorded : m_recorded)
+		{
+			DurationBaseline& baseline = m_baselines[recorded.first];
+			baseline.samples.push_back(recorded.second);
+			if (baseline.samples.size() > m_window)
+			{
+				baseline.samples.erase(baseline.samples.begin(), baseline.samples.end() - m_window);
+			}
+			baseline.runs++;
+			computeStatistics(baseline);
+		}
+		m_recorded.clear();
+	}
+
+	std::string DurationBaselineStore::getFilepath(const std::string& outputFolder)
+	{
+		return outputFolder + PATH_SEPARATOR + "history" + PATH_SEPARATOR + "duration-baseline.jsonl";
+	}
+
+	void DurationBaselineStore::computeStatistics(DurationBaseline& baseline) const
+	{
+		if (baseline.samples.empty())
+		{
+			baseline.mean = 0.0;
+			baseline.stddev = 0.0;
+			baseline.p50 = 0;
+			baseline.p95 = 0;
+			return;
+		}
+
+		double sum = 0.0;
+		for (uint64_t sample : baseline.samples)
+		{
+			sum += static_cast<double>(sample);
+		}
+		baseline.mean = sum / baseline.samples.size();
+
+		double squaredDeviations = 0.0;
+		for (uint64_t sample : baseline.samples)
+		{
+			double deviation = static_cast<double>(sample) - baseline.mean;
+			squaredDeviations += deviation * deviation;
+		}
+		baseline.stddev = (baseline.samples.size() > 1) ? std::sqrt(squaredDeviations / (baseline.samples.size() - 1)) : 0.0;
+
+		std::vector<uint64_t> sortedSamples = baseline.samples;
+		std::sort(sortedSamples.begin(), sortedSamples.end());
+		baseline.p50 = percentile(sortedSamples, 0.50);
+		baseline.p95 = percentile(sortedSamples, 0.95);
+	}
+
+}} // namespace allure::service
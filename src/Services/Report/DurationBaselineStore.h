@@ -0,0 +1,76 @@
+#pragma once
+
+#include "IDurationBaselineStore.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Per-historyId duration baselines kept next to history/history-trend.json.
+	 *
+	 * Each line of history/duration-baseline.jsonl holds the durations (in
+	 * nanoseconds) of the last `window` passing runs of one test together with
+	 * their mean, standard deviation, p50 and p95. The file is loaded once when
+	 * the program starts and rewritten when it ends, merging only the durations
+	 * recorded in this run, so updating it never rescans older runs.
+	 */
+	class DurationBaselineStore : public IDurationBaselineStore
+	{
+	public:
+		static constexpr unsigned int DEFAULT_WINDOW = 20;
+		static constexpr unsigned int MIN_SAMPLES = 5;
+		static constexpr double DEFAULT_THRESHOLD = 3.0;
+		static constexpr double MIN_RELATIVE_INCREASE = 0.1;
+
+		DurationBaselineStore();
+		virtual ~DurationBaselineStore() = default;
+
+		bool isEnabled() const override;
+		void setEnabled(bool) override;
+
+		unsigned int getWindow() const override;
+		void setWindow(unsigned int) override;
+
+		double getThreshold() const override;
+		void setThreshold(double) override;
+
+		bool isMarkFlaky() const override;
+		void setMarkFlaky(bool) override;
+
+		bool isMarkKnown() const override;
+		void setMarkKnown(bool) override;
+
+		void load(const std::string& content) override;
+		void loadFile(const std::string& filepath) override;
+		std::string serialize() const override;
+		void clear() override;
+
+		const DurationBaseline* getBaseline(const std::string& historyId) const override;
+		bool isRegression(const DurationBaseline&, uint64_t durationNs) const override;
+		std::string buildRegressionMessage(const DurationBaseline&, uint64_t durationNs) const override;
+
+		void record(const std::string& historyId, uint64_t durationNs) override;
+		void update() override;
+
+		static std::string getFilepath(const std::string& outputFolder);
+
+	private:
+		void computeStatistics(DurationBaseline&) const;
+
+	private:
+		bool m_enabled;
+		unsigned int m_window;
+		double m_threshold;
+		bool m_markFlaky;
+		bool m_markKnown;
+		std::map<std::string, DurationBaseline> m_baselines;
+		std::vector<std::pair<std::string, uint64_t>> m_recorded;
+	};
+
+}} // namespace allure::service
@@ -0,0 +1,226 @@
+#include "FlameGraphBuilder.h"
+
+#include "Model/TestCase.h"
+#include "Services/Report/XMLUtils.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <fmt/format.h>
+
+#ifdef _WIN32
+	#define PATH_SEPARATOR "\\"
+#else
+	#define PATH_SEPARATOR "/"
+#endif
+
+
+namespace allure { namespace service {
+
+	namespace {
+		constexpr int SVG_WIDTH = 1200;
+		constexpr int SVG_MARGIN = 10;
+		constexpr int SVG_TITLE_HEIGHT = 30;
+		constexpr int FRAME_HEIGHT = 16;
+		constexpr double MIN_FRAME_WIDTH = 0.1;
+		constexpr double CHARACTER_WIDTH = 7.0;
+
+		struct Frame
+		{
+			std::string name;
+			uint64_t totalNs = 0;
+			std::map<std::string, std::unique_ptr<Frame>> children;
+		};
+
+		// Frame names are separated by ';' and stacks end at the first space before the count
+		std::string sanitizeFrameName(const std::string& name)
+		{
+			std::string sanitized = name;
+			std::replace(sanitized.begin(), sanitized.end(), ';', ',');
+			std::replace(sanitized.begin(), sanitized.end(), '\n', ' ');
+			std::replace(sanitized.begin(), sanitized.end(), '\r', ' ');
+			return sanitized;
+		}
+
+		size_t getDepth(const Frame& frame)
+		{
+			size_t depth = 0;
+			for (const auto& child : frame.children)
+			{
+				depth = std::max(depth, getDepth(*child.second) + 1);
+			}
+			return depth;
+		}
+
+		// Warm colors, stable for a given name across graphs
+		std::string getFrameColor(const std::string& name)
+		{
+			size_t hash = std::hash<std::string>()(name);
+			return fmt::format("rgb({},{},{})", 205 + hash % 50, 80 + (hash >> 8) % 150, (hash >> 16) % 55);
+		}
+	}
+
+	FlameGraphBuilder::FlameGraphBuilder()
+		:m_enabled(false)
+		,m_mutex()
+		,m_runStacks()
+	{
+	}
+
+	bool FlameGraphBuilder::isEnabled() const
+	{
+		return m_enabled;
+	}
+
+	void FlameGraphBuilder::setEnabled(bool enabled)
+	{
+		m_enabled = enabled;
+	}
+
+	void FlameGraphBuilder::addStacks(const Stacks& stacks)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const auto& stack : stacks)
+		{
+			m_runStacks[stack.first] += stack.second;
+		}
+	}
+
+	FlameGraphBuilder::Stacks FlameGraphBuilder::getRunStacks() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_runStacks;
+	}
+
+	void FlameGraphBuilder::clear()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_runStacks.clear();
+	}
+
+	void FlameGraphBuilder::collapseTestCase(const std::string& suiteName, const model::TestCase& testCase, Stacks& stacks)
+	{
+		std::string path = sanitizeFrameName(suiteName) + ";" + sanitizeFrameName(testCase.getName());
+		uint64_t stepsNs = 0;
+		for (unsigned int i = 0; i < testCase.getStepCount(); i++)
+		{
+			stepsNs += collapseStep(*testCase.getStep(i), path, stacks);
+		}
+
+		if (testCase.getDurationNs() > stepsNs)
+		{
+			stacks[path] += testCase.getDurationNs() - stepsNs;
+		}
+	}
+
+	std::string FlameGraphBuilder::formatCollapsed(const Stacks& stacks)
+	{
+		std::string collapsed;
+		for (const auto& stack : stacks)
+		{
+			collapsed += fmt::format("{} {}\n", stack.first, stack.second);
+		}
+		return collapsed;
+	}
+
+	std::string FlameGraphBuilder::renderSVG(const Stacks& stacks, const std::string& title)
+	{
+		Frame root;
+		root.name = "all";
+		for (const auto& stack : stacks)
+		{
+			Frame* frame = &root;
+			root.totalNs += stack.second;
+			size_t start = 0;
+			while (start <= stack.first.size())
+			{
+				size_t end = std::min(stack.first.find(';', start), stack.first.size());
+				std::string name = stack.first.substr(start, end - start);
+				auto& child = frame->children[name];
+				if (!child)
+				{
+					child = std::make_unique<Frame>();
+					child->name = name;
+				}
+				frame = child.get();
+				frame->totalNs += stack.second;
+				start = end + 1;
+			}
+		}
+
+		const double plotWidth = SVG_WIDTH - 2 * SVG_MARGIN;
+		const size_t depth = getDepth(root);
+		const int height = SVG_TITLE_HEIGHT + static_cast<int>(depth + 1) * FRAME_HEIGHT + SVG_MARGIN;
+		const double scale = (root.totalNs > 0) ? plotWidth / static_cast<double>(root.totalNs) : 0.0;
+
+		std::string svg = fmt::format(
+			"<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"{0}\" height=\"{1}\" viewBox=\"0 0 {0} {1}\" "
+			"font-family=\"Verdana, sans-serif\" font-size=\"11\">\n"
+			"<rect width=\"{0}\" height=\"{1}\" fill=\"#f8f8f8\"/>\n"
+			"<text x=\"{2}\" y=\"20\" text-anchor=\"middle\" font-size=\"15\">{3}</text>\n",
+			SVG_WIDTH, height, SVG_WIDTH / 2, escapeXML(title));
+
+		// Callers at the bottom, callees stacked on top of them
+		std::function<void(const Frame&, double, size_t)> renderFrame = [&](const Frame& frame, double x, size_t level)
+		{
+			double width = frame.totalNs * scale;
+			if (width < MIN_FRAME_WIDTH)
+			{
+				return;
+			}
+
+			double y = height - SVG_MARGIN - (level + 1.0) * FRAME_HEIGHT;
+			double percent = (root.totalNs > 0) ? 100.0 * frame.totalNs / root.totalNs : 0.0;
+			svg += fmt::format("<g><title>{} ({:.3f} ms, {:.2f}%)</title>"
+							   "<rect x=\"{:.2f}\" y=\"{:.1f}\" width=\"{:.2f}\" height=\"{}\" rx=\"2\" fill=\"{}\"/>",
+							   escapeXML(frame.name), frame.totalNs / 1e6, percent,
+							   x, y, width, FRAME_HEIGHT - 1, getFrameColor(frame.name));
+
+			size_t maxCharacters = static_cast<size_t>((width - 6) / CHARACTER_WIDTH);
+			if (maxCharacters >= 3)
+			{
+				std::string label = (frame.name.size() <= maxCharacters) ? frame.name : frame.name.substr(0, maxCharacters - 2) + "..";
+				svg += fmt::format("<text x=\"{:.2f}\" y=\"{:.1f}\">{}</text>", x + 3, y + FRAME_HEIGHT - 4, escapeXML(label));
+			}
+			svg += "</g>\n";
+
+			double childX = x;
+			for (const auto& child : frame.children)
+			{
+				renderFrame(*child.second, childX, level + 1);
+				childX += child.second->totalNs * scale;
+			}
+		};
+		renderFrame(root, SVG_MARGIN, 0);
+
+		svg += "</svg>\n";
+		return svg;
+	}
+
+	std::string FlameGraphBuilder::getCollapsedFilepath(const std::string& outputFolder)
+	{
+		return outputFolder + PATH_SEPARATOR + "flamegraph.folded";
+	}
+
+	std::string FlameGraphBuilder::getSVGFilepath(const std::string& outputFolder)
+	{
+		return outputFolder + PATH_SEPARATOR + "flamegraph.svg";
+	}
+
+	uint64_t FlameGraphBuilder::collapseStep(const model::Step& step, const std::string& parentPath, Stacks& stacks)
+	{
+		std::string path = parentPath + ";" + sanitizeFrameName(step.getName());
+		uint64_t nestedNs = 0;
+		for (unsigned int i = 0; i < step.getStepCount(); i++)
+		{
+			nestedNs += collapseStep(*step.getStep(i), path, stacks);
+		}
+
+		if (step.getDurationNs() > nestedNs)
+		{
+			stacks[path] += step.getDurationNs() - nestedNs;
+		}
+		return std::max(step.getDurationNs(), nestedNs);
+	}
+
+}} // namespace allure::service
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "IFlameGraphBuilder.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+
+namespace allure { namespace model {
+	class Step;
+	class TestCase;
+}} // namespace allure::model
+
+namespace allure { namespace service {
+
+	/**
+	 * Flame graphs of where the time of tests goes, by step path.
+	 *
+	 * Step trees are folded into collapsed stacks (`suite;test;step;substep self-ns`,
+	 * the input format of flamegraph.pl and speedscope), where each line holds
+	 * the time spent in a frame outside of its nested steps. The stacks of every
+	 * test are merged into a run-wide map as tests end, so memory is bounded by
+	 * the number of distinct step paths, not by the number of tests.
+	 */
+	class FlameGraphBuilder : public IFlameGraphBuilder
+	{
+	public:
+		FlameGraphBuilder();
+		virtual ~FlameGraphBuilder() = default;
+
+		bool isEnabled() const override;
+		void setEnabled(bool) override;
+
+		void addStacks(const Stacks&) override;
+		Stacks getRunStacks() const override;
+		void clear() override;
+
+		static void collapseTestCase(const std::string& suiteName, const model::TestCase&, Stacks&);
+		static std::string formatCollapsed(const Stacks&);
+		static std::string renderSVG(const Stacks&, const std::string& title);
+
+		static std::string getCollapsedFilepath(const std::string& outputFolder);
+		static std::string getSVGFilepath(const std::string& outputFolder);
+
+	private:
+		static uint64_t collapseStep(const model::Step&, const std::string& parentPath, Stacks&);
+
+	private:
+		bool m_enabled;
+		mutable std::mutex m_mutex;
+		Stacks m_runStacks;
+	};
+
+}} // namespace allure::service
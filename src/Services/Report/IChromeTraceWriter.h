@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+
+namespace allure { namespace model {
+	class Step;
+	class TestCase;
+	class TestSuite;
+}} // namespace allure::model
+
+namespace allure { namespace service {
+
+	class IChromeTraceWriter
+	{
+	public:
+		virtual ~IChromeTraceWriter() = default;
+
+		virtual bool isEnabled() const = 0;
+		virtual void setEnabled(bool) = 0;
+
+		virtual bool isOpen() const = 0;
+		virtual void open(const std::string& filepath) = 0;
+		virtual void close() = 0;
+
+		virtual void writeStep(const model::Step&) = 0;
+		virtual void writeTestCase(const model::TestCase&) = 0;
+		virtual void writeTestSuite(const model::TestSuite&, uint64_t durationNs) = 0;
+	};
+
+}} // namespace allure::service
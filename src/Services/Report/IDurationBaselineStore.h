@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Durations of the last runs of a test and statistics derived from them.
+	 */
+	struct DurationBaseline
+	{
+		std::vector<uint64_t> samples;
+		uint64_t runs = 0;
+		double mean = 0.0;
+		double stddev = 0.0;
+		uint64_t p50 = 0;
+		uint64_t p95 = 0;
+	};
+
+	class IDurationBaselineStore
+	{
+	public:
+		virtual ~IDurationBaselineStore() = default;
+
+		virtual bool isEnabled() const = 0;
+		virtual void setEnabled(bool) = 0;
+
+		virtual unsigned int getWindow() const = 0;
+		virtual void setWindow(unsigned int) = 0;
+
+		virtual double getThreshold() const = 0;
+		virtual void setThreshold(double) = 0;
+
+		virtual bool isMarkFlaky() const = 0;
+		virtual void setMarkFlaky(bool) = 0;
+
+		virtual bool isMarkKnown() const = 0;
+		virtual void setMarkKnown(bool) = 0;
+
+		virtual void load(const std::string& content) = 0;
+		virtual void loadFile(const std::string& filepath) = 0;
+		virtual std::string serialize() const = 0;
+		virtual void clear() = 0;
+
+		virtual const DurationBaseline* getBaseline(const std::string& historyId) const = 0;
+		virtual bool isRegression(const DurationBaseline&, uint64_t durationNs) const = 0;
+		virtual std::string buildRegressionMessage(const DurationBaseline&, uint64_t durationNs) const = 0;
+
+		virtual void record(const std::string& historyId, uint64_t durationNs) = 0;
+		virtual void update() = 0;
+	};
+
+}} // namespace allure::service
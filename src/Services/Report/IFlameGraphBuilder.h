@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+
+namespace allure { namespace service {
+
+	class IFlameGraphBuilder
+	{
+	public:
+		typedef std::map<std::string, uint64_t> Stacks;
+
+		virtual ~IFlameGraphBuilder() = default;
+
+		virtual bool isEnabled() const = 0;
+		virtual void setEnabled(bool) = 0;
+
+		virtual void addStacks(const Stacks&) = 0;
+		virtual Stacks getRunStacks() const = 0;
+		virtual void clear() = 0;
+	};
+
+}} // namespace allure::service
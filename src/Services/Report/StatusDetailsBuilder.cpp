@@ -0,0 +1,107 @@
+#include "StatusDetailsBuilder.h"
+
+
+namespace allure { namespace service {
+
+	StatusDetailsBuilder::StatusDetailsBuilder(size_t maxBytes)
+		:m_maxBytes(maxBytes)
+		,m_failures()
+		,m_failureIndexes()
+		,m_messageBytes(0)
+		,m_omittedFailures(0)
+		,m_trace()
+		,m_droppedTraceBytes(0)
+	{
+	}
+
+	void StatusDetailsBuilder::addFailure(const std::string& message, const std::string& location)
+	{
+		auto it = m_failureIndexes.find(message);
+		if (it != m_failureIndexes.end())
+		{
+			m_failures[it->second].count++;
+		}
+		else if ((m_maxBytes == 0) || (m_messageBytes + message.size() <= m_maxBytes) || m_failures.empty())
+		{
+			// The first failure is always reported, even if it has to be cut
+			m_failureIndexes[message] = m_failures.size();
+			m_failures.push_back({ limitMessage(message, m_maxBytes), 1 });
+			m_messageBytes += message.size() + 1;
+		}
+		else
+		{
+			m_omittedFailures++;
+		}
+
+		if (!m_trace.empty())
+		{
+			m_trace += "\n";
+		}
+		m_trace += location + "\n" + message;
+
+		// Trim lazily to keep appends amortized while never holding more than twice the limit
+		if ((m_maxBytes > 0) && (m_trace.size() > 2 * m_maxBytes))
+		{
+			size_t excess = m_trace.size() - m_maxBytes;
+			m_trace.erase(0, excess);
+			m_droppedTraceBytes += excess;
+		}
+	}
+
+	std::string StatusDetailsBuilder::getMessage() const
+	{
+		std::string message;
+		for (const auto& failure : m_failures)
+		{
+			if (!message.empty())
+			{
+				message += "\n";
+			}
+			message += failure.message;
+			if (failure.count > 1)
+			{
+				message += " (repeated " + std::to_string(failure.count) + " times)";
+			}
+		}
+
+		if (m_omittedFailures > 0)
+		{
+			message += "\n[... " + std::to_string(m_omittedFailures) + " more failures omitted ...]";
+		}
+
+		return message;
+	}
+
+	std::string StatusDetailsBuilder::getTrace() const
+	{
+		if ((m_maxBytes == 0) || ((m_trace.size() <= m_maxBytes) && (m_droppedTraceBytes == 0)))
+		{
+			return m_trace;
+		}
+
+		size_t excess = (m_trace.size() > m_maxBytes) ? (m_trace.size() - m_maxBytes) : 0;
+		return "[... " + std::to_string(m_droppedTraceBytes + excess) + " earlier bytes truncated ...]\n" + m_trace.substr(excess);
+	}
+
+	std::string StatusDetailsBuilder::limitMessage(const std::string& message, size_t maxBytes)
+	{
+		if ((maxBytes == 0) || (message.size() <= maxBytes))
+		{
+			return message;
+		}
+
+		return message.substr(0, maxBytes) + "\n[... " + std::to_string(message.size() - maxBytes) + " more bytes truncated ...]";
+	}
+
+	std::string StatusDetailsBuilder::limitTrace(const std::string& trace, size_t maxBytes)
+	{
+		if ((maxBytes == 0) || (trace.size() <= maxBytes))
+		{
+			return trace;
+		}
+
+		size_t excess = trace.size() - maxBytes;
+		return "[... " + std::to_string(excess) + " earlier bytes truncated ...]\n" + trace.substr(excess);
+	}
+
+}} // namespace allure::service
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Builds the statusDetails message and trace of a test from its failures
+	 * while keeping both within a fixed number of bytes.
+	 *
+	 * Identical failure messages are listed once with a repetition count, the
+	 * message keeps its head and the trace keeps its tail (the most recent
+	 * failures). A limit of 0 means unlimited.
+	 */
+	class StatusDetailsBuilder
+	{
+	public:
+		explicit StatusDetailsBuilder(size_t maxBytes);
+		virtual ~StatusDetailsBuilder() = default;
+
+		void addFailure(const std::string& message, const std::string& location);
+
+		std::string getMessage() const;
+		std::string getTrace() const;
+
+		static std::string limitMessage(const std::string& message, size_t maxBytes);
+		static std::string limitTrace(const std::string& trace, size_t maxBytes);
+
+	private:
+		struct Failure
+		{
+			std::string message;
+			unsigned int count;
+		};
+
+		size_t m_maxBytes;
+		std::vector<Failure> m_failures;
+		std::unordered_map<std::string, size_t> m_failureIndexes;
+		size_t m_messageBytes;
+		unsigned int m_omittedFailures;
+
+		std::string m_trace;
+		size_t m_droppedTraceBytes;
+	};
+
+}} // namespace allure::service
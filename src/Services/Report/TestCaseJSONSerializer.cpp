@@ -7,12 +7,16 @@
 #include "Model/Step.h"
 #include "Model/StepType.h"
 #include "Model/TestCase.h"
+#include "Services/Metrics/SelfProfiler.h"
+
+#include <variant>
 
 
 namespace allure { namespace service {
 
 	std::string TestCaseJSONSerializer::serialize(const model::TestCase& testCase) const
 	{
+		ALLURE_PROFILE_SCOPE(SERIALIZATION);
 		json j = json::object();
 		addTestCaseToJSON(testCase, j);
 		return j.dump();
@@ -32,6 +36,12 @@ namespace allure { namespace service {
 		j["start"] = testCase.getStart();
 		j["stop"] = testCase.getStop();
 
+		// Sub-millisecond precision, measured on a monotonic clock (not part of the Allure schema)
+		if (testCase.getDurationNs() > 0)
+		{
+			j["durationNs"] = testCase.getDurationNs();
+		}
+
 		// Optional fields
 		if (!testCase.getTestCaseId().empty())
 		{
@@ -114,26 +124,37 @@ namespace allure { namespace service {
 			json parametersArray = json::array();
 			for (const auto& parameter : parameters)
 			{
-				json paramObj = {
-					{"name", parameter.getName()},
-					{"value", parameter.getValue()}
-				};
+				parametersArray.push_back(buildParameterJSON(parameter));
+			}
+			j["parameters"] = parametersArray;
+		}
+	}
 
-				// Add optional fields only if they differ from defaults
-				if (parameter.getExcluded())
-				{
-					paramObj["excluded"] = true;
-				}
+	json TestCaseJSONSerializer::buildParameterJSON(const model::Parameter& parameter) const
+	{
+		// Typed values are rendered here, and also written as a JSON number or boolean
+		json paramObj = {
+			{"name", parameter.getName()},
+			{"value", parameter.getValue()}
+		};
 
-				if (parameter.getMode() != "default")
-				{
-					paramObj["mode"] = parameter.getMode();
-				}
+		if (parameter.isTyped())
+		{
+			std::visit([&paramObj](const auto& value) { paramObj["typedValue"] = value; }, parameter.getTypedValue());
+		}
 
-				parametersArray.push_back(paramObj);
-			}
-			j["parameters"] = parametersArray;
+		// Add optional fields only if they differ from defaults
+		if (parameter.getExcluded())
+		{
+			paramObj["excluded"] = true;
+		}
+
+		if (parameter.getMode() != "default")
+		{
+			paramObj["mode"] = parameter.getMode();
 		}
+
+		return paramObj;
 	}
 
 	void TestCaseJSONSerializer::addLinksToJSON(const std::vector<model::Link>& links, json& j) const
@@ -199,31 +220,41 @@ namespace allure { namespace service {
 		// Timestamps are already in milliseconds (from TimeService)
 		j["start"] = step->getStart();
 		j["stop"] = step->getStop();
+		if (step->getDurationNs() > 0)
+		{
+			j["durationNs"] = step->getDurationNs();
+		}
+		if (!step->getStatusMessage().empty())
+		{
+			j["statusDetails"] = { {"message", step->getStatusMessage()} };
+		}
 
 		// Add parameters if present
 		const auto& parameters = step->getParameters();
-		if (parameters.size() > 0)
+		const auto& metrics = step->getMetrics();
+		if ((parameters.size() > 0) || (metrics.size() > 0) || step->isCoalesced())
 		{
 			json parametersArray = json::array();
 			for (const auto& parameter : parameters)
 			{
-				json paramObj = {
-					{"name", parameter.getName()},
-					{"value", parameter.getValue()}
-				};
-
-				if (parameter.getExcluded())
-				{
-					paramObj["excluded"] = true;
-				}
+				parametersArray.push_back(buildParameterJSON(parameter));
+			}
 
-				if (parameter.getMode() != "default")
-				{
-					paramObj["mode"] = parameter.getMode();
-				}
+			for (const auto& metric : metrics)
+			{
+				parametersArray.push_back({
+					{"name", metric.getName()},
+					{"value", std::to_string(metric.getValue())},
+					{"excluded", true}
+				});
+			}
 
-				parametersArray.push_back(paramObj);
+			// Coalesced steps report the durations of all the steps they stand for
+			if (step->isCoalesced())
+			{
+				addStepStatisticsToJSON(step->getStatistics(), parametersArray);
 			}
+
 			j["parameters"] = parametersArray;
 		}
 
@@ -260,6 +291,27 @@ namespace allure { namespace service {
 		}
 	}
 
+	void TestCaseJSONSerializer::addStepStatisticsToJSON(const model::StepStatistics& statistics, json& parametersArray) const
+	{
+		const std::pair<std::string, std::string> statisticParameters[] = {
+			{"count", std::to_string(statistics.getCount())},
+			{"total (ns)", std::to_string(statistics.getTotal())},
+			{"min (ns)", std::to_string(statistics.getMin())},
+			{"max (ns)", std::to_string(statistics.getMax())},
+			{"p50 (ns)", std::to_string(statistics.getPercentile(50))},
+			{"p99 (ns)", std::to_string(statistics.getPercentile(99))}
+		};
+
+		for (const auto& statisticParameter : statisticParameters)
+		{
+			parametersArray.push_back({
+				{"name", statisticParameter.first},
+				{"value", statisticParameter.second},
+				{"excluded", true}
+			});
+		}
+	}
+
 	std::string TestCaseJSONSerializer::translateStatusToString(model::Status status) const
 	{
 		if (status == model::Status::SKIPPED)
@@ -13,6 +13,7 @@ namespace allure { namespace model {
 	class Link;
 	class Parameter;
 	class Step;
+	class StepStatistics;
 	class TestCase;
 	enum class Status;
 	enum class Stage;
@@ -32,10 +33,12 @@ namespace allure { namespace service {
 		void addTestCaseToJSON(const model::TestCase&, json&) const;
 		void addLabelsToJSON(const std::vector<model::Label>&, json&) const;
 		void addParametersToJSON(const std::vector<model::Parameter>&, json&) const;
+		json buildParameterJSON(const model::Parameter&) const;
 		void addLinksToJSON(const std::vector<model::Link>&, json&) const;
 		void addAttachmentsToJSON(const std::vector<model::Attachment>&, json&) const;
 		void addStepsToJSON(const model::TestCase&, json&) const;
 		void addStepToJSON(const model::Step*, json&) const;
+		void addStepStatisticsToJSON(const model::StepStatistics&, json&) const;
 
 		std::string translateStatusToString(model::Status) const;
 		std::string translateStageToString(model::Stage) const;
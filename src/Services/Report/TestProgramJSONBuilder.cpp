@@ -4,6 +4,9 @@
 #include "Model/TestCase.h"
 #include "Model/TestProgram.h"
 #include "Model/TestSuite.h"
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Report/DurationBaselineStore.h"
+#include "Services/Report/FlameGraphBuilder.h"
 #include "Services/Report/ITestCaseJSONSerializer.h"
 #include "Services/Report/IContainerJSONSerializer.h"
 #include "Services/System/IFileService.h"
@@ -29,10 +32,16 @@ namespace allure { namespace service {
 
 	TestProgramJSONBuilder::TestProgramJSONBuilder(std::unique_ptr<ITestCaseJSONSerializer> testCaseJSONSerializer,
 												   std::unique_ptr<IContainerJSONSerializer> containerJSONSerializer,
-												   std::unique_ptr<IFileService> fileService)
+												   std::unique_ptr<IFileService> fileService,
+												   std::shared_ptr<IDurationBaselineStore> durationBaselineStore,
+												   std::shared_ptr<IFlameGraphBuilder> flameGraphBuilder,
+												   std::shared_ptr<ISelfProfiler> selfProfiler)
 		:m_testCaseJSONSerializer(std::move(testCaseJSONSerializer))
 		,m_containerJSONSerializer(std::move(containerJSONSerializer))
 		,m_fileService(std::move(fileService))
+		,m_durationBaselineStore(std::move(durationBaselineStore))
+		,m_flameGraphBuilder(std::move(flameGraphBuilder))
+		,m_selfProfiler(std::move(selfProfiler))
 	{
 	}
 
@@ -84,6 +93,15 @@ namespace allure { namespace service {
 
 		// Generate categories.json
 		generateCategoriesJson(outputFolder);
+
+		// Update history/duration-baseline.jsonl with the durations of this run
+		generateDurationBaseline(outputFolder);
+
+		// Generate flamegraph.folded and flamegraph.svg for the whole run
+		generateFlameGraph(outputFolder);
+
+		// Generate allure-stats.json with the overhead of Allure itself
+		generateSelfProfile(outputFolder);
 	}
 
 	model::Container TestProgramJSONBuilder::createContainerFromTestSuite(const model::TestSuite& testSuite) const
@@ -137,6 +155,12 @@ namespace allure { namespace service {
 		content += "Framework=" + testProgram.getFrameworkName() + "\n";
 		content += "Language=C++\n";
 
+		// Add the overhead of Allure itself so far
+		if (SelfProfiler::isCompiledIn() && m_selfProfiler->isEnabled())
+		{
+			content += SelfProfiler::formatProperties(m_selfProfiler->getTotals());
+		}
+
 		m_fileService->saveFile(filepath, content);
 	}
 
@@ -184,6 +208,44 @@ namespace allure { namespace service {
 		m_fileService->saveFile(filepath, content);
 	}
 
+	void TestProgramJSONBuilder::generateDurationBaseline(const std::string& outputFolder) const
+	{
+		if (!m_durationBaselineStore->isEnabled())
+		{
+			return;
+		}
+
+		m_durationBaselineStore->update();
+		m_fileService->saveFile(DurationBaselineStore::getFilepath(outputFolder), m_durationBaselineStore->serialize());
+	}
+
+	void TestProgramJSONBuilder::generateFlameGraph(const std::string& outputFolder) const
+	{
+		if (!m_flameGraphBuilder->isEnabled())
+		{
+			return;
+		}
+
+		FlameGraphBuilder::Stacks stacks = m_flameGraphBuilder->getRunStacks();
+		if (stacks.empty())
+		{
+			return;
+		}
+
+		m_fileService->saveFile(FlameGraphBuilder::getCollapsedFilepath(outputFolder), FlameGraphBuilder::formatCollapsed(stacks));
+		m_fileService->saveFile(FlameGraphBuilder::getSVGFilepath(outputFolder), FlameGraphBuilder::renderSVG(stacks, "Test run"));
+	}
+
+	void TestProgramJSONBuilder::generateSelfProfile(const std::string& outputFolder) const
+	{
+		if (!SelfProfiler::isCompiledIn() || !m_selfProfiler->isEnabled())
+		{
+			return;
+		}
+
+		m_fileService->saveFile(SelfProfiler::getFilepath(outputFolder), SelfProfiler::formatJSON(m_selfProfiler->getTotals()));
+	}
+
 	std::string TestProgramJSONBuilder::resolveBuildOrder(const model::TestProgram& testProgram, long long currentMillis, const std::string& outputFolder) const
 	{
 		const auto explicitOrder = testProgram.getExecutorBuildOrder();
@@ -17,6 +17,9 @@ namespace allure {
 	class IFileService;
 	class ITestCaseJSONSerializer;
 	class IContainerJSONSerializer;
+	class IDurationBaselineStore;
+	class IFlameGraphBuilder;
+	class ISelfProfiler;
 	class ITestSuiteJSONSerializer;
 
 	class TestProgramJSONBuilder : public ITestProgramJSONBuilder
@@ -24,7 +27,10 @@ namespace allure {
 	public:
 		TestProgramJSONBuilder(std::unique_ptr<ITestCaseJSONSerializer>,
 							   std::unique_ptr<IContainerJSONSerializer>,
-							   std::unique_ptr<IFileService>);
+							   std::unique_ptr<IFileService>,
+							   std::shared_ptr<IDurationBaselineStore>,
+							   std::shared_ptr<IFlameGraphBuilder>,
+							   std::shared_ptr<ISelfProfiler>);
 		virtual ~TestProgramJSONBuilder() = default;
 
 		virtual void buildJSONFiles(const model::TestProgram&) const;
@@ -35,6 +41,9 @@ namespace allure {
 		void generateEnvironmentProperties(const std::string& outputFolder, const model::TestProgram& testProgram) const;
 		void generateExecutorJson(const std::string& outputFolder, const model::TestProgram& testProgram) const;
 		void generateCategoriesJson(const std::string& outputFolder) const;
+		void generateDurationBaseline(const std::string& outputFolder) const;
+		void generateFlameGraph(const std::string& outputFolder) const;
+		void generateSelfProfile(const std::string& outputFolder) const;
 		std::string resolveBuildOrder(const model::TestProgram& testProgram, long long currentMillis, const std::string& outputFolder) const;
 		std::string resolveBuildName(const model::TestProgram& testProgram, const std::chrono::system_clock::time_point& now) const;
 		std::string resolveExecutorName(const model::TestProgram& testProgram) const;
@@ -53,6 +62,9 @@ namespace allure {
 		std::unique_ptr<ITestCaseJSONSerializer> m_testCaseJSONSerializer;
 		std::unique_ptr<IContainerJSONSerializer> m_containerJSONSerializer;
 		std::unique_ptr<IFileService> m_fileService;
+		std::shared_ptr<IDurationBaselineStore> m_durationBaselineStore;
+		std::shared_ptr<IFlameGraphBuilder> m_flameGraphBuilder;
+		std::shared_ptr<ISelfProfiler> m_selfProfiler;
 	};
 
 }} // namespace allure::service
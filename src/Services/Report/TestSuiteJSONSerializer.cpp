@@ -2,12 +2,14 @@
 
 #include "Model/StepType.h"
 #include "Model/TestSuite.h"
+#include "Services/Metrics/SelfProfiler.h"
 
 
 namespace allure { namespace service {
 
 	std::string TestSuiteJSONSerializer::serialize(const model::TestSuite& testSuite) const
 	{
+		ALLURE_PROFILE_SCOPE(SERIALIZATION);
 		json j = json::object();
 		addTestSuiteToJSON(testSuite, j);
 		return j.dump();
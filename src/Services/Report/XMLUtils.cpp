@@ -0,0 +1,24 @@
+#include "XMLUtils.h"
+
+
+namespace allure { namespace service {
+
+	std::string escapeXML(const std::string& text)
+	{
+		std::string escaped;
+		escaped.reserve(text.size());
+		for (char c : text)
+		{
+			switch (c)
+			{
+				case '&': escaped += "&amp;"; break;
+				case '<': escaped += "&lt;"; break;
+				case '>': escaped += "&gt;"; break;
+				case '"': escaped += "&quot;"; break;
+				default: escaped += c; break;
+			}
+		}
+		return escaped;
+	}
+
+}} // namespace allure::service
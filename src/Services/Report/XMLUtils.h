@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Escapes the characters with a meaning in XML text and attribute values,
+	 * for the labels of the SVG reports.
+	 */
+	std::string escapeXML(const std::string& text);
+
+}} // namespace allure::service
@@ -1,6 +1,8 @@
 #include "ServicesFactory.h"
 
+#include "Model/TestProgram.h"
 #include "Model/TestSuite.h"
+#include "Services/Capture/OutputCapture.h"
 #include "Services/EventHandlers/TestCaseEndEventHandler.h"
 #include "Services/EventHandlers/TestCaseStartEventHandler.h"
 #include "Services/EventHandlers/TestProgramEndEventHandler.h"
@@ -13,10 +15,20 @@
 #include "Services/GoogleTest/GTestEventListener.h"
 #include "Services/GoogleTest/GTestStatusChecker.h"
 #endif
+#include "Services/Log/LogRingBuffer.h"
+#include "Services/Metrics/AllocationTracker.h"
+#include "Services/Metrics/OverheadGovernor.h"
+#include "Services/Metrics/PerfCounterGroup.h"
+#include "Services/Metrics/ResourceUsageMonitor.h"
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Metrics/TestMetricRegistry.h"
 #include "Services/Property/TestCasePropertySetter.h"
 #include "Services/Property/TestSuitePropertySetter.h"
+#include "Services/Report/ChromeTraceWriter.h"
+#include "Services/Report/DurationBaselineStore.h"
+#include "Services/Report/FlameGraphBuilder.h"
+#include "Services/System/ConfiguredTimeService.h"
 #include "Services/System/FileService.h"
-#include "Services/System/TimeService.h"
 #include "Services/System/UUIDGeneratorService.h"
 #include "Services/Report/TestCaseJSONSerializer.h"
 #include "Services/Report/ContainerJSONSerializer.h"
@@ -28,6 +40,15 @@ namespace allure { namespace service {
 
 	ServicesFactory::ServicesFactory(model::TestProgram& testProgram)
 		:m_testProgram(testProgram)
+		,m_logRingBuffer(std::make_shared<LogRingBuffer>())
+		,m_outputCapture(std::make_shared<OutputCapture>())
+		,m_resourceUsageMonitor(std::make_shared<ResourceUsageMonitor>())
+		,m_perfCounterGroup(std::make_shared<PerfCounterGroup>())
+		,m_durationBaselineStore(std::make_shared<DurationBaselineStore>())
+		,m_testMetricRegistry(std::make_shared<TestMetricRegistry>())
+		,m_chromeTraceWriter(std::make_shared<ChromeTraceWriter>())
+		,m_flameGraphBuilder(std::make_shared<FlameGraphBuilder>())
+		,m_overheadGovernor(std::make_shared<OverheadGovernor>(buildSelfProfiler()))
 	{
 	}
 
@@ -58,7 +79,9 @@ namespace allure { namespace service {
 	// Lifecycle events handling services
 	std::unique_ptr<ITestProgramStartEventHandler> ServicesFactory::buildTestProgramStartEventHandler() const
 	{
-		return std::make_unique<TestProgramStartEventHandler>(m_testProgram);
+		auto durationBaselineStore = buildDurationBaselineStore();
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		return std::make_unique<TestProgramStartEventHandler>(m_testProgram, std::move(durationBaselineStore), std::move(chromeTraceWriter));
 	}
 
 	std::unique_ptr<ITestSuiteStartEventHandler> ServicesFactory::buildTestSuiteStartEventHandler() const
@@ -72,19 +95,34 @@ namespace allure { namespace service {
 	{
 		auto uuidGeneratorService = buildUUIDGeneratorService();
 		auto timeService = buildTimeService();
-		return std::make_unique<TestCaseStartEventHandler>(m_testProgram, std::move(uuidGeneratorService), std::move(timeService));
+		auto outputCapture = buildOutputCapture();
+		auto resourceUsageMonitor = buildResourceUsageMonitor();
+		auto perfCounterGroup = buildPerfCounterGroup();
+		auto allocationTracker = buildAllocationTracker();
+		auto testMetricRegistry = buildTestMetricRegistry();
+		auto overheadGovernor = buildOverheadGovernor();
+		return std::make_unique<TestCaseStartEventHandler>(m_testProgram, std::move(uuidGeneratorService), std::move(timeService),
+		                                                   std::move(outputCapture), std::move(resourceUsageMonitor), std::move(perfCounterGroup),
+		                                                   std::move(allocationTracker), std::move(testMetricRegistry), std::move(overheadGovernor));
 	}
 
 	std::unique_ptr<ITestStepStartEventHandler> ServicesFactory::buildTestStepStartEventHandler() const
 	{
 		auto timeService = buildTimeService();
-		return std::make_unique<TestStepStartEventHandler>(m_testProgram, std::move(timeService));
+		auto perfCounterGroup = buildPerfCounterGroup();
+		auto allocationTracker = buildAllocationTracker();
+		return std::make_unique<TestStepStartEventHandler>(m_testProgram, std::move(timeService), std::move(perfCounterGroup), std::move(allocationTracker));
 	}
 
 	std::unique_ptr<ITestStepEndEventHandler> ServicesFactory::buildTestStepEndEventHandler() const
 	{
 		auto timeService = buildTimeService();
-		return std::make_unique<TestStepEndEventHandler>(m_testProgram, std::move(timeService));
+		auto perfCounterGroup = buildPerfCounterGroup();
+		auto allocationTracker = buildAllocationTracker();
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		auto overheadGovernor = buildOverheadGovernor();
+		return std::make_unique<TestStepEndEventHandler>(m_testProgram, std::move(timeService), std::move(perfCounterGroup),
+		                                                 std::move(allocationTracker), std::move(chromeTraceWriter), std::move(overheadGovernor));
 	}
 
 	std::unique_ptr<ITestCaseEndEventHandler> ServicesFactory::buildTestCaseEndEventHandler() const
@@ -92,7 +130,20 @@ namespace allure { namespace service {
 		auto timeService = buildTimeService();
 		auto testCaseJSONSerializer = buildTestCaseJSONSerializer();
 		auto fileService = buildFileService();
-		return std::make_unique<TestCaseEndEventHandler>(m_testProgram, std::move(timeService), std::move(testCaseJSONSerializer), std::move(fileService));
+		auto logRingBuffer = buildLogRingBuffer();
+		auto outputCapture = buildOutputCapture();
+		auto resourceUsageMonitor = buildResourceUsageMonitor();
+		auto perfCounterGroup = buildPerfCounterGroup();
+		auto allocationTracker = buildAllocationTracker();
+		auto durationBaselineStore = buildDurationBaselineStore();
+		auto testMetricRegistry = buildTestMetricRegistry();
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		auto flameGraphBuilder = buildFlameGraphBuilder();
+		auto overheadGovernor = buildOverheadGovernor();
+		return std::make_unique<TestCaseEndEventHandler>(m_testProgram, std::move(timeService), std::move(testCaseJSONSerializer), std::move(fileService),
+		                                                 std::move(logRingBuffer), std::move(outputCapture), std::move(resourceUsageMonitor), std::move(perfCounterGroup),
+		                                                 std::move(allocationTracker), std::move(durationBaselineStore), std::move(testMetricRegistry),
+		                                                 std::move(chromeTraceWriter), std::move(flameGraphBuilder), std::move(overheadGovernor));
 	}
 
 	std::unique_ptr<ITestSuiteEndEventHandler> ServicesFactory::buildTestSuiteEndEventHandler() const
@@ -100,13 +151,18 @@ namespace allure { namespace service {
 		auto timeService = buildTimeService();
 		auto containerJSONSerializer = buildContainerJSONSerializer();
 		auto fileService = buildFileService();
-		return std::make_unique<TestSuiteEndEventHandler>(m_testProgram, std::move(timeService), std::move(containerJSONSerializer), std::move(fileService));
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		return std::make_unique<TestSuiteEndEventHandler>(m_testProgram, std::move(timeService), std::move(containerJSONSerializer),
+		                                                  std::move(fileService), std::move(chromeTraceWriter));
 	}
 
 	std::unique_ptr<ITestProgramEndEventHandler> ServicesFactory::buildTestProgramEndEventHandler() const
 	{
 		auto testProgramJSONBuilder = buildTestProgramJSONBuilder();
-		return std::make_unique<TestProgramEndEventHandler>(m_testProgram, std::move(testProgramJSONBuilder));
+		auto outputCapture = buildOutputCapture();
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		return std::make_unique<TestProgramEndEventHandler>(m_testProgram, std::move(testProgramJSONBuilder), std::move(outputCapture),
+		                                                    std::move(chromeTraceWriter));
 	}
 
 
@@ -128,9 +184,15 @@ namespace allure { namespace service {
 		auto testCaseJSONSerializer = buildTestCaseJSONSerializer();
 		auto containerJSONSerializer = buildContainerJSONSerializer();
 		auto fileService = buildFileService();
+		auto durationBaselineStore = buildDurationBaselineStore();
+		auto flameGraphBuilder = buildFlameGraphBuilder();
+		auto selfProfiler = buildSelfProfiler();
 		return std::make_unique<TestProgramJSONBuilder>(std::move(testCaseJSONSerializer),
 		                                                  std::move(containerJSONSerializer),
-		                                                  std::move(fileService));
+		                                                  std::move(fileService),
+		                                                  std::move(durationBaselineStore),
+		                                                  std::move(flameGraphBuilder),
+		                                                  std::move(selfProfiler));
 	}
 
 	std::unique_ptr<ITestCaseJSONSerializer> ServicesFactory::buildTestCaseJSONSerializer() const
@@ -162,7 +224,68 @@ namespace allure { namespace service {
 
 	std::unique_ptr<ITimeService> ServicesFactory::buildTimeService() const
 	{
-		return std::make_unique<TimeService>();
+		// Clock source and timeline scale are resolved on every read, configure() may come later
+		return std::make_unique<ConfiguredTimeService>(m_testProgram);
+	}
+
+
+
+	// Shared services
+	std::shared_ptr<ILogRingBuffer> ServicesFactory::buildLogRingBuffer() const
+	{
+		return m_logRingBuffer;
+	}
+
+	std::shared_ptr<IOutputCapture> ServicesFactory::buildOutputCapture() const
+	{
+		return m_outputCapture;
+	}
+
+	std::shared_ptr<IResourceUsageMonitor> ServicesFactory::buildResourceUsageMonitor() const
+	{
+		return m_resourceUsageMonitor;
+	}
+
+	std::shared_ptr<IPerfCounterGroup> ServicesFactory::buildPerfCounterGroup() const
+	{
+		return m_perfCounterGroup;
+	}
+
+	std::shared_ptr<IAllocationTracker> ServicesFactory::buildAllocationTracker() const
+	{
+		// The allocation hooks feed the process-wide tracker, so it is shared but not owned
+		return std::shared_ptr<IAllocationTracker>(std::shared_ptr<IAllocationTracker>(), &AllocationTracker::instance());
+	}
+
+	std::shared_ptr<IDurationBaselineStore> ServicesFactory::buildDurationBaselineStore() const
+	{
+		return m_durationBaselineStore;
+	}
+
+	std::shared_ptr<ITestMetricRegistry> ServicesFactory::buildTestMetricRegistry() const
+	{
+		return m_testMetricRegistry;
+	}
+
+	std::shared_ptr<IChromeTraceWriter> ServicesFactory::buildChromeTraceWriter() const
+	{
+		return m_chromeTraceWriter;
+	}
+
+	std::shared_ptr<IFlameGraphBuilder> ServicesFactory::buildFlameGraphBuilder() const
+	{
+		return m_flameGraphBuilder;
+	}
+
+	std::shared_ptr<ISelfProfiler> ServicesFactory::buildSelfProfiler() const
+	{
+		// The profiling macros feed the process-wide profiler, so it is shared but not owned
+		return std::shared_ptr<ISelfProfiler>(std::shared_ptr<ISelfProfiler>(), &SelfProfiler::instance());
+	}
+
+	std::shared_ptr<IOverheadGovernor> ServicesFactory::buildOverheadGovernor() const
+	{
+		return m_overheadGovernor;
 	}
 
 
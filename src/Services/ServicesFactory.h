@@ -9,8 +9,17 @@ namespace allure { namespace model {
 
 namespace allure { namespace service {
 
+	class ChromeTraceWriter;
+	class DurationBaselineStore;
+	class FlameGraphBuilder;
 	class ITestCaseJSONSerializer;
 	class IContainerJSONSerializer;
+	class LogRingBuffer;
+	class OutputCapture;
+	class OverheadGovernor;
+	class PerfCounterGroup;
+	class ResourceUsageMonitor;
+	class TestMetricRegistry;
 
 	class ServicesFactory : public IServicesFactory
 	{
@@ -49,12 +58,35 @@ namespace allure { namespace service {
 		std::unique_ptr<IFileService> buildFileService() const override;
 		std::unique_ptr<ITimeService> buildTimeService() const override;
 
+		// Shared services
+		std::shared_ptr<ILogRingBuffer> buildLogRingBuffer() const override;
+		std::shared_ptr<IOutputCapture> buildOutputCapture() const override;
+		std::shared_ptr<IResourceUsageMonitor> buildResourceUsageMonitor() const override;
+		std::shared_ptr<IPerfCounterGroup> buildPerfCounterGroup() const override;
+		std::shared_ptr<IAllocationTracker> buildAllocationTracker() const override;
+		std::shared_ptr<IDurationBaselineStore> buildDurationBaselineStore() const override;
+		std::shared_ptr<ITestMetricRegistry> buildTestMetricRegistry() const override;
+		std::shared_ptr<IChromeTraceWriter> buildChromeTraceWriter() const override;
+		std::shared_ptr<IFlameGraphBuilder> buildFlameGraphBuilder() const override;
+		std::shared_ptr<ISelfProfiler> buildSelfProfiler() const override;
+		std::shared_ptr<IOverheadGovernor> buildOverheadGovernor() const override;
+
 		// Unique instance (to be used by integration tests)
 		static IServicesFactory* getInstance();
 		static void setInstance(std::unique_ptr<IServicesFactory>);
 
 	private:
 		model::TestProgram& m_testProgram;
+		std::shared_ptr<LogRingBuffer> m_logRingBuffer;
+		std::shared_ptr<OutputCapture> m_outputCapture;
+		std::shared_ptr<ResourceUsageMonitor> m_resourceUsageMonitor;
+		std::shared_ptr<PerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<DurationBaselineStore> m_durationBaselineStore;
+		std::shared_ptr<TestMetricRegistry> m_testMetricRegistry;
+		std::shared_ptr<ChromeTraceWriter> m_chromeTraceWriter;
+		std::shared_ptr<FlameGraphBuilder> m_flameGraphBuilder;
+		std::shared_ptr<OverheadGovernor> m_overheadGovernor;
+
 		static std::unique_ptr<IServicesFactory> m_instance;
 	};
 
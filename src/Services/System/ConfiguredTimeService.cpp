@@ -0,0 +1,35 @@
+#include "ConfiguredTimeService.h"
+
+#include "Model/TestProgram.h"
+#include "Services/System/MonotonicTimeService.h"
+
+#include <chrono>
+
+
+namespace allure { namespace service {
+
+	ConfiguredTimeService::ConfiguredTimeService(const model::TestProgram& testProgram)
+		:m_testProgram(testProgram)
+	{
+	}
+
+	time_t ConfiguredTimeService::getCurrentTime() const
+	{
+		model::ClockSource clockSource = m_testProgram.getClockSource();
+		unsigned int timelineScale = m_testProgram.getTimelineScale();
+		if ((clockSource != model::ClockSource::SYSTEM) || (timelineScale > 1))
+		{
+			return MonotonicTimeService::readCurrentTime(clockSource == model::ClockSource::MONOTONIC_COARSE, timelineScale);
+		}
+
+		// Milliseconds since epoch (Allure 2 requirement)
+		return static_cast<time_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count());
+	}
+
+	int64_t ConfiguredTimeService::getMonotonicNanoseconds() const
+	{
+		return MonotonicTimeService::readMonotonicNanoseconds(false);
+	}
+
+}} // namespace allure::service
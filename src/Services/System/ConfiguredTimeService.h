@@ -0,0 +1,35 @@
+#pragma once
+
+#include "ITimeService.h"
+
+#include <cstdint>
+
+
+namespace allure { namespace model {
+	class TestProgram;
+}}
+
+namespace allure { namespace service {
+
+	/**
+	 * Time service following the clock source and timeline scale of the test program.
+	 *
+	 * Both settings are read on every timestamp, so a configure() call made
+	 * after the event handlers were built still takes effect. The system clock
+	 * is used unless a monotonic source or a timeline scale is configured, see
+	 * MonotonicTimeService. Durations always come from the precise monotonic clock.
+	 */
+	class ConfiguredTimeService : public ITimeService
+	{
+	public:
+		explicit ConfiguredTimeService(const model::TestProgram&);
+		virtual ~ConfiguredTimeService() = default;
+
+		time_t getCurrentTime() const;
+		int64_t getMonotonicNanoseconds() const;
+
+	private:
+		const model::TestProgram& m_testProgram;
+	};
+
+}} // namespace allure::service
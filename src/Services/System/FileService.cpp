@@ -1,5 +1,7 @@
 #include "FileService.h"
 
+#include "Services/Metrics/SelfProfiler.h"
+
 #include <algorithm>
 #include <fstream>
 #include <sstream>
@@ -19,6 +21,7 @@ namespace allure { namespace service {
 
 	void FileService::saveFile(const std::string& filePath, const std::string& fileContent) const
 	{
+		ALLURE_PROFILE_SCOPE(FILE_IO);
 		createFileFolder(filePath);
 
 		try
@@ -29,6 +32,7 @@ namespace allure { namespace service {
 
 			outputFileStream << fileContent;
 			outputFileStream.close();
+			ALLURE_PROFILE_FILE_WRITTEN(fileContent.size());
 		}
 		catch (std::ofstream::failure& exc)
 		{
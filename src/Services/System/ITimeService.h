@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 
@@ -11,6 +12,7 @@ namespace allure { namespace service {
 		virtual ~ITimeService() = default;
 
 		virtual time_t getCurrentTime() const = 0;
+		virtual int64_t getMonotonicNanoseconds() const = 0;
 	};
 
 }} // namespace allure::service
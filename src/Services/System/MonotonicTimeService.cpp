@@ -0,0 +1,78 @@
+#include "MonotonicTimeService.h"
+
+#include <chrono>
+
+#if defined(__linux__)
+	#include <time.h>
+#endif
+
+
+namespace allure { namespace service {
+
+	MonotonicTimeService::MonotonicTimeService(bool coarse, unsigned int timelineScale)
+		:m_coarse(coarse)
+		,m_timelineScale((timelineScale > 0) ? timelineScale : 1)
+	{
+		getAnchor(m_coarse);
+	}
+
+	time_t MonotonicTimeService::getCurrentTime() const
+	{
+		return readCurrentTime(m_coarse, m_timelineScale);
+	}
+
+	int64_t MonotonicTimeService::getMonotonicNanoseconds() const
+	{
+		// Durations always use the precise clock; the coarse one would round most of them to 0
+		return readMonotonicNanoseconds(false);
+	}
+
+	bool MonotonicTimeService::isCoarse() const
+	{
+		return m_coarse;
+	}
+
+	unsigned int MonotonicTimeService::getTimelineScale() const
+	{
+		return m_timelineScale;
+	}
+
+	time_t MonotonicTimeService::readCurrentTime(bool coarse, unsigned int timelineScale)
+	{
+		const Anchor& anchor = getAnchor(coarse);
+		int64_t elapsed = readMonotonicNanoseconds(coarse) - anchor.monotonicNanoseconds;
+		int64_t scale = (timelineScale > 0) ? timelineScale : 1;
+		return static_cast<time_t>((anchor.epochNanoseconds + elapsed * scale) / 1000000);
+	}
+
+	int64_t MonotonicTimeService::readMonotonicNanoseconds(bool coarse)
+	{
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+		struct timespec now;
+		clock_gettime(coarse ? CLOCK_MONOTONIC_COARSE : CLOCK_MONOTONIC, &now);
+		return static_cast<int64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+#else
+		(void) coarse;
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	const MonotonicTimeService::Anchor& MonotonicTimeService::getAnchor(bool coarse)
+	{
+		// One anchor per source, captured once for the whole process
+		auto captureAnchor = [](bool coarseSource)
+		{
+			Anchor anchor;
+			anchor.monotonicNanoseconds = readMonotonicNanoseconds(coarseSource);
+			anchor.epochNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count();
+			return anchor;
+		};
+
+		static const Anchor preciseAnchor = captureAnchor(false);
+		static const Anchor coarseAnchor = captureAnchor(true);
+		return coarse ? coarseAnchor : preciseAnchor;
+	}
+
+}} // namespace allure::service
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ITimeService.h"
+
+#include <cstdint>
+
+
+namespace allure { namespace service {
+
+	/**
+	 * Derives wall-clock timestamps from a monotonic clock.
+	 *
+	 * A single realtime/monotonic anchor pair is captured the first time the
+	 * clock is read and every later timestamp is the anchor plus the monotonic
+	 * time elapsed since then. Timestamps never go backwards within a run and
+	 * are not affected by NTP adjustments. The coarse variant reads
+	 * CLOCK_MONOTONIC_COARSE on Linux (no syscall, tick resolution); other
+	 * platforms use std::chrono::steady_clock for both variants.
+	 *
+	 * A timeline scale greater than 1 stretches the time elapsed since the
+	 * anchor, so that sub-millisecond tests and steps get visible widths in
+	 * the report timeline while keeping their relative order.
+	 */
+	class MonotonicTimeService : public ITimeService
+	{
+	public:
+		explicit MonotonicTimeService(bool coarse, unsigned int timelineScale = 1);
+		virtual ~MonotonicTimeService() = default;
+
+		time_t getCurrentTime() const;
+		int64_t getMonotonicNanoseconds() const;
+
+		bool isCoarse() const;
+		unsigned int getTimelineScale() const;
+
+		static time_t readCurrentTime(bool coarse, unsigned int timelineScale);
+		static int64_t readMonotonicNanoseconds(bool coarse);
+
+	private:
+		struct Anchor
+		{
+			int64_t epochNanoseconds;
+			int64_t monotonicNanoseconds;
+		};
+
+		static const Anchor& getAnchor(bool coarse);
+
+		bool m_coarse;
+		unsigned int m_timelineScale;
+	};
+
+}} // namespace allure::service
@@ -18,4 +18,10 @@ namespace allure { namespace service {
 		return static_cast<time_t>(millis);
 	}
 
+	int64_t TimeService::getMonotonicNanoseconds() const
+	{
+		auto duration = std::chrono::steady_clock::now().time_since_epoch();
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+	}
+
 }} // namespace allure::service
@@ -12,6 +12,7 @@ namespace allure { namespace service {
 		virtual ~TimeService() = default;
 
 		time_t getCurrentTime() const;
+		int64_t getMonotonicNanoseconds() const;
 	};
 
 }} // namespace allure::service
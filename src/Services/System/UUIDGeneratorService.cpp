@@ -1,5 +1,7 @@
 #include "UUIDGeneratorService.h"
 
+#include "Services/Metrics/SelfProfiler.h"
+
 #include <vector>
 #include <iostream>
 #include <sstream>
@@ -17,6 +19,7 @@ namespace allure { namespace service {
 
 	std::string UUIDGeneratorService::generateUUID() const
 	{
+		ALLURE_PROFILE_SCOPE(UUID_GENERATION);
 		std::ostringstream oss;
 
 		bool first = true;
@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * Allure C++ - Lightweight API header
+ *
+ * Cheaper to compile alternative to allure-cpp.h for test files that only
+ * need the core of the API:
+ *
+ *   #include <allure-cpp-lite.h>
+ *   using namespace allure;
+ *
+ *   TEST_F(MyTest, Example) {
+ *       test().feature("Login");
+ *
+ *       step("Login as user", [&]() {
+ *           // test code
+ *       });
+ *       ALLURE_STEP("Logout");
+ *
+ *       attachText("log", "test output");
+ *       counter("retries").add(1);
+ *   }
+ *
+ * It pulls in neither `fmt` nor the services and framework adapters, and
+ * from the model only the step status and budget: just the declarations of
+ * the API and a few standard headers. Formatted step names, measure(),
+ * histograms, log(), configuration and stats are left out; include their
+ * API/ header (or allure-cpp.h) where needed.
+ * Both headers can be mixed across the files of the same test program.
+ */
+
+// Compile-time capture level (ALLURE_CAPTURE_LEVEL)
+#include "API/CaptureLevel.h"
+
+// Step API (RAII guards, plain and registered step names)
+#include "API/Steps.h"
+
+// Metadata builders (fluent API)
+#include "API/TestMetadata.h"
+
+// Attachments
+#include "API/Attachment.h"
+
+// Per-test counters and gauges
+#include "API/TestMetrics.h"
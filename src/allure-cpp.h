@@ -26,12 +26,16 @@
  * All API is in the allure:: namespace.
  */
 
+// Compile-time capture level (ALLURE_CAPTURE_LEVEL)
+#include "API/CaptureLevel.h"
+
 // Core infrastructure (internal)
 #include "API/Core.h"
 
 // Step API (RAII guards and functions)
 #include "API/StepGuard.h"
 #include "API/StepFunctions.h"
+#include "API/StepSampler.h"
 
 // Metadata builders (fluent API)
 #include "API/TestMetadata.h"
@@ -39,6 +43,24 @@
 // Attachments
 #include "API/Attachment.h"
 
+// Micro-benchmarks recorded as steps
+#include "API/Measure.h"
+
+// Latency histograms
+#include "API/Histogram.h"
+
+// Per-test counters and gauges
+#include "API/TestMetrics.h"
+
+// Overhead of Allure itself (self-profiling)
+#include "API/Stats.h"
+
+// Per-test logging (attached on failure)
+#include "API/Log.h"
+
+// Run-wide configuration
+#include "API/Configuration.h"
+
 // Utilities
 #include "API/Utils.h"
 
@@ -47,6 +69,10 @@
     #include "Framework/Adapters/GoogleTest/AllureGTest.h"
 #endif
 
+#ifdef ALLURE_GOOGLEBENCHMARK_ENABLED
+    #include "Framework/Adapters/GoogleBenchmark/AllureGBenchmark.h"
+#endif
+
 // Note: CppUTest adapter headers are NOT auto-included here due to macro conflicts.
 // Include your own/project headers first, and keep CppUTest headers last so their
 // new/delete overrides don't leak into other includes. We only expose the lightweight
@@ -0,0 +1,49 @@
+#include "Services/System/MonotonicTimeService.h"
+#include "Services/System/TimeService.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+
+using namespace allure;
+
+namespace {
+
+	constexpr int READS_PER_ROUND = 1000000;
+	constexpr int ROUNDS = 5;
+
+	// Best of several rounds, in nanoseconds per getCurrentTime() call
+	double measureNanosecondsPerRead(const service::ITimeService& timeService)
+	{
+		volatile time_t sink = 0;
+		double best = 0.0;
+		for (int round = 0; round < ROUNDS; round++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			for (int i = 0; i < READS_PER_ROUND; i++)
+			{
+				sink = timeService.getCurrentTime();
+			}
+			auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+			double perRead = elapsed / READS_PER_ROUND;
+			best = (round == 0 || perRead < best) ? perRead : best;
+		}
+		(void) sink;
+		return best;
+	}
+
+}
+
+int main()
+{
+	std::unique_ptr<service::ITimeService> systemClock = std::make_unique<service::TimeService>();
+	std::unique_ptr<service::ITimeService> monotonicClock = std::make_unique<service::MonotonicTimeService>(false);
+	std::unique_ptr<service::ITimeService> coarseClock = std::make_unique<service::MonotonicTimeService>(true);
+
+	std::printf("%-18s %10s\n", "clock source", "ns/read");
+	std::printf("%-18s %10.1f\n", "SYSTEM", measureNanosecondsPerRead(*systemClock));
+	std::printf("%-18s %10.1f\n", "MONOTONIC", measureNanosecondsPerRead(*monotonicClock));
+	std::printf("%-18s %10.1f\n", "MONOTONIC_COARSE", measureNanosecondsPerRead(*coarseClock));
+	return 0;
+}
@@ -0,0 +1,60 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+
+namespace {
+
+	constexpr int ROUNDS = 5;
+
+	struct Variant
+	{
+		const char* name;
+		const char* responseFile;
+	};
+
+	// Mean and best wall time of compiling the probe, in milliseconds
+	bool measureCompileTime(const Variant& variant, double& mean, double& best)
+	{
+		std::string command = std::string("\"") + ALLURE_COMPILE_TIME_COMPILER + "\" @\"" + variant.responseFile +
+							  "\" -c \"" + ALLURE_COMPILE_TIME_SOURCE + "\" -o \"" + ALLURE_COMPILE_TIME_OUTPUT + "\"";
+		double total = 0.0;
+		for (int round = 0; round < ROUNDS; round++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			if (std::system(command.c_str()) != 0)
+			{
+				std::fprintf(stderr, "Failed to compile the %s probe: %s\n", variant.name, command.c_str());
+				return false;
+			}
+			auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			total += elapsed;
+			best = (round == 0 || elapsed < best) ? elapsed : best;
+		}
+		mean = total / ROUNDS;
+		return true;
+	}
+
+}
+
+int main()
+{
+	const Variant variants[] = {
+		{ "allure-cpp.h", ALLURE_COMPILE_TIME_FULL_FLAGS },
+		{ "allure-cpp-lite.h", ALLURE_COMPILE_TIME_LITE_FLAGS }
+	};
+
+	std::printf("%-18s %10s %10s\n", "header", "mean ms", "best ms");
+	for (const Variant& variant : variants)
+	{
+		double mean = 0.0;
+		double best = 0.0;
+		if (!measureCompileTime(variant, mean, best))
+		{
+			return 1;
+		}
+		std::printf("%-18s %10.1f %10.1f\n", variant.name, mean, best);
+	}
+	return 0;
+}
@@ -0,0 +1,30 @@
+// Typical test translation unit, compiled by CompileTimeBenchmark with each
+// public header. Only the header differs between both builds.
+#ifdef ALLURE_COMPILE_TIME_LITE
+	#include "allure-cpp-lite.h"
+#else
+	#include "allure-cpp.h"
+#endif
+
+
+void runCompileTimeProbe(int frames)
+{
+	using namespace allure;
+
+	test()
+		.feature("Decoder")
+		.story("Decode frames")
+		.severity("critical");
+
+	step("Open stream", [&]() {
+		attachText("header", "RIFF");
+	});
+
+	for (int i = 0; i < frames; i++)
+	{
+		auto guard = ALLURE_STEP("Decode frame");
+		counter("frames").add(1);
+	}
+
+	gauge("queue depth").set(static_cast<double>(frames));
+}
@@ -0,0 +1,40 @@
+#include "Services/Metrics/ResourceUsageMonitor.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+
+using namespace allure;
+
+namespace {
+
+	constexpr int TESTS = 100000;
+
+	// Average cost of the begin/end snapshots of an empty test and of one touching fresh memory
+	double measureNanosecondsPerTest(bool touchMemory)
+	{
+		service::ResourceUsageMonitor monitor;
+		monitor.setEnabled(true);
+		for (int i = 0; i < TESTS; i++)
+		{
+			monitor.beginTest();
+			if (touchMemory)
+			{
+				auto memory = std::make_unique<char[]>(256 * 1024);
+				std::memset(memory.get(), 1, 256 * 1024);
+			}
+			monitor.endTest();
+		}
+		return static_cast<double>(monitor.getTotalOverheadNanoseconds()) / monitor.getMeasuredTestCount();
+	}
+
+}
+
+int main()
+{
+	std::printf("%-18s %10s\n", "test body", "ns/test");
+	std::printf("%-18s %10.1f\n", "empty", measureNanosecondsPerTest(false));
+	std::printf("%-18s %10.1f\n", "faulting pages", measureNanosecondsPerTest(true));
+	return 0;
+}
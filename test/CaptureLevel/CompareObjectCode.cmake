@@ -0,0 +1,25 @@
+# Compares the disassembly of two object files (cmake -P script).
+# Usage: cmake -DOBJDUMP=<objdump> -DFIRST=<object> -DSECOND=<object> -P CompareObjectCode.cmake
+
+foreach(OBJECT FIRST SECOND)
+    execute_process(
+        COMMAND ${OBJDUMP} -d -r -C ${${OBJECT}}
+        OUTPUT_VARIABLE DISASSEMBLY
+        RESULT_VARIABLE RESULT
+    )
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "Could not disassemble ${${OBJECT}}")
+    endif()
+
+    # The header line names the object file
+    string(REGEX REPLACE "[^\n]*file format[^\n]*\n" "" DISASSEMBLY "${DISASSEMBLY}")
+    set(${OBJECT}_DISASSEMBLY "${DISASSEMBLY}")
+endforeach()
+
+if(NOT FIRST_DISASSEMBLY STREQUAL SECOND_DISASSEMBLY)
+    message("${FIRST}:\n${FIRST_DISASSEMBLY}")
+    message("${SECOND}:\n${SECOND_DISASSEMBLY}")
+    message(FATAL_ERROR "Object code differs")
+endif()
+
+message(STATUS "Object code is identical")
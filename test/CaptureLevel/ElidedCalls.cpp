@@ -0,0 +1,61 @@
+// Built twice: with the Allure calls at ALLURE_CAPTURE_LEVEL=0, and with
+// ALLURE_CAPTURE_BASELINE, where the same code is written without them.
+// Both builds must produce the same object code.
+#include <allure-cpp.h>
+
+#include <chrono>
+#include <vector>
+
+
+using namespace std::chrono_literals;
+
+int decodeFrames(const std::vector<int>& frames)
+{
+#ifndef ALLURE_CAPTURE_BASELINE
+	allure::test()
+		.feature("Decoder")
+		.severity("critical")
+		.parameter("frames", "all")
+		.flaky();
+	allure::suite().epic("Codecs");
+	auto decodedFrames = allure::counter("decoded frames");
+	auto lastFrame = allure::gauge("last frame");
+#endif
+
+	int checksum = 0;
+	for (int frame : frames)
+	{
+#ifndef ALLURE_CAPTURE_BASELINE
+		allure::step("Decode frame {} of {}", frame, frames.size(), [&]() {
+			checksum = checksum * 31 + frame;
+		});
+		decodedFrames.add();
+		lastFrame.set(static_cast<double>(frame));
+#else
+		checksum = checksum * 31 + frame;
+#endif
+	}
+
+#ifndef ALLURE_CAPTURE_BASELINE
+	{
+		auto guard = allure::step("Finalize");
+		checksum ^= 0x5a5a;
+	}
+	{
+		auto guard = ALLURE_STEP("Scramble");
+		checksum *= 7;
+	}
+	allure::step("Verify", 2ms, [&]() {
+		checksum += static_cast<int>(frames.size());
+	});
+	allure::log("checksum {:#x}", checksum);
+	allure::attachText("checksum", "computed");
+	allure::Attachment::fromFile("frames", "/tmp/frames.bin").attach();
+#else
+	checksum ^= 0x5a5a;
+	checksum *= 7;
+	checksum += static_cast<int>(frames.size());
+#endif
+
+	return checksum;
+}
@@ -0,0 +1,88 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+#include <string>
+
+using namespace testing;
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class FormattedStepIntegrationTest : public testing::Test
+									   , public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+
+			auto& testProgram = detail::Core::instance().getTestProgram();
+			testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+			auto& listener = getEventListener();
+			listener.onProgramStart();
+			listener.onTestSuiteStart("FormattedStepTestSuite");
+			listener.onTestStart("FormattedStepTestCase");
+		}
+
+		void TearDown()
+		{
+			auto& listener = getEventListener();
+			listener.onTestEnd(model::Status::PASSED);
+			listener.onTestSuiteEnd(model::Status::PASSED);
+			listener.onProgramEnd();
+
+			BaseIntegrationTest::TearDown();
+		}
+
+	protected:
+		const model::Step& getStep(unsigned int index) const
+		{
+			return *detail::Core::instance().getTestProgram().getRunningTestCase()->getStep(index);
+		}
+	};
+
+
+	TEST_F(FormattedStepIntegrationTest, testNumericArgumentsAreFormattedWhenNameIsRead)
+	{
+		int frame = 3;
+		bool executed = false;
+		step("Frame {} of {} at {:.1f} fps ({})", frame, 4u, 29.97, true, [&]() { executed = true; });
+
+		ASSERT_TRUE(executed);
+		ASSERT_TRUE(getStep(0).hasDeferredName());
+		ASSERT_EQ("Frame 3 of 4 at 30.0 fps (true)", getStep(0).getName());
+		ASSERT_TRUE(getStep(0).hasDeferredName());
+	}
+
+	TEST_F(FormattedStepIntegrationTest, testDeferredNamesAreRenderedWhenTestEnds)
+	{
+		step("Frame {}", 3, [&]() {});
+
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		getEventListener().onTestEnd(model::Status::PASSED);
+		getEventListener().onTestStart("FormattedStepTestCase");
+
+		const model::Step& endedStep = *testProgram.getTestSuite(0).getTestCases()[0].getStep(0);
+		ASSERT_FALSE(endedStep.hasDeferredName());
+		ASSERT_EQ("Frame 3", endedStep.getName());
+	}
+
+	TEST_F(FormattedStepIntegrationTest, testStringArgumentsAreFormattedImmediately)
+	{
+		std::string codec = "h264";
+		step("Open {} stream {}", codec, 2, [&]() {});
+
+		ASSERT_FALSE(getStep(0).hasDeferredName());
+		ASSERT_EQ("Open h264 stream 2", getStep(0).getName());
+	}
+
+	TEST_F(FormattedStepIntegrationTest, testNamesLongerThanInlineBufferAreFormattedImmediately)
+	{
+		step("A step name long enough not to fit in the inline buffer of deferred names: {}", 1, [&]() {});
+
+		ASSERT_FALSE(getStep(0).hasDeferredName());
+		ASSERT_EQ("A step name long enough not to fit in the inline buffer of deferred names: 1", getStep(0).getName());
+	}
+
+}}}
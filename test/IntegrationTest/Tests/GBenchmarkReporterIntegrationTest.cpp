@@ -0,0 +1,130 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+#ifdef ALLURE_GOOGLEBENCHMARK_ENABLED
+
+#include "Framework/Adapters/GoogleBenchmark/GBenchmarkReporter.h"
+#include "Services/ServicesFactory.h"
+
+using namespace testing;
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class GBenchmarkReporterIntegrationTest : public testing::Test
+											, public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+			detail::Core::instance().getTestProgram().setOutputFolder("IntegrationTest\\OutputFolder");
+
+			auto& servicesFactory = *service::ServicesFactory::getInstance();
+			m_programStartHandler = servicesFactory.buildTestProgramStartEventHandler();
+			m_programEndHandler = servicesFactory.buildTestProgramEndEventHandler();
+			m_suiteStartHandler = servicesFactory.buildTestSuiteStartEventHandler();
+			m_suiteEndHandler = servicesFactory.buildTestSuiteEndEventHandler();
+			m_caseStartHandler = servicesFactory.buildTestCaseStartEventHandler();
+			m_caseEndHandler = servicesFactory.buildTestCaseEndEventHandler();
+			m_reporter = std::make_unique<adapters::googlebenchmark::GBenchmarkReporter>(
+				m_programStartHandler.get(), m_programEndHandler.get(),
+				m_suiteStartHandler.get(), m_suiteEndHandler.get(),
+				m_caseStartHandler.get(), m_caseEndHandler.get(), nullptr);
+		}
+
+		void TearDown()
+		{
+			BaseIntegrationTest::TearDown();
+		}
+
+		benchmark::BenchmarkReporter::Run buildRun(const std::string& family, const std::string& args,
+												   double realSeconds, int64_t iterations)
+		{
+			benchmark::BenchmarkReporter::Run run;
+			run.run_name.function_name = family;
+			run.run_name.args = args;
+			run.family_index = 0;
+			run.per_family_instance_index = 0;
+			run.repetition_index = 0;
+			run.repetitions = 1;
+			run.time_unit = benchmark::kNanosecond;
+			run.iterations = iterations;
+			run.real_accumulated_time = realSeconds;
+			run.cpu_accumulated_time = realSeconds;
+			return run;
+		}
+
+		const model::Parameter* findParameter(const model::TestCase& testCase, const std::string& name)
+		{
+			for (const auto& parameter : testCase.getParameters())
+			{
+				if (parameter.getName() == name)
+				{
+					return &parameter;
+				}
+			}
+			return nullptr;
+		}
+
+	protected:
+		std::unique_ptr<service::ITestProgramStartEventHandler> m_programStartHandler;
+		std::unique_ptr<service::ITestProgramEndEventHandler> m_programEndHandler;
+		std::unique_ptr<service::ITestSuiteStartEventHandler> m_suiteStartHandler;
+		std::unique_ptr<service::ITestSuiteEndEventHandler> m_suiteEndHandler;
+		std::unique_ptr<service::ITestCaseStartEventHandler> m_caseStartHandler;
+		std::unique_ptr<service::ITestCaseEndEventHandler> m_caseEndHandler;
+		std::unique_ptr<adapters::googlebenchmark::GBenchmarkReporter> m_reporter;
+	};
+
+
+	TEST_F(GBenchmarkReporterIntegrationTest, testFamiliesAreReportedAsSuitesAndRunsAsTestCases)
+	{
+		auto sortRun = buildRun("BM_Sort", "1024", 0.002, 1000);
+		sortRun.counters["bytes_per_second"] = benchmark::Counter(2048.0, benchmark::Counter::kIsRate);
+		sortRun.counters["items_per_second"] = benchmark::Counter(500.0, benchmark::Counter::kIsRate);
+		auto meanRun = buildRun("BM_Sort", "1024", 0.003, 1000);
+		meanRun.run_type = benchmark::BenchmarkReporter::Run::RT_Aggregate;
+		meanRun.aggregate_name = "mean";
+		auto failedRun = buildRun("BM_Parse", "", 0.0, 0);
+		failedRun.error_occurred = true;
+		failedRun.error_message = "input file missing";
+
+		m_reporter->ReportContext(benchmark::BenchmarkReporter::Context());
+		m_reporter->ReportRuns({ sortRun, meanRun });
+		m_reporter->ReportRuns({ failedRun });
+		m_reporter->Finalize();
+
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		ASSERT_EQ(2u, testProgram.getTestSuitesCount());
+		const auto& sortSuite = testProgram.getTestSuite(0);
+		ASSERT_EQ("BM_Sort", sortSuite.getName());
+		ASSERT_EQ(2u, sortSuite.getTestCases().size());
+
+		const model::TestCase& sortTestCase = sortSuite.getTestCases()[0];
+		ASSERT_EQ("BM_Sort/1024", sortTestCase.getName());
+		ASSERT_EQ(model::Status::PASSED, sortTestCase.getStatus());
+		ASSERT_EQ(2000u, sortTestCase.getDurationNs());
+		ASSERT_EQ("1024", findParameter(sortTestCase, "arguments")->getValue());
+		ASSERT_EQ("2000 ns", findParameter(sortTestCase, "real time")->getValue());
+		ASSERT_EQ("1000", findParameter(sortTestCase, "iterations")->getValue());
+		ASSERT_EQ("2 KiB/s", findParameter(sortTestCase, "bytes_per_second")->getValue());
+		ASSERT_EQ("500/s", findParameter(sortTestCase, "items_per_second")->getValue());
+		ASSERT_TRUE(findParameter(sortTestCase, "real time")->getExcluded());
+
+		const model::TestCase& meanTestCase = sortSuite.getTestCases()[1];
+		ASSERT_EQ("BM_Sort/1024_mean", meanTestCase.getName());
+		ASSERT_EQ("mean", findParameter(meanTestCase, "aggregate")->getValue());
+		ASSERT_EQ(3000u, meanTestCase.getDurationNs());
+
+		const auto& parseSuite = testProgram.getTestSuite(1);
+		ASSERT_EQ("BM_Parse", parseSuite.getName());
+		ASSERT_EQ(model::Status::FAILED, parseSuite.getStatus());
+		const model::TestCase& failedTestCase = parseSuite.getTestCases()[0];
+		ASSERT_EQ(model::Status::BROKEN, failedTestCase.getStatus());
+		ASSERT_EQ("input file missing", failedTestCase.getStatusMessage());
+	}
+
+}}}
+
+#endif
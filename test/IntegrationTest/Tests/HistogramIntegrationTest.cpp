@@ -0,0 +1,60 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+using namespace testing;
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class HistogramIntegrationTest : public testing::Test
+								   , public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+		}
+
+		void TearDown()
+		{
+			BaseIntegrationTest::TearDown();
+		}
+	};
+
+
+	TEST_F(HistogramIntegrationTest, testNamedHistogramIsReportedWhenDestroyed)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("HistogramTestSuite");
+		listener.onTestStart("HistogramTestCase");
+
+		{
+			Histogram latency("request latency");
+			Histogram workerLatency;
+			for (uint64_t value = 1; value <= 1000; value++)
+			{
+				workerLatency.record(value * 1000);
+			}
+			latency.merge(workerLatency);
+		}
+
+		const model::TestCase* testCase = testProgram.getRunningTestCase();
+		const auto& parameters = testCase->getParameters();
+		ASSERT_EQ(6u, parameters.size());
+		ASSERT_EQ("request latency p50", parameters[0].getName());
+		ASSERT_EQ("501.8 us", parameters[0].getValue());
+		ASSERT_EQ("request latency max", parameters[4].getName());
+		ASSERT_EQ("1 ms", parameters[4].getValue());
+		ASSERT_EQ("1000", parameters[5].getValue());
+		ASSERT_TRUE(parameters[0].getExcluded());
+
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+	}
+
+}}}
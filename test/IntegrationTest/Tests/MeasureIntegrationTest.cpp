@@ -0,0 +1,65 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+#include <numeric>
+#include <vector>
+
+using namespace testing;
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class MeasureIntegrationTest : public testing::Test
+								 , public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+		}
+
+		void TearDown()
+		{
+			BaseIntegrationTest::TearDown();
+		}
+	};
+
+
+	TEST_F(MeasureIntegrationTest, testMeasureRecordsStepWithStatistics)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("MeasureTestSuite");
+		listener.onTestStart("MeasureTestCase");
+
+		std::vector<int> values(64, 1);
+		MeasureOptions options;
+		options.warmupTime = std::chrono::milliseconds(1);
+		options.targetTime = std::chrono::milliseconds(10);
+		options.attachSamples = false;
+		MeasureResult result = measure("Sum values", [&]() {
+			return std::accumulate(values.begin(), values.end(), 0);
+		}, options);
+
+		const model::TestCase* testCase = testProgram.getRunningTestCase();
+		ASSERT_EQ(1u, testCase->getStepCount());
+		ASSERT_EQ("Sum values", testCase->getStep(0)->getName());
+		const auto& parameters = testCase->getStep(0)->getParameters();
+		ASSERT_EQ(9u, parameters.size());
+		ASSERT_EQ("min", parameters[0].getName());
+		ASSERT_EQ("iterations/s", parameters[6].getName());
+
+		ASSERT_GE(result.samples.size(), options.minSamples);
+		ASSERT_GT(result.mean, 0.0);
+		ASSERT_LE(result.min, result.median);
+		ASSERT_LE(result.median, result.p99);
+
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+	}
+
+}}}
@@ -0,0 +1,75 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+#include "Services/Metrics/SelfProfiler.h"
+
+using namespace testing;
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class SelfProfilingIntegrationTest : public testing::Test
+									   , public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+			detail::getServicesFactory()->buildSelfProfiler()->reset();
+			allure::configure().selfProfiling();
+		}
+
+		void TearDown()
+		{
+			allure::configure().selfProfiling(false);
+			BaseIntegrationTest::TearDown();
+		}
+
+	protected:
+		bool isFileSaved(const std::string& filename) const
+		{
+			for (unsigned int i = 0; i < getSavedFilesCount(); i++)
+			{
+				const std::string& path = getSavedFile(i).m_path;
+				if ((path.size() >= filename.size()) && (path.compare(path.size() - filename.size(), filename.size(), filename) == 0))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+	};
+
+
+	TEST_F(SelfProfilingIntegrationTest, testOverheadIsReportedOnlyWhenBuiltIn)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("SelfProfilingTestSuite");
+		listener.onTestStart("SelfProfilingTestCase");
+		step("Profiled step", []() {});
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+
+		Stats overhead = allure::stats();
+		if (!overhead.enabled)
+		{
+			ASSERT_EQ(0u, overhead.totalNs());
+			ASSERT_EQ(0u, overhead.eventHandlers.calls);
+			ASSERT_FALSE(isFileSaved("allure-stats.json"));
+			return;
+		}
+
+		ASSERT_EQ(2u, overhead.stepGuards.calls);
+		ASSERT_EQ(8u, overhead.eventHandlers.calls);
+		ASSERT_GE(overhead.serialization.calls, 1u);
+		ASSERT_EQ(overhead.stepGuards.totalNs + overhead.eventHandlers.totalNs + overhead.serialization.totalNs +
+				  overhead.fileIO.totalNs + overhead.uuidGeneration.totalNs, overhead.totalNs());
+		ASSERT_TRUE(isFileSaved("allure-stats.json"));
+	}
+
+}}}
@@ -0,0 +1,65 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+#include "Model/StepNameRegistry.h"
+
+using namespace testing;
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class StaticStepIntegrationTest : public testing::Test
+									, public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+		}
+
+		void TearDown()
+		{
+			BaseIntegrationTest::TearDown();
+		}
+	};
+
+
+	TEST_F(StaticStepIntegrationTest, testStaticStepsRecordRegisteredNameIds)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("StaticStepTestSuite");
+		listener.onTestStart("StaticStepTestCase");
+
+		for (int i = 0; i < 2; i++)
+		{
+			auto guard = ALLURE_STEP("Open \"connection\"");
+		}
+		bool executed = false;
+		step(ALLURE_STEP_NAME("Send request"), [&]() { executed = true; });
+
+		const model::TestCase* testCase = testProgram.getRunningTestCase();
+		ASSERT_TRUE(executed);
+		ASSERT_EQ(3u, testCase->getStepCount());
+		ASSERT_NE(model::StepNameRegistry::NO_NAME, testCase->getStep(0)->getNameId());
+		ASSERT_EQ(testCase->getStep(0)->getNameId(), testCase->getStep(1)->getNameId());
+		ASSERT_NE(testCase->getStep(0)->getNameId(), testCase->getStep(2)->getNameId());
+		ASSERT_EQ("Open \"connection\"", testCase->getStep(0)->getName());
+		ASSERT_EQ("Send request", testCase->getStep(2)->getName());
+
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+
+		bool serialized = false;
+		for (unsigned int i = 0; i < getSavedFilesCount(); i++)
+		{
+			serialized = serialized || (getSavedFile(i).m_content.find("\"Action: Open \\\"connection\\\"\"") != std::string::npos);
+		}
+		ASSERT_TRUE(serialized);
+	}
+
+}}}
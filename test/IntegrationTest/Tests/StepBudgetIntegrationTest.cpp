@@ -0,0 +1,60 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+using namespace testing;
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class StepBudgetIntegrationTest : public testing::Test
+									, public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+		}
+
+		void TearDown()
+		{
+			BaseIntegrationTest::TearDown();
+		}
+	};
+
+
+	TEST_F(StepBudgetIntegrationTest, testStepWithinBudgetRecordsBudgetParameter)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("StepBudgetTestSuite");
+		listener.onTestStart("StepBudgetTestCase");
+
+		bool executed = false;
+		step("Decode frame", std::chrono::milliseconds(2), [&]() { executed = true; });
+		step("Encode frame", TimeBudget{ std::chrono::microseconds(500), model::Status::BROKEN, true }, [&]() {});
+		step("Frame {}", 3, [&]() {});
+		{
+			auto guard = step("Flush", std::chrono::seconds(1));
+		}
+
+		const model::TestCase* testCase = testProgram.getRunningTestCase();
+		ASSERT_TRUE(executed);
+		ASSERT_EQ(4u, testCase->getStepCount());
+		const model::Step& decodeStep = *testCase->getStep(0);
+		ASSERT_EQ(model::Status::PASSED, decodeStep.getStatus());
+		ASSERT_EQ("budget", decodeStep.getParameters()[0].getName());
+		ASSERT_EQ("2 ms", decodeStep.getParameters()[0].getValue());
+		ASSERT_EQ("500 us", testCase->getStep(1)->getParameters()[0].getValue());
+		ASSERT_EQ("Frame 3", testCase->getStep(2)->getName());
+		ASSERT_TRUE(testCase->getStep(2)->getParameters().empty());
+		ASSERT_EQ("1 s", testCase->getStep(3)->getParameters()[0].getValue());
+
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+	}
+
+}}}
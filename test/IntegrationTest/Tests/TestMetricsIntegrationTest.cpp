@@ -0,0 +1,92 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+#include "Services/Metrics/TestMetricRegistry.h"
+
+#include <thread>
+
+using namespace testing;
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class TestMetricsIntegrationTest : public testing::Test
+									 , public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+		}
+
+		void TearDown()
+		{
+			BaseIntegrationTest::TearDown();
+		}
+	};
+
+
+	TEST_F(TestMetricsIntegrationTest, testCountersAndGaugesAreReportedAtTestEnd)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+		ASSERT_FALSE(allure::counter("outside of tests"));
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("TestMetricsTestSuite");
+		listener.onTestStart("TestMetricsTestCase");
+
+		std::thread worker([]() { allure::counter("messages").add(5); });
+		auto messages = allure::counter("messages");
+		messages.add();
+		messages.add(4);
+		worker.join();
+		allure::gauge("queue depth").set(8.0);
+		allure::gauge("queue depth").set(2.0);
+
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+
+		const model::TestCase& testCase = testProgram.getTestSuite(0).getTestCases()[0];
+		const auto& parameters = testCase.getParameters();
+		ASSERT_EQ(2u, parameters.size());
+		ASSERT_EQ("messages", parameters[0].getName());
+		ASSERT_EQ("10", parameters[0].getValue());
+		ASSERT_TRUE(parameters[0].getExcluded());
+		ASSERT_EQ("queue depth", parameters[1].getName());
+		ASSERT_EQ(0u, parameters[1].getValue().find("last 2, min 2, max 8"));
+
+		ASSERT_EQ(1u, testCase.getAttachments().size());
+		ASSERT_EQ("gauges", testCase.getAttachments()[0].getName());
+		ASSERT_EQ("text/csv", testCase.getAttachments()[0].getType());
+	}
+
+	TEST_F(TestMetricsIntegrationTest, testCountersBeyondLimitAreReportedAsDropped)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("TestMetricsTestSuite");
+		listener.onTestStart("TestMetricsTestCase");
+
+		for (size_t i = 0; i < service::TestMetricRegistry::MAX_COUNTERS + 2; i++)
+		{
+			allure::counter("counter " + std::to_string(i)).add();
+		}
+
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+
+		const model::TestCase& testCase = testProgram.getTestSuite(0).getTestCases()[0];
+		const auto& parameters = testCase.getParameters();
+		ASSERT_EQ(service::TestMetricRegistry::MAX_COUNTERS + 1, parameters.size());
+		ASSERT_EQ("dropped counters", parameters.back().getName());
+		ASSERT_EQ("2", parameters.back().getValue());
+	}
+
+}}}
@@ -0,0 +1,141 @@
+#include "stdafx.h"
+#include "BaseIntegrationTest.h"
+
+#include <variant>
+
+using namespace testing;
+using namespace allure;
+
+namespace {
+
+	enum class Codec
+	{
+		PCM = 1,
+		FLAC = 7
+	};
+
+	enum class Channel
+	{
+		LEFT,
+		RIGHT
+	};
+
+	struct Resolution
+	{
+		int width;
+		int height;
+	};
+
+}
+
+template<>
+struct fmt::formatter<Resolution> : fmt::formatter<std::string_view>
+{
+	auto format(const Resolution& resolution, fmt::format_context& context) const
+	{
+		return fmt::format_to(context.out(), "{}x{}", resolution.width, resolution.height);
+	}
+};
+
+template<>
+struct fmt::formatter<Channel> : fmt::formatter<std::string_view>
+{
+	auto format(Channel channel, fmt::format_context& context) const
+	{
+		return fmt::formatter<std::string_view>::format((channel == Channel::LEFT) ? "left" : "right", context);
+	}
+};
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class TypedParameterIntegrationTest : public testing::Test
+										, public BaseIntegrationTest
+	{
+	public:
+		void SetUp()
+		{
+			BaseIntegrationTest::SetUp();
+		}
+
+		void TearDown()
+		{
+			BaseIntegrationTest::TearDown();
+		}
+	};
+
+
+	TEST_F(TypedParameterIntegrationTest, testTypedParametersKeepTheirNativeTypeUntilSerialized)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("TypedParameterTestSuite");
+		listener.onTestStart("TypedParameterTestCase");
+
+		test()
+			.parameter("frames", 42)
+			.parameter("gain", 0.5)
+			.parameter("stereo", true)
+			.parameter("codec", Codec::FLAC)
+			.parameter("resolution", Resolution{640, 480})
+			.parameter("label", "intro")
+			.parameter("offset", -3);
+
+		const model::TestCase* testCase = testProgram.getRunningTestCase();
+		const auto& parameters = testCase->getParameters();
+		ASSERT_EQ(7u, parameters.size());
+		ASSERT_EQ(model::Parameter::Value(int64_t(42)), parameters[0].getTypedValue());
+		ASSERT_EQ(model::Parameter::Value(0.5), parameters[1].getTypedValue());
+		ASSERT_EQ(model::Parameter::Value(true), parameters[2].getTypedValue());
+		ASSERT_EQ(model::Parameter::Value(int64_t(7)), parameters[3].getTypedValue());
+		ASSERT_FALSE(parameters[4].isTyped());
+		ASSERT_EQ("640x480", parameters[4].getValue());
+		ASSERT_EQ("intro", parameters[5].getValue());
+		ASSERT_EQ(model::Parameter::Value(int64_t(-3)), parameters[6].getTypedValue());
+
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+
+		std::string content;
+		for (unsigned int i = 0; i < getSavedFilesCount(); i++)
+		{
+			if (getSavedFile(i).m_content.find("\"frames\"") != std::string::npos)
+			{
+				content = getSavedFile(i).m_content;
+			}
+		}
+		ASSERT_NE(std::string::npos, content.find("{\"name\":\"frames\",\"typedValue\":42,\"value\":\"42\"}"));
+		ASSERT_NE(std::string::npos, content.find("{\"name\":\"gain\",\"typedValue\":0.5,\"value\":\"0.5\"}"));
+		ASSERT_NE(std::string::npos, content.find("{\"name\":\"stereo\",\"typedValue\":true,\"value\":\"true\"}"));
+		ASSERT_NE(std::string::npos, content.find("{\"name\":\"resolution\",\"value\":\"640x480\"}"));
+	}
+
+	TEST_F(TypedParameterIntegrationTest, testEnumsWithFormatterAreFormatted)
+	{
+		auto& testProgram = detail::Core::instance().getTestProgram();
+		testProgram.setOutputFolder("IntegrationTest\\OutputFolder");
+
+		auto& listener = getEventListener();
+		listener.onProgramStart();
+		listener.onTestSuiteStart("TypedParameterTestSuite");
+		listener.onTestStart("TypedParameterTestCase");
+
+		test()
+			.parameter("channel", Channel::RIGHT)
+			.parameter("codec", Codec::PCM);
+
+		const auto& parameters = testProgram.getRunningTestCase()->getParameters();
+		ASSERT_EQ(2u, parameters.size());
+		ASSERT_FALSE(parameters[0].isTyped());
+		ASSERT_EQ("right", parameters[0].getValue());
+		ASSERT_EQ(model::Parameter::Value(int64_t(1)), parameters[1].getTypedValue());
+
+		listener.onTestEnd(model::Status::PASSED);
+		listener.onTestSuiteEnd(model::Status::PASSED);
+		listener.onProgramEnd();
+	}
+
+}}}
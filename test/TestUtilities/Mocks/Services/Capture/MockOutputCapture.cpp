@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockOutputCapture.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockOutputCapture::MockOutputCapture() = default;
+	MockOutputCapture::~MockOutputCapture() = default;
+
+}} // namespace allure::test_utility
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Services/Capture/IOutputCapture.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockOutputCapture : public allure::service::IOutputCapture
+	{
+	public:
+		MockOutputCapture();
+		virtual ~MockOutputCapture();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_METHOD1(setEnabled, void(bool));
+
+		MOCK_CONST_METHOD0(isOnlyOnFailure, bool());
+		MOCK_METHOD1(setOnlyOnFailure, void(bool));
+
+		MOCK_CONST_METHOD0(isTee, bool());
+		MOCK_METHOD1(setTee, void(bool));
+
+		MOCK_CONST_METHOD0(getMemoryLimit, size_t());
+		MOCK_METHOD1(setMemoryLimit, void(size_t));
+
+		MOCK_METHOD0(beginTest, void());
+		MOCK_METHOD0(endTest, void());
+		MOCK_METHOD0(shutdown, void());
+
+		MOCK_CONST_METHOD0(isEmpty, bool());
+		MOCK_CONST_METHOD0(getCapturedBytes, uint64_t());
+		MOCK_CONST_METHOD0(getMemoryContent, std::string());
+		MOCK_CONST_METHOD1(appendSpilledContentTo, void(const std::string&));
+		MOCK_CONST_METHOD0(getContent, std::string());
+
+		MOCK_CONST_METHOD0(getTotalDrainedBytes, uint64_t());
+		MOCK_CONST_METHOD0(getTotalDrainNanoseconds, uint64_t());
+		MOCK_CONST_METHOD0(getTotalSyncNanoseconds, uint64_t());
+	};
+
+}} // namespace allure::test_utility
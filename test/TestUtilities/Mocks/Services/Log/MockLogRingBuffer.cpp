@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockLogRingBuffer.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockLogRingBuffer::MockLogRingBuffer() = default;
+	MockLogRingBuffer::~MockLogRingBuffer() = default;
+
+}} // namespace allure::test_utility
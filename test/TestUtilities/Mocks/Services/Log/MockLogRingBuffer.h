@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Services/Log/ILogRingBuffer.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockLogRingBuffer : public allure::service::ILogRingBuffer
+	{
+	public:
+		MockLogRingBuffer();
+		virtual ~MockLogRingBuffer();
+
+		MOCK_CONST_METHOD0(getCapacity, size_t());
+		MOCK_METHOD1(setCapacity, void(size_t));
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_CONST_METHOD0(isEmpty, bool());
+
+		MOCK_METHOD1(append, void(std::string_view));
+		MOCK_CONST_METHOD0(getContent, std::string());
+		MOCK_METHOD0(reset, void());
+	};
+
+}} // namespace allure::test_utility
@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockAllocationTracker.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockAllocationTracker::MockAllocationTracker() = default;
+	MockAllocationTracker::~MockAllocationTracker() = default;
+
+}} // namespace allure::test_utility
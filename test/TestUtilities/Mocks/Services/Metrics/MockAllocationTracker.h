@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Services/Metrics/IAllocationTracker.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockAllocationTracker : public allure::service::IAllocationTracker
+	{
+	public:
+		MockAllocationTracker();
+		virtual ~MockAllocationTracker();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_METHOD1(setEnabled, void(bool));
+
+		MOCK_CONST_METHOD0(isHooked, bool());
+		MOCK_METHOD1(setHooked, void(bool));
+
+		MOCK_METHOD2(recordAllocation, bool(size_t, size_t));
+		MOCK_METHOD1(recordDeallocation, void(size_t));
+		MOCK_METHOD1(recordCountedDeallocation, void(size_t));
+
+		MOCK_METHOD0(beginTest, void());
+		MOCK_METHOD0(endTest, Usage());
+
+		MOCK_METHOD0(beginStep, void());
+		MOCK_METHOD0(endStep, Usage());
+	};
+
+}} // namespace allure::test_utility
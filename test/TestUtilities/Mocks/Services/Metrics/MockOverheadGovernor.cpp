@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockOverheadGovernor.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockOverheadGovernor::MockOverheadGovernor() = default;
+	MockOverheadGovernor::~MockOverheadGovernor() = default;
+
+}} // namespace allure::test_utility
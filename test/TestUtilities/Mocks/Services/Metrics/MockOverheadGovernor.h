@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Services/Metrics/IOverheadGovernor.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockOverheadGovernor : public allure::service::IOverheadGovernor
+	{
+	public:
+		MockOverheadGovernor();
+		virtual ~MockOverheadGovernor();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_METHOD1(setEnabled, void(bool));
+
+		MOCK_CONST_METHOD0(getBudget, double());
+		MOCK_METHOD1(setBudget, void(double));
+
+		MOCK_CONST_METHOD0(getWindow, unsigned int());
+		MOCK_METHOD1(setWindow, void(unsigned int));
+
+		MOCK_CONST_METHOD0(getLevel, allure::model::CaptureLevel());
+		MOCK_METHOD0(reset, void());
+
+		MOCK_METHOD0(beginTest, void());
+		MOCK_METHOD1(endTest, void(uint64_t));
+		MOCK_METHOD2(recordTest, void(uint64_t, uint64_t));
+
+		MOCK_CONST_METHOD1(getStepCoalescingThreshold, unsigned int(unsigned int));
+		MOCK_CONST_METHOD1(getStepDetailPolicy, allure::model::StepDetailPolicy(allure::model::StepDetailPolicy));
+		MOCK_CONST_METHOD0(isDeferringAttachments, bool());
+	};
+
+}} // namespace allure::test_utility
@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockPerfCounterGroup.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockPerfCounterGroup::MockPerfCounterGroup() = default;
+	MockPerfCounterGroup::~MockPerfCounterGroup() = default;
+
+}} // namespace allure::test_utility
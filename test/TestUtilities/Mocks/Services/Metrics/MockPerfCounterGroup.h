@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Services/Metrics/IPerfCounterGroup.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockPerfCounterGroup : public allure::service::IPerfCounterGroup
+	{
+	public:
+		MockPerfCounterGroup();
+		virtual ~MockPerfCounterGroup();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_CONST_METHOD0(getCounters, const std::vector<allure::model::PerfCounter>&());
+		MOCK_METHOD1(setCounters, void(const std::vector<allure::model::PerfCounter>&));
+
+		MOCK_CONST_METHOD0(isPerStep, bool());
+		MOCK_METHOD1(setPerStep, void(bool));
+
+		MOCK_METHOD0(isAvailable, bool());
+		MOCK_METHOD0(getOpenCounters, const std::vector<allure::model::PerfCounter>&());
+
+		MOCK_METHOD0(beginTest, void());
+		MOCK_METHOD0(endTest, std::vector<allure::model::Metric>());
+
+		MOCK_METHOD0(beginStep, void());
+		MOCK_METHOD0(endStep, std::vector<allure::model::Metric>());
+	};
+
+}} // namespace allure::test_utility
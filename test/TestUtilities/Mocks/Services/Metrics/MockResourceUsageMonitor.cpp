@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockResourceUsageMonitor.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockResourceUsageMonitor::MockResourceUsageMonitor() = default;
+	MockResourceUsageMonitor::~MockResourceUsageMonitor() = default;
+
+}} // namespace allure::test_utility
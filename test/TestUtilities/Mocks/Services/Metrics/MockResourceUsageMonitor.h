@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Services/Metrics/IResourceUsageMonitor.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockResourceUsageMonitor : public allure::service::IResourceUsageMonitor
+	{
+	public:
+		MockResourceUsageMonitor();
+		virtual ~MockResourceUsageMonitor();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_METHOD1(setEnabled, void(bool));
+
+		MOCK_METHOD0(beginTest, void());
+		MOCK_METHOD0(endTest, allure::service::ResourceUsage());
+
+		MOCK_METHOD1(sample, allure::service::ResourceUsage(bool));
+
+		MOCK_CONST_METHOD0(getMeasuredTestCount, uint64_t());
+		MOCK_CONST_METHOD0(getTotalOverheadNanoseconds, uint64_t());
+	};
+
+}} // namespace allure::test_utility
@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockSelfProfiler.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockSelfProfiler::MockSelfProfiler() = default;
+	MockSelfProfiler::~MockSelfProfiler() = default;
+
+}} // namespace allure::test_utility
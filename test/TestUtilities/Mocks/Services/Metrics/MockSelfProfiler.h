@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Services/Metrics/ISelfProfiler.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockSelfProfiler : public allure::service::ISelfProfiler
+	{
+	public:
+		MockSelfProfiler();
+		virtual ~MockSelfProfiler();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_METHOD1(setEnabled, void(bool));
+
+		MOCK_METHOD2(recordPhase, void(Phase, uint64_t));
+		MOCK_METHOD1(recordFileWritten, void(uint64_t));
+		MOCK_METHOD1(recordAllocation, void(uint64_t));
+
+		MOCK_CONST_METHOD0(getTotals, Totals());
+		MOCK_CONST_METHOD0(getTotalNs, uint64_t());
+		MOCK_METHOD0(reset, void());
+	};
+
+}} // namespace allure::test_utility
@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockTestMetricRegistry.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockTestMetricRegistry::MockTestMetricRegistry() = default;
+	MockTestMetricRegistry::~MockTestMetricRegistry() = default;
+
+}} // namespace allure::test_utility
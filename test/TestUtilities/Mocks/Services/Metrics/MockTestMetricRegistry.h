@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Services/Metrics/ITestMetricRegistry.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockTestMetricRegistry : public allure::service::ITestMetricRegistry
+	{
+	public:
+		MockTestMetricRegistry();
+		virtual ~MockTestMetricRegistry();
+
+		MOCK_CONST_METHOD0(isTestRunning, bool());
+
+		MOCK_CONST_METHOD0(getSampleIntervalNanoseconds, int64_t());
+		MOCK_METHOD1(setSampleIntervalNanoseconds, void(int64_t));
+
+		MOCK_CONST_METHOD0(getMaxSamples, size_t());
+		MOCK_METHOD1(setMaxSamples, void(size_t));
+
+		MOCK_CONST_METHOD0(getSeriesFormat, allure::model::SeriesFormat());
+		MOCK_METHOD1(setSeriesFormat, void(allure::model::SeriesFormat));
+
+		MOCK_METHOD1(getCounter, std::atomic<int64_t>*(std::string_view));
+		MOCK_METHOD1(getGauge, allure::service::GaugeSlot*(std::string_view));
+		MOCK_METHOD2(setGauge, void(allure::service::GaugeSlot&, double));
+
+		MOCK_METHOD0(beginTest, void());
+		MOCK_METHOD0(endTest, Metrics());
+	};
+
+}} // namespace allure::test_utility
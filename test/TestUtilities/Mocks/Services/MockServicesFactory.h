@@ -70,6 +70,20 @@ namespace allure { namespace test_utility {
 
 		std::unique_ptr<allure::service::ITimeService> buildTimeService() const;
 		MOCK_CONST_METHOD0(buildTimeServiceProxy, allure::service::ITimeService*());
+
+
+		// Shared services
+		MOCK_CONST_METHOD0(buildLogRingBuffer, std::shared_ptr<allure::service::ILogRingBuffer>());
+		MOCK_CONST_METHOD0(buildOutputCapture, std::shared_ptr<allure::service::IOutputCapture>());
+		MOCK_CONST_METHOD0(buildResourceUsageMonitor, std::shared_ptr<allure::service::IResourceUsageMonitor>());
+		MOCK_CONST_METHOD0(buildPerfCounterGroup, std::shared_ptr<allure::service::IPerfCounterGroup>());
+		MOCK_CONST_METHOD0(buildAllocationTracker, std::shared_ptr<allure::service::IAllocationTracker>());
+		MOCK_CONST_METHOD0(buildDurationBaselineStore, std::shared_ptr<allure::service::IDurationBaselineStore>());
+		MOCK_CONST_METHOD0(buildTestMetricRegistry, std::shared_ptr<allure::service::ITestMetricRegistry>());
+		MOCK_CONST_METHOD0(buildChromeTraceWriter, std::shared_ptr<allure::service::IChromeTraceWriter>());
+		MOCK_CONST_METHOD0(buildFlameGraphBuilder, std::shared_ptr<allure::service::IFlameGraphBuilder>());
+		MOCK_CONST_METHOD0(buildSelfProfiler, std::shared_ptr<allure::service::ISelfProfiler>());
+		MOCK_CONST_METHOD0(buildOverheadGovernor, std::shared_ptr<allure::service::IOverheadGovernor>());
 	};
 
 }} // namespace allure::test_utility
@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockChromeTraceWriter.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockChromeTraceWriter::MockChromeTraceWriter() = default;
+	MockChromeTraceWriter::~MockChromeTraceWriter() = default;
+
+}} // namespace allure::test_utility
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Model/Step.h"
+#include "Model/TestCase.h"
+#include "Model/TestSuite.h"
+#include "Services/Report/IChromeTraceWriter.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockChromeTraceWriter : public allure::service::IChromeTraceWriter
+	{
+	public:
+		MockChromeTraceWriter();
+		virtual ~MockChromeTraceWriter();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_METHOD1(setEnabled, void(bool));
+
+		MOCK_CONST_METHOD0(isOpen, bool());
+		MOCK_METHOD1(open, void(const std::string&));
+		MOCK_METHOD0(close, void());
+
+		MOCK_METHOD1(writeStep, void(const allure::model::Step&));
+		MOCK_METHOD1(writeTestCase, void(const allure::model::TestCase&));
+		MOCK_METHOD2(writeTestSuite, void(const allure::model::TestSuite&, uint64_t));
+	};
+
+}} // namespace allure::test_utility
@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockDurationBaselineStore.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockDurationBaselineStore::MockDurationBaselineStore() = default;
+	MockDurationBaselineStore::~MockDurationBaselineStore() = default;
+
+}} // namespace allure::test_utility
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Services/Report/IDurationBaselineStore.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockDurationBaselineStore : public allure::service::IDurationBaselineStore
+	{
+	public:
+		MockDurationBaselineStore();
+		virtual ~MockDurationBaselineStore();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_METHOD1(setEnabled, void(bool));
+
+		MOCK_CONST_METHOD0(getWindow, unsigned int());
+		MOCK_METHOD1(setWindow, void(unsigned int));
+
+		MOCK_CONST_METHOD0(getThreshold, double());
+		MOCK_METHOD1(setThreshold, void(double));
+
+		MOCK_CONST_METHOD0(isMarkFlaky, bool());
+		MOCK_METHOD1(setMarkFlaky, void(bool));
+
+		MOCK_CONST_METHOD0(isMarkKnown, bool());
+		MOCK_METHOD1(setMarkKnown, void(bool));
+
+		MOCK_METHOD1(load, void(const std::string&));
+		MOCK_METHOD1(loadFile, void(const std::string&));
+		MOCK_CONST_METHOD0(serialize, std::string());
+		MOCK_METHOD0(clear, void());
+
+		MOCK_CONST_METHOD1(getBaseline, const allure::service::DurationBaseline*(const std::string&));
+		MOCK_CONST_METHOD2(isRegression, bool(const allure::service::DurationBaseline&, uint64_t));
+		MOCK_CONST_METHOD2(buildRegressionMessage, std::string(const allure::service::DurationBaseline&, uint64_t));
+
+		MOCK_METHOD2(record, void(const std::string&, uint64_t));
+		MOCK_METHOD0(update, void());
+	};
+
+}} // namespace allure::test_utility
@@ -0,0 +1,10 @@
+#include "stdafx.h"
+#include "MockFlameGraphBuilder.h"
+
+
+namespace allure { namespace test_utility {
+
+	MockFlameGraphBuilder::MockFlameGraphBuilder() = default;
+	MockFlameGraphBuilder::~MockFlameGraphBuilder() = default;
+
+}} // namespace allure::test_utility
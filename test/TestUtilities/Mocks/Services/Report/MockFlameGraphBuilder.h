@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Services/Report/IFlameGraphBuilder.h"
+
+
+namespace allure { namespace test_utility {
+
+	class MockFlameGraphBuilder : public allure::service::IFlameGraphBuilder
+	{
+	public:
+		MockFlameGraphBuilder();
+		virtual ~MockFlameGraphBuilder();
+
+		MOCK_CONST_METHOD0(isEnabled, bool());
+		MOCK_METHOD1(setEnabled, void(bool));
+
+		MOCK_METHOD1(addStacks, void(const Stacks&));
+		MOCK_CONST_METHOD0(getRunStacks, Stacks());
+		MOCK_METHOD0(clear, void());
+	};
+
+}} // namespace allure::test_utility
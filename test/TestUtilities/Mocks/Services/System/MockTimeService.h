@@ -12,6 +12,7 @@ namespace allure { namespace test_utility {
 		virtual ~MockTimeService();
 
 		MOCK_CONST_METHOD0(getCurrentTime, time_t());
+		MOCK_CONST_METHOD0(getMonotonicNanoseconds, int64_t());
 	};
 
 }} // namespace allure::test_utility
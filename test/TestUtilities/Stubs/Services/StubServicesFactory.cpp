@@ -2,6 +2,7 @@
 #include "StubServicesFactory.h"
 
 #include "Model/TestProgram.h"
+#include "Services/Capture/OutputCapture.h"
 #include "Services/EventHandlers/TestCaseEndEventHandler.h"
 #include "Services/EventHandlers/TestCaseStartEventHandler.h"
 #include "Services/EventHandlers/TestProgramEndEventHandler.h"
@@ -12,8 +13,18 @@
 #include "Services/EventHandlers/TestSuiteStartEventHandler.h"
 #include "Services/GoogleTest/GTestEventListener.h"
 #include "Services/GoogleTest/GTestStatusChecker.h"
+#include "Services/Log/LogRingBuffer.h"
+#include "Services/Metrics/AllocationTracker.h"
+#include "Services/Metrics/OverheadGovernor.h"
+#include "Services/Metrics/PerfCounterGroup.h"
+#include "Services/Metrics/ResourceUsageMonitor.h"
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Metrics/TestMetricRegistry.h"
 #include "Services/Property/TestCasePropertySetter.h"
 #include "Services/Property/TestSuitePropertySetter.h"
+#include "Services/Report/ChromeTraceWriter.h"
+#include "Services/Report/DurationBaselineStore.h"
+#include "Services/Report/FlameGraphBuilder.h"
 #include "Services/Report/TestCaseJSONSerializer.h"
 #include "Services/Report/ContainerJSONSerializer.h"
 #include "Services/Report/TestSuiteJSONSerializer.h"
@@ -29,6 +40,16 @@ namespace allure { namespace test_utility {
 
 	StubServicesFactory::StubServicesFactory(allure::model::TestProgram& testProgram)
 		:m_testProgram(testProgram)
+		,m_logRingBuffer(std::make_shared<allure::service::LogRingBuffer>())
+		,m_outputCapture(std::make_shared<allure::service::OutputCapture>())
+		,m_resourceUsageMonitor(std::make_shared<allure::service::ResourceUsageMonitor>())
+		,m_perfCounterGroup(std::make_shared<allure::service::PerfCounterGroup>())
+		,m_durationBaselineStore(std::make_shared<allure::service::DurationBaselineStore>())
+		,m_testMetricRegistry(std::make_shared<allure::service::TestMetricRegistry>())
+		,m_chromeTraceWriter(std::make_shared<allure::service::ChromeTraceWriter>())
+		,m_flameGraphBuilder(std::make_shared<allure::service::FlameGraphBuilder>())
+		,m_overheadGovernor(std::make_shared<allure::service::OverheadGovernor>(std::shared_ptr<allure::service::ISelfProfiler>(
+			std::shared_ptr<allure::service::ISelfProfiler>(), &allure::service::SelfProfiler::instance())))
 	{
 		ON_CALL(*this, buildGTestEventListenerProxy()).WillByDefault(Invoke(this, &StubServicesFactory::buildGTestEventListenerStub));
 		ON_CALL(*this, buildGTestStatusCheckerProxy()).WillByDefault(Invoke(this, &StubServicesFactory::buildGTestStatusCheckerStub));
@@ -51,6 +72,20 @@ namespace allure { namespace test_utility {
 		ON_CALL(*this, buildUUIDGeneratorServiceProxy()).WillByDefault(Invoke(this, &StubServicesFactory::buildUUIDGeneratorServiceStub));
 		ON_CALL(*this, buildFileServiceProxy()).WillByDefault(Invoke(this, &StubServicesFactory::buildFileServiceStub));
 		ON_CALL(*this, buildTimeServiceProxy()).WillByDefault(Invoke(this, &StubServicesFactory::buildTimeServiceStub));
+
+		ON_CALL(*this, buildLogRingBuffer()).WillByDefault(Return(m_logRingBuffer));
+		ON_CALL(*this, buildOutputCapture()).WillByDefault(Return(m_outputCapture));
+		ON_CALL(*this, buildResourceUsageMonitor()).WillByDefault(Return(m_resourceUsageMonitor));
+		ON_CALL(*this, buildPerfCounterGroup()).WillByDefault(Return(m_perfCounterGroup));
+		ON_CALL(*this, buildDurationBaselineStore()).WillByDefault(Return(m_durationBaselineStore));
+		ON_CALL(*this, buildTestMetricRegistry()).WillByDefault(Return(m_testMetricRegistry));
+		ON_CALL(*this, buildChromeTraceWriter()).WillByDefault(Return(m_chromeTraceWriter));
+		ON_CALL(*this, buildFlameGraphBuilder()).WillByDefault(Return(m_flameGraphBuilder));
+		ON_CALL(*this, buildOverheadGovernor()).WillByDefault(Return(m_overheadGovernor));
+		ON_CALL(*this, buildSelfProfiler()).WillByDefault(Return(std::shared_ptr<allure::service::ISelfProfiler>(
+			std::shared_ptr<allure::service::ISelfProfiler>(), &allure::service::SelfProfiler::instance())));
+		ON_CALL(*this, buildAllocationTracker()).WillByDefault(Return(std::shared_ptr<allure::service::IAllocationTracker>(
+			std::shared_ptr<allure::service::IAllocationTracker>(), &allure::service::AllocationTracker::instance())));
 	}
 
 	StubServicesFactory::~StubServicesFactory() = default;
@@ -80,7 +115,9 @@ namespace allure { namespace test_utility {
 	// Lifecycle events handling services
 	allure::service::ITestProgramStartEventHandler* StubServicesFactory::buildTestProgramStartEventHandlerStub() const
 	{
-		return new allure::service::TestProgramStartEventHandler(m_testProgram);
+		auto durationBaselineStore = buildDurationBaselineStore();
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		return new allure::service::TestProgramStartEventHandler(m_testProgram, std::move(durationBaselineStore), std::move(chromeTraceWriter));
 	}
 
 	allure::service::ITestSuiteStartEventHandler* StubServicesFactory::buildTestSuiteStartEventHandlerStub() const
@@ -94,19 +131,34 @@ namespace allure { namespace test_utility {
 	{
 		auto uuidGeneratorService = buildUUIDGeneratorService();
 		auto timeService = buildTimeService();
-		return new allure::service::TestCaseStartEventHandler(m_testProgram, std::move(uuidGeneratorService), std::move(timeService));
+		auto outputCapture = buildOutputCapture();
+		auto resourceUsageMonitor = buildResourceUsageMonitor();
+		auto perfCounterGroup = buildPerfCounterGroup();
+		auto allocationTracker = buildAllocationTracker();
+		auto testMetricRegistry = buildTestMetricRegistry();
+		auto overheadGovernor = buildOverheadGovernor();
+		return new allure::service::TestCaseStartEventHandler(m_testProgram, std::move(uuidGeneratorService), std::move(timeService),
+		                                                      std::move(outputCapture), std::move(resourceUsageMonitor), std::move(perfCounterGroup),
+		                                                      std::move(allocationTracker), std::move(testMetricRegistry), std::move(overheadGovernor));
 	}
 
 	allure::service::ITestStepStartEventHandler* StubServicesFactory::buildTestStepStartEventHandlerStub() const
 	{
 		auto timeService = buildTimeService();
-		return new allure::service::TestStepStartEventHandler(m_testProgram, std::move(timeService));
+		auto perfCounterGroup = buildPerfCounterGroup();
+		auto allocationTracker = buildAllocationTracker();
+		return new allure::service::TestStepStartEventHandler(m_testProgram, std::move(timeService), std::move(perfCounterGroup), std::move(allocationTracker));
 	}
 
 	allure::service::ITestStepEndEventHandler* StubServicesFactory::buildTestStepEndEventHandlerStub() const
 	{
 		auto timeService = buildTimeService();
-		return new allure::service::TestStepEndEventHandler(m_testProgram, std::move(timeService));
+		auto perfCounterGroup = buildPerfCounterGroup();
+		auto allocationTracker = buildAllocationTracker();
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		auto overheadGovernor = buildOverheadGovernor();
+		return new allure::service::TestStepEndEventHandler(m_testProgram, std::move(timeService), std::move(perfCounterGroup),
+		                                                    std::move(allocationTracker), std::move(chromeTraceWriter), std::move(overheadGovernor));
 	}
 
 	allure::service::ITestCaseEndEventHandler* StubServicesFactory::buildTestCaseEndEventHandlerStub() const
@@ -114,7 +166,20 @@ namespace allure { namespace test_utility {
 		auto timeService = buildTimeService();
 		auto testCaseJSONSerializer = std::unique_ptr<allure::service::ITestCaseJSONSerializer>(buildTestCaseJSONSerializerStub());
 		auto fileService = buildFileService();
-		return new allure::service::TestCaseEndEventHandler(m_testProgram, std::move(timeService), std::move(testCaseJSONSerializer), std::move(fileService));
+		auto logRingBuffer = buildLogRingBuffer();
+		auto outputCapture = buildOutputCapture();
+		auto resourceUsageMonitor = buildResourceUsageMonitor();
+		auto perfCounterGroup = buildPerfCounterGroup();
+		auto allocationTracker = buildAllocationTracker();
+		auto durationBaselineStore = buildDurationBaselineStore();
+		auto testMetricRegistry = buildTestMetricRegistry();
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		auto flameGraphBuilder = buildFlameGraphBuilder();
+		auto overheadGovernor = buildOverheadGovernor();
+		return new allure::service::TestCaseEndEventHandler(m_testProgram, std::move(timeService), std::move(testCaseJSONSerializer), std::move(fileService),
+		                                                    std::move(logRingBuffer), std::move(outputCapture), std::move(resourceUsageMonitor), std::move(perfCounterGroup),
+		                                                    std::move(allocationTracker), std::move(durationBaselineStore), std::move(testMetricRegistry),
+		                                                    std::move(chromeTraceWriter), std::move(flameGraphBuilder), std::move(overheadGovernor));
 	}
 
 	allure::service::ITestSuiteEndEventHandler* StubServicesFactory::buildTestSuiteEndEventHandlerStub() const
@@ -122,13 +187,18 @@ namespace allure { namespace test_utility {
 		auto timeService = buildTimeService();
 		auto containerJSONSerializer = std::unique_ptr<allure::service::IContainerJSONSerializer>(buildContainerJSONSerializerStub());
 		auto fileService = buildFileService();
-		return new allure::service::TestSuiteEndEventHandler(m_testProgram, std::move(timeService), std::move(containerJSONSerializer), std::move(fileService));
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		return new allure::service::TestSuiteEndEventHandler(m_testProgram, std::move(timeService), std::move(containerJSONSerializer),
+		                                                     std::move(fileService), std::move(chromeTraceWriter));
 	}
 
 	allure::service::ITestProgramEndEventHandler* StubServicesFactory::buildTestProgramEndEventHandlerStub() const
 	{
 		auto testProgramJSONBuilder = buildTestProgramJSONBuilder();
-		return new allure::service::TestProgramEndEventHandler(m_testProgram, std::move(testProgramJSONBuilder));
+		auto outputCapture = buildOutputCapture();
+		auto chromeTraceWriter = buildChromeTraceWriter();
+		return new allure::service::TestProgramEndEventHandler(m_testProgram, std::move(testProgramJSONBuilder), std::move(outputCapture),
+		                                                       std::move(chromeTraceWriter));
 	}
 
 
@@ -154,10 +224,16 @@ namespace allure { namespace test_utility {
 			std::make_unique<allure::service::ContainerJSONSerializer>();
 
 		auto fileService = buildFileService();
+		auto durationBaselineStore = buildDurationBaselineStore();
+		auto flameGraphBuilder = buildFlameGraphBuilder();
+		auto selfProfiler = buildSelfProfiler();
 
 		return new allure::service::TestProgramJSONBuilder(std::move(testCaseJSONSerializer),
 		                                                        std::move(containerJSONSerializer),
-		                                                        std::move(fileService));
+		                                                        std::move(fileService),
+		                                                        std::move(durationBaselineStore),
+		                                                        std::move(flameGraphBuilder),
+		                                                        std::move(selfProfiler));
 	}
 
 	allure::service::ITestCaseJSONSerializer* StubServicesFactory::buildTestCaseJSONSerializerStub() const
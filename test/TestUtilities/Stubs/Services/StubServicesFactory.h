@@ -5,8 +5,17 @@
 
 
 namespace allure { namespace service {
+	class ChromeTraceWriter;
+	class DurationBaselineStore;
+	class FlameGraphBuilder;
 	class ITestCaseJSONSerializer;
 	class IContainerJSONSerializer;
+	class LogRingBuffer;
+	class OutputCapture;
+	class OverheadGovernor;
+	class PerfCounterGroup;
+	class ResourceUsageMonitor;
+	class TestMetricRegistry;
 }} // namespace allure::service
 
 namespace allure { namespace test_utility {
@@ -48,6 +57,15 @@ namespace allure { namespace test_utility {
 
 	private:
 		allure::model::TestProgram& m_testProgram;
+		std::shared_ptr<allure::service::LogRingBuffer> m_logRingBuffer;
+		std::shared_ptr<allure::service::OutputCapture> m_outputCapture;
+		std::shared_ptr<allure::service::ResourceUsageMonitor> m_resourceUsageMonitor;
+		std::shared_ptr<allure::service::PerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<allure::service::DurationBaselineStore> m_durationBaselineStore;
+		std::shared_ptr<allure::service::TestMetricRegistry> m_testMetricRegistry;
+		std::shared_ptr<allure::service::ChromeTraceWriter> m_chromeTraceWriter;
+		std::shared_ptr<allure::service::FlameGraphBuilder> m_flameGraphBuilder;
+		std::shared_ptr<allure::service::OverheadGovernor> m_overheadGovernor;
 	};
 
 }} // namespace allure::test_utility
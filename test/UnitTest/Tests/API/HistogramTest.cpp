@@ -0,0 +1,162 @@
+#include "stdafx.h"
+#include "API/Histogram.h"
+
+#include <nlohmann/json.hpp>
+#include <thread>
+#include <vector>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class HistogramTest : public testing::Test
+	{
+	public:
+		void recordRange(Histogram& histogram, uint64_t from, uint64_t to)
+		{
+			for (uint64_t value = from; value <= to; value++)
+			{
+				histogram.record(value);
+			}
+		}
+	};
+
+
+	TEST_F(HistogramTest, testSmallValuesGetABucketEach)
+	{
+		for (uint64_t value : { 0, 1, 100, 255 })
+		{
+			size_t index = Histogram::getBucketIndex(value);
+			ASSERT_EQ(value, Histogram::getBucketLowestValue(index));
+			ASSERT_EQ(value, Histogram::getBucketHighestValue(index));
+		}
+	}
+
+	TEST_F(HistogramTest, testBucketsHoldTheirValuesWithinOnePercent)
+	{
+		for (uint64_t value : { 256ull, 1000ull, 123456789ull, 1ull << 40, ~0ull })
+		{
+			size_t index = Histogram::getBucketIndex(value);
+			ASSERT_LT(index, Histogram::BUCKET_COUNT);
+
+			uint64_t lowest = Histogram::getBucketLowestValue(index);
+			uint64_t highest = Histogram::getBucketHighestValue(index);
+			ASSERT_LE(lowest, value);
+			ASSERT_GE(highest, value);
+			ASSERT_LE(static_cast<double>(highest - lowest), 0.01 * static_cast<double>(lowest));
+		}
+	}
+
+	TEST_F(HistogramTest, testPercentilesOfRecordedValues)
+	{
+		Histogram histogram;
+		recordRange(histogram, 1, 100);
+
+		ASSERT_EQ(100u, histogram.getCount());
+		ASSERT_EQ(1u, histogram.getMin());
+		ASSERT_EQ(100u, histogram.getMax());
+		ASSERT_DOUBLE_EQ(50.5, histogram.getMean());
+		ASSERT_EQ(50u, histogram.getValueAtPercentile(50.0));
+		ASSERT_EQ(99u, histogram.getValueAtPercentile(99.0));
+		ASSERT_EQ(100u, histogram.getValueAtPercentile(100.0));
+	}
+
+	TEST_F(HistogramTest, testPercentileOfLargeValuesIsCappedByMax)
+	{
+		Histogram histogram;
+		histogram.record(std::chrono::milliseconds(10));
+		histogram.record(std::chrono::milliseconds(20));
+
+		ASSERT_NEAR(10000000.0, static_cast<double>(histogram.getValueAtPercentile(50.0)), 100000.0);
+		ASSERT_EQ(20000000u, histogram.getValueAtPercentile(99.9));
+	}
+
+	TEST_F(HistogramTest, testMergeAddsValuesOfOtherHistogram)
+	{
+		Histogram histogram;
+		Histogram other;
+		recordRange(histogram, 1, 50);
+		recordRange(other, 51, 100);
+
+		histogram.merge(other);
+
+		ASSERT_EQ(100u, histogram.getCount());
+		ASSERT_EQ(1u, histogram.getMin());
+		ASSERT_EQ(100u, histogram.getMax());
+		ASSERT_EQ(50u, histogram.getValueAtPercentile(50.0));
+	}
+
+	TEST_F(HistogramTest, testConcurrentRecordsAreAllCounted)
+	{
+		Histogram histogram;
+		std::vector<std::thread> threads;
+		for (int thread = 0; thread < 4; thread++)
+		{
+			threads.emplace_back([&histogram]() { for (int i = 0; i < 10000; i++) { histogram.record(1000); } });
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		ASSERT_EQ(40000u, histogram.getCount());
+		ASSERT_DOUBLE_EQ(1000.0, histogram.getMean());
+	}
+
+	TEST_F(HistogramTest, testJSONListsNonEmptyBuckets)
+	{
+		Histogram histogram("latency");
+		histogram.record(10);
+		histogram.record(10);
+		histogram.record(300);
+
+		auto json = nlohmann::json::parse(histogram.toJSON());
+
+		ASSERT_EQ("latency", json["name"]);
+		ASSERT_EQ(3u, json["count"]);
+		ASSERT_EQ(2u, json["buckets"].size());
+		ASSERT_EQ(10u, json["buckets"][0]["from"]);
+		ASSERT_EQ(2u, json["buckets"][0]["count"]);
+		ASSERT_EQ(300u, json["buckets"][1]["from"]);
+		ASSERT_EQ(301u, json["buckets"][1]["to"]);
+		ASSERT_EQ(10u, json["percentiles"]["p50"]);
+	}
+
+	TEST_F(HistogramTest, testSVGPlotsLatencyByPercentile)
+	{
+		Histogram histogram("a<b");
+		recordRange(histogram, 1, 1000);
+
+		std::string svg = histogram.toSVG();
+
+		ASSERT_EQ(0u, svg.find("<svg"));
+		ASSERT_NE(std::string::npos, svg.find("<polyline"));
+		ASSERT_NE(std::string::npos, svg.find("a&lt;b"));
+		ASSERT_NE(std::string::npos, svg.find(">99.9%<"));
+	}
+
+	TEST_F(HistogramTest, testResetForgetsRecordedValues)
+	{
+		Histogram histogram;
+		recordRange(histogram, 1, 10);
+
+		histogram.reset();
+
+		ASSERT_EQ(0u, histogram.getCount());
+		ASSERT_EQ(0u, histogram.getMin());
+		ASSERT_EQ(0u, histogram.getValueAtPercentile(50.0));
+	}
+
+	TEST_F(HistogramTest, testDestroyingNamedHistogramNeverThrows)
+	{
+		ASSERT_TRUE(std::is_nothrow_destructible<Histogram>::value);
+
+		// No test is running: nothing is reported
+		{
+			Histogram histogram("latency");
+			recordRange(histogram, 1, 10);
+		}
+	}
+
+}}}
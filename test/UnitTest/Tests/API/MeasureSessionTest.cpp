@@ -0,0 +1,152 @@
+#include "stdafx.h"
+#include "API/Measure.h"
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class MeasureSessionTest : public testing::Test
+	{
+	public:
+		void SetUp()
+		{
+			m_options.warmupTime = std::chrono::microseconds(100);
+			m_options.targetTime = std::chrono::milliseconds(100);
+			m_options.targetRelativeError = 0.0;
+			m_options.minSamples = 5;
+			m_options.maxSamples = 1000;
+		}
+
+		void warmUp(detail::MeasureSession& session, int64_t nanosecondsPerIteration)
+		{
+			while (session.warmUp(nanosecondsPerIteration * static_cast<int64_t>(session.getBatchSize())))
+			{
+			}
+		}
+
+	protected:
+		MeasureOptions m_options;
+	};
+
+
+	TEST_F(MeasureSessionTest, testWarmUpGrowsBatchesAndCalibratesSampleSize)
+	{
+		detail::MeasureSession session(m_options);
+		ASSERT_EQ(1u, session.getBatchSize());
+
+		// 10 ns per iteration: batches must reach 10 us before the warm-up can end
+		ASSERT_TRUE(session.warmUp(10));
+		ASSERT_EQ(2u, session.getBatchSize());
+		warmUp(session, 10);
+
+		// Samples last targetTime / 1000 = 100 us
+		ASSERT_EQ(10000u, session.getBatchSize());
+	}
+
+	TEST_F(MeasureSessionTest, testSamplesLastAtLeastTheMinimumBatchTime)
+	{
+		m_options.targetTime = std::chrono::milliseconds(1);
+		detail::MeasureSession session(m_options);
+		warmUp(session, 100);
+
+		ASSERT_EQ(100u, session.getBatchSize());
+	}
+
+	TEST_F(MeasureSessionTest, testSamplingStopsWhenTargetTimeIsReached)
+	{
+		detail::MeasureSession session(m_options);
+		warmUp(session, 10);
+
+		int samples = 1;
+		while (session.addSample(10 * 1000 * 1000))
+		{
+			samples++;
+		}
+
+		ASSERT_EQ(10, samples);
+	}
+
+	TEST_F(MeasureSessionTest, testSamplingTakesAtLeastMinSamples)
+	{
+		m_options.targetTime = std::chrono::nanoseconds(1);
+		detail::MeasureSession session(m_options);
+		warmUp(session, 10);
+
+		int samples = 1;
+		while (session.addSample(20000))
+		{
+			samples++;
+		}
+
+		ASSERT_EQ(5, samples);
+	}
+
+	TEST_F(MeasureSessionTest, testSamplingStopsEarlyWhenMeanIsPreciseEnough)
+	{
+		m_options.targetRelativeError = 0.01;
+		detail::MeasureSession session(m_options);
+		warmUp(session, 10);
+
+		int samples = 1;
+		while (session.addSample(100000))
+		{
+			samples++;
+		}
+
+		ASSERT_EQ(5, samples);
+	}
+
+	TEST_F(MeasureSessionTest, testSamplingStopsAtMaxSamples)
+	{
+		m_options.maxSamples = 20;
+		detail::MeasureSession session(m_options);
+		warmUp(session, 10);
+
+		int samples = 1;
+		while (session.addSample(1000))
+		{
+			samples++;
+		}
+
+		ASSERT_EQ(20, samples);
+	}
+
+	TEST_F(MeasureSessionTest, testBuildResultComputesStatisticsPerIteration)
+	{
+		m_options.warmupTime = std::chrono::nanoseconds(0);
+		m_options.targetTime = std::chrono::nanoseconds(0);
+		detail::MeasureSession session(m_options);
+		while (session.warmUp(20000))
+		{
+		}
+		ASSERT_EQ(1u, session.getBatchSize());
+
+		for (int64_t sample : { 10000, 20000, 30000, 40000, 50000 })
+		{
+			session.addSample(sample);
+		}
+		MeasureResult result = session.buildResult();
+
+		ASSERT_EQ(5u, result.samples.size());
+		ASSERT_EQ(5u, result.iterations);
+		ASSERT_DOUBLE_EQ(10000.0, result.min);
+		ASSERT_DOUBLE_EQ(30000.0, result.median);
+		ASSERT_DOUBLE_EQ(30000.0, result.mean);
+		ASSERT_DOUBLE_EQ(50000.0, result.p90);
+		ASSERT_DOUBLE_EQ(50000.0, result.p99);
+		ASSERT_NEAR(15811.4, result.stddev, 0.1);
+		ASSERT_NEAR(33333.3, result.iterationsPerSecond, 0.1);
+	}
+
+	TEST_F(MeasureSessionTest, testDoNotOptimizeAcceptsValuesAndExpressions)
+	{
+		int value = 42;
+		doNotOptimize(value);
+		doNotOptimize(value + 1);
+		clobberMemory();
+
+		ASSERT_EQ(42, value);
+	}
+
+}}}
@@ -0,0 +1,50 @@
+#include "stdafx.h"
+#include "Model/Parameter.h"
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class ParameterTest : public testing::Test
+	{
+	protected:
+		model::Parameter m_parameter;
+	};
+
+
+	TEST_F(ParameterTest, testStringValueIsNotTyped)
+	{
+		m_parameter.setValue("intro");
+
+		ASSERT_FALSE(m_parameter.isTyped());
+		ASSERT_EQ("intro", m_parameter.getValue());
+	}
+
+	TEST_F(ParameterTest, testTypedValuesAreRenderedWhenRead)
+	{
+		m_parameter.setTypedValue(int64_t(-42));
+		ASSERT_TRUE(m_parameter.isTyped());
+		ASSERT_EQ("-42", m_parameter.getValue());
+
+		m_parameter.setTypedValue(uint64_t(18446744073709551615u));
+		ASSERT_EQ("18446744073709551615", m_parameter.getValue());
+
+		m_parameter.setTypedValue(0.1);
+		ASSERT_EQ("0.1", m_parameter.getValue());
+
+		m_parameter.setTypedValue(false);
+		ASSERT_EQ("false", m_parameter.getValue());
+	}
+
+	TEST_F(ParameterTest, testTypedValueDiffersFromItsText)
+	{
+		model::Parameter textParameter;
+		textParameter.setValue("42");
+		m_parameter.setTypedValue(int64_t(42));
+
+		ASSERT_EQ(textParameter.getValue(), m_parameter.getValue());
+		ASSERT_NE(textParameter, m_parameter);
+	}
+
+}}}
@@ -0,0 +1,83 @@
+#include "stdafx.h"
+#include "Model/StepNameRegistry.h"
+
+#include <thread>
+#include <vector>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class StepNameRegistryTest : public testing::Test
+	{
+	protected:
+		model::StepNameRegistry m_registry;
+	};
+
+
+	TEST_F(StepNameRegistryTest, testRegisterNameReturnsIdsStartingAfterNoName)
+	{
+		uint32_t firstId = m_registry.registerName("Open connection");
+		uint32_t secondId = m_registry.registerName("Close connection");
+
+		ASSERT_NE(model::StepNameRegistry::NO_NAME, firstId);
+		ASSERT_NE(firstId, secondId);
+		ASSERT_EQ("Open connection", m_registry.getName(firstId));
+		ASSERT_EQ("Close connection", m_registry.getName(secondId));
+	}
+
+	TEST_F(StepNameRegistryTest, testRegisterNameTwiceReturnsSameId)
+	{
+		uint32_t id = m_registry.registerName("Decode frame");
+
+		ASSERT_EQ(id, m_registry.registerName("Decode frame"));
+		ASSERT_EQ(1u, m_registry.getNameCount());
+	}
+
+	TEST_F(StepNameRegistryTest, testGetNameOfUnknownIdReturnsEmptyName)
+	{
+		m_registry.registerName("Decode frame");
+
+		ASSERT_EQ("", m_registry.getName(model::StepNameRegistry::NO_NAME));
+		ASSERT_EQ("", m_registry.getName(2));
+	}
+
+	TEST_F(StepNameRegistryTest, testNamesStayInPlaceWhileMoreAreRegistered)
+	{
+		uint32_t id = m_registry.registerName("Open connection");
+		const std::string& name = m_registry.getName(id);
+
+		for (size_t i = 0; i < 3 * model::StepNameRegistry::CHUNK_SIZE; i++)
+		{
+			m_registry.registerName("step " + std::to_string(i));
+		}
+
+		ASSERT_EQ(&name, &m_registry.getName(id));
+		ASSERT_EQ("Open connection", name);
+	}
+
+	TEST_F(StepNameRegistryTest, testNamesAreReadWhileOtherThreadsRegister)
+	{
+		std::vector<std::thread> threads;
+		for (unsigned int t = 0; t < 4; t++)
+		{
+			threads.emplace_back([this, t]()
+			{
+				for (unsigned int i = 0; i < 1000; i++)
+				{
+					std::string name = "thread " + std::to_string(t) + " step " + std::to_string(i);
+					uint32_t id = m_registry.registerName(name);
+					ASSERT_EQ(name, m_registry.getName(id));
+				}
+			});
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		ASSERT_EQ(4000u, m_registry.getNameCount());
+	}
+
+}}}
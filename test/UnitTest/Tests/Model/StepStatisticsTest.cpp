@@ -0,0 +1,51 @@
+#include "stdafx.h"
+#include "Model/StepStatistics.h"
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class StepStatisticsTest : public testing::Test
+	{
+	protected:
+		model::StepStatistics m_statistics;
+	};
+
+
+	TEST_F(StepStatisticsTest, testAddDurationUpdatesCountTotalMinAndMax)
+	{
+		m_statistics.addDuration(5);
+		m_statistics.addDuration(2);
+		m_statistics.addDuration(9);
+
+		ASSERT_EQ(3u, m_statistics.getCount());
+		ASSERT_EQ(16u, m_statistics.getTotal());
+		ASSERT_EQ(2u, m_statistics.getMin());
+		ASSERT_EQ(9u, m_statistics.getMax());
+	}
+
+	TEST_F(StepStatisticsTest, testGetPercentileUsesNearestRank)
+	{
+		for (uint64_t duration = 1; duration <= 100; duration++)
+		{
+			m_statistics.addDuration(duration);
+		}
+
+		ASSERT_EQ(50u, m_statistics.getPercentile(50));
+		ASSERT_EQ(99u, m_statistics.getPercentile(99));
+	}
+
+	TEST_F(StepStatisticsTest, testPercentilesStayWithinRangeWhenSamplesExceedReservoir)
+	{
+		for (int i = 0; i < 100000; i++)
+		{
+			m_statistics.addDuration(static_cast<uint64_t>(i % 10));
+		}
+
+		ASSERT_EQ(100000u, m_statistics.getCount());
+		ASSERT_LE(m_statistics.getPercentile(50), 9u);
+		ASSERT_EQ(9u, m_statistics.getPercentile(99));
+	}
+
+}}}
@@ -0,0 +1,118 @@
+#include "stdafx.h"
+#include "Services/Capture/OutputCapture.h"
+
+#include <cstdio>
+#include <string>
+
+#if !defined(_WIN32)
+	#include <unistd.h>
+#endif
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+#if !defined(_WIN32)
+
+	class OutputCaptureTest : public testing::Test
+	{
+	public:
+		void SetUp()
+		{
+			m_capture.setEnabled(true);
+			m_capture.setMemoryLimit(64);
+		}
+
+		void TearDown()
+		{
+			m_capture.shutdown();
+		}
+
+	protected:
+		service::OutputCapture m_capture;
+	};
+
+
+	TEST_F(OutputCaptureTest, testCapturesStdoutAndStderrWrittenDuringTest)
+	{
+		m_capture.beginTest();
+		fprintf(stdout, "to stdout\n");
+		fflush(stdout);
+		fprintf(stderr, "to stderr\n");
+		m_capture.endTest();
+
+		ASSERT_EQ("to stdout\nto stderr\n", m_capture.getContent());
+	}
+
+	TEST_F(OutputCaptureTest, testOutputBeyondMemoryLimitSpillsAndIsKeptInOrder)
+	{
+		std::string expected;
+		m_capture.beginTest();
+		for (int i = 0; i < 100; i++)
+		{
+			std::string line = "line number " + std::to_string(i) + "\n";
+			fputs(line.c_str(), stdout);
+			expected += line;
+		}
+		m_capture.endTest();
+
+		ASSERT_EQ(64u, m_capture.getMemoryContent().size());
+		ASSERT_EQ(expected.size(), m_capture.getCapturedBytes());
+		ASSERT_EQ(expected, m_capture.getContent());
+		ASSERT_GE(m_capture.getTotalDrainedBytes(), expected.size());
+	}
+
+	TEST_F(OutputCaptureTest, testBeginTestDiscardsOutputOfPreviousTest)
+	{
+		m_capture.beginTest();
+		fprintf(stdout, "first\n");
+		m_capture.endTest();
+
+		m_capture.beginTest();
+		m_capture.endTest();
+
+		ASSERT_TRUE(m_capture.isEmpty());
+	}
+
+	TEST_F(OutputCaptureTest, testOutputBetweenTestsGoesBackToTheStreamItWasWrittenTo)
+	{
+		int stderrPipeFds[2];
+		ASSERT_EQ(0, pipe(stderrPipeFds));
+		fflush(stderr);
+		int savedStderr = dup(STDERR_FILENO);
+		dup2(stderrPipeFds[1], STDERR_FILENO);
+
+		m_capture.beginTest();
+		m_capture.endTest();
+		fprintf(stderr, "between tests\n");
+		m_capture.shutdown();
+
+		dup2(savedStderr, STDERR_FILENO);
+		close(savedStderr);
+		close(stderrPipeFds[1]);
+
+		std::string passedThrough;
+		char chunk[64];
+		ssize_t bytesRead = 0;
+		while ((bytesRead = read(stderrPipeFds[0], chunk, sizeof(chunk))) > 0)
+		{
+			passedThrough.append(chunk, static_cast<size_t>(bytesRead));
+		}
+		close(stderrPipeFds[0]);
+
+		ASSERT_EQ("between tests\n", passedThrough);
+	}
+
+	TEST_F(OutputCaptureTest, testNothingIsCapturedWhenDisabled)
+	{
+		m_capture.setEnabled(false);
+		m_capture.beginTest();
+		m_capture.endTest();
+
+		ASSERT_TRUE(m_capture.isEmpty());
+	}
+
+#endif
+
+}}}
@@ -1,10 +1,21 @@
 #include "stdafx.h"
 #include "Services/EventHandlers/TestCaseEndEventHandler.h"
 
+#include "Model/Action.h"
 #include "Model/TestProgram.h"
 
+#include "TestUtilities/Mocks/Services/Capture/MockOutputCapture.h"
+#include "TestUtilities/Mocks/Services/Log/MockLogRingBuffer.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockAllocationTracker.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockOverheadGovernor.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockPerfCounterGroup.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockResourceUsageMonitor.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockTestMetricRegistry.h"
 #include "TestUtilities/Mocks/Services/System/MockTimeService.h"
 #include "TestUtilities/Mocks/Services/System/MockUUIDGeneratorService.h"
+#include "TestUtilities/Mocks/Services/Report/MockChromeTraceWriter.h"
+#include "TestUtilities/Mocks/Services/Report/MockDurationBaselineStore.h"
+#include "TestUtilities/Mocks/Services/Report/MockFlameGraphBuilder.h"
 #include "TestUtilities/Mocks/Services/Report/MockTestCaseJSONSerializer.h"
 #include "TestUtilities/Mocks/Services/System/MockFileService.h"
 
@@ -24,8 +35,22 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			auto timeService = buildTimeService();
 			auto testCaseJSONSerializer = buildTestCaseJSONSerializer();
 			auto fileService = buildFileService();
-
-			m_service = std::make_unique<service::TestCaseEndEventHandler>(m_testProgram, std::move(timeService), std::move(testCaseJSONSerializer), std::move(fileService));
+			auto logRingBuffer = buildLogRingBuffer();
+			m_outputCapture = std::make_shared<MockOutputCapture>();
+			m_resourceUsageMonitor = std::make_shared<MockResourceUsageMonitor>();
+			m_perfCounterGroup = std::make_shared<MockPerfCounterGroup>();
+			m_allocationTracker = std::make_shared<MockAllocationTracker>();
+			m_testMetricRegistry = std::make_shared<MockTestMetricRegistry>();
+			m_durationBaselineStore = std::make_shared<MockDurationBaselineStore>();
+			m_chromeTraceWriter = std::make_shared<MockChromeTraceWriter>();
+			m_flameGraphBuilder = std::make_shared<MockFlameGraphBuilder>();
+			m_overheadGovernor = std::make_shared<MockOverheadGovernor>();
+			ON_CALL(*m_overheadGovernor, getStepDetailPolicy(_)).WillByDefault(ReturnArg<0>());
+
+			m_service = std::make_unique<service::TestCaseEndEventHandler>(m_testProgram, std::move(timeService), std::move(testCaseJSONSerializer), std::move(fileService),
+			                                                               std::move(logRingBuffer), m_outputCapture, m_resourceUsageMonitor, m_perfCounterGroup,
+			                                                               m_allocationTracker, m_durationBaselineStore, m_testMetricRegistry, m_chromeTraceWriter,
+			                                                               m_flameGraphBuilder, m_overheadGovernor);
 		}
 
 		void setUpTestProgram()
@@ -57,6 +82,18 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			return testCase;
 		}
 
+		void addNestedSteps()
+		{
+			auto parentStep = std::make_unique<model::Action>();
+			parentStep->setName("Parent");
+			auto childStep = std::make_unique<model::Action>();
+			childStep->setName("Child");
+			childStep->addStep(std::make_unique<model::Action>());
+			parentStep->addStep(std::move(childStep));
+			m_runningTestCase->addStep(std::move(parentStep));
+			m_runningTestCase->addStep(std::make_unique<model::Action>());
+		}
+
 		std::unique_ptr<service::ITimeService> buildTimeService()
 		{
 			auto timeService = std::make_unique<MockTimeService>();
@@ -65,6 +102,9 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			m_currentTime = 123456789;
 			ON_CALL(*m_timeService, getCurrentTime()).WillByDefault(Return(m_currentTime));
 
+			m_currentNanoseconds = 5000;
+			ON_CALL(*m_timeService, getMonotonicNanoseconds()).WillByDefault(Return(m_currentNanoseconds));
+
 			return timeService;
 		}
 
@@ -86,15 +126,34 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			return fileService;
 		}
 
+		std::shared_ptr<service::ILogRingBuffer> buildLogRingBuffer()
+		{
+			m_logRingBuffer = std::make_shared<MockLogRingBuffer>();
+			ON_CALL(*m_logRingBuffer, isEmpty()).WillByDefault(Return(true));
+
+			return m_logRingBuffer;
+		}
+
 	protected:
 		std::unique_ptr<service::TestCaseEndEventHandler> m_service;
 		model::TestProgram m_testProgram;
 		MockTimeService* m_timeService;
 		MockTestCaseJSONSerializer* m_testCaseJSONSerializer;
 		MockFileService* m_fileService;
+		std::shared_ptr<MockLogRingBuffer> m_logRingBuffer;
+		std::shared_ptr<MockOutputCapture> m_outputCapture;
+		std::shared_ptr<MockResourceUsageMonitor> m_resourceUsageMonitor;
+		std::shared_ptr<MockPerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<MockAllocationTracker> m_allocationTracker;
+		std::shared_ptr<MockTestMetricRegistry> m_testMetricRegistry;
+		std::shared_ptr<MockDurationBaselineStore> m_durationBaselineStore;
+		std::shared_ptr<MockChromeTraceWriter> m_chromeTraceWriter;
+		std::shared_ptr<MockFlameGraphBuilder> m_flameGraphBuilder;
+		std::shared_ptr<MockOverheadGovernor> m_overheadGovernor;
 
 		model::TestCase* m_runningTestCase;
 		time_t m_currentTime;
+		int64_t m_currentNanoseconds;
 	};
 
 
@@ -104,6 +163,21 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		ASSERT_EQ(m_currentTime, m_runningTestCase->getStop());
 	}
 
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndSetsDurationOfRunningTestCaseInNanoseconds)
+	{
+		m_runningTestCase->setStartNs(2000);
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+		ASSERT_EQ(3000u, m_runningTestCase->getDurationNs());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndKeepsDurationAlreadySetByAdapter)
+	{
+		m_runningTestCase->setStartNs(2000);
+		m_runningTestCase->setDurationNs(42);
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+		ASSERT_EQ(42u, m_runningTestCase->getDurationNs());
+	}
+
 	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndSetsStageOfRunningTestCaseToFinished)
 	{
 		m_service->handleTestCaseEnd(model::Status::PASSED);
@@ -138,6 +212,402 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		m_service->handleTestCaseEnd(model::Status::PASSED);
 	}
 
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAttachesLogWhenTestFails)
+	{
+		ON_CALL(*m_logRingBuffer, isEmpty()).WillByDefault(Return(false));
+		ON_CALL(*m_logRingBuffer, getContent()).WillByDefault(Return("something went wrong\n"));
+		EXPECT_CALL(*m_logRingBuffer, reset()).Times(1);
+
+		EXPECT_CALL(*m_fileService, saveFile(EndsWith("-log-attachment.txt"), "something went wrong\n")).Times(1);
+		EXPECT_CALL(*m_fileService, saveFile(EndsWith("-result.json"), _)).Times(1);
+
+		m_service->handleTestCaseEnd(model::Status::FAILED);
+
+		ASSERT_EQ(1u, m_runningTestCase->getAttachments().size());
+		ASSERT_EQ("log", m_runningTestCase->getAttachments()[0].getName());
+		ASSERT_EQ("text/plain", m_runningTestCase->getAttachments()[0].getType());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndResetsLogWithoutAttachingWhenTestPasses)
+	{
+		ON_CALL(*m_logRingBuffer, isEmpty()).WillByDefault(Return(false));
+		EXPECT_CALL(*m_logRingBuffer, getContent()).Times(0);
+		EXPECT_CALL(*m_logRingBuffer, reset()).Times(1);
+
+		EXPECT_CALL(*m_fileService, saveFile(EndsWith("-result.json"), _)).Times(1);
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_TRUE(m_runningTestCase->getAttachments().empty());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndStopsCaptureAndAttachesOutputWhenTestFails)
+	{
+		ON_CALL(*m_outputCapture, isEnabled()).WillByDefault(Return(true));
+		ON_CALL(*m_outputCapture, isEmpty()).WillByDefault(Return(false));
+		ON_CALL(*m_outputCapture, isOnlyOnFailure()).WillByDefault(Return(true));
+		ON_CALL(*m_outputCapture, getMemoryContent()).WillByDefault(Return("printed\n"));
+
+		EXPECT_CALL(*m_outputCapture, endTest()).Times(1);
+		EXPECT_CALL(*m_fileService, saveFile(EndsWith("-output-attachment.txt"), "printed\n")).Times(1);
+		EXPECT_CALL(*m_outputCapture, appendSpilledContentTo(EndsWith("-output-attachment.txt"))).Times(1);
+		EXPECT_CALL(*m_fileService, saveFile(EndsWith("-result.json"), _)).Times(1);
+
+		m_service->handleTestCaseEnd(model::Status::FAILED);
+
+		ASSERT_EQ(1u, m_runningTestCase->getAttachments().size());
+		ASSERT_EQ("output", m_runningTestCase->getAttachments()[0].getName());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndWritesTestCaseToTraceBeforeItsResultFile)
+	{
+		InSequence sequence;
+		EXPECT_CALL(*m_chromeTraceWriter, writeTestCase(_)).WillOnce(Invoke([](const model::TestCase& testCase) {
+			ASSERT_EQ(model::Stage::FINISHED, testCase.getStage());
+		}));
+		EXPECT_CALL(*m_fileService, saveFile(EndsWith("-result.json"), _));
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAddsStacksOfTestToRunFlameGraphWhenEnabled)
+	{
+		addNestedSteps();
+		ON_CALL(*m_flameGraphBuilder, isEnabled()).WillByDefault(Return(true));
+		EXPECT_CALL(*m_flameGraphBuilder, addStacks(Not(IsEmpty()))).Times(1);
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAddsNoStacksToFlameGraphByDefault)
+	{
+		addNestedSteps();
+		EXPECT_CALL(*m_flameGraphBuilder, addStacks(_)).Times(0);
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+		ASSERT_TRUE(m_runningTestCase->getAttachments().empty());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAddsCountersOfTestAsParameters)
+	{
+		service::ITestMetricRegistry::Metrics metrics;
+		metrics.counters.push_back({ "cache hits", 42 });
+		metrics.droppedCounters = 2;
+		EXPECT_CALL(*m_testMetricRegistry, endTest()).WillOnce(Return(metrics));
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		const auto& parameters = m_runningTestCase->getParameters();
+		ASSERT_EQ(2u, parameters.size());
+		ASSERT_EQ("cache hits", parameters[0].getName());
+		ASSERT_EQ("42", parameters[0].getValue());
+		ASSERT_EQ("dropped counters", parameters[1].getName());
+		ASSERT_EQ("2", parameters[1].getValue());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAttachesGaugeSeriesInConfiguredFormat)
+	{
+		service::ITestMetricRegistry::Metrics metrics;
+		metrics.gauges.push_back({ "queue depth", 3.0, 1.0, 8.0, { { 0, 1.0 }, { 1000000, 8.0 } } });
+		ON_CALL(*m_testMetricRegistry, getSeriesFormat()).WillByDefault(Return(model::SeriesFormat::JSON));
+		EXPECT_CALL(*m_testMetricRegistry, endTest()).WillOnce(Return(metrics));
+		EXPECT_CALL(*m_fileService, saveFile(EndsWith("-gauges-attachment.json"), _)).Times(1);
+		EXPECT_CALL(*m_fileService, saveFile(EndsWith("-result.json"), _)).Times(1);
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ(1u, m_runningTestCase->getParameters().size());
+		ASSERT_EQ("last 3, min 1, max 8, 2 samples", m_runningTestCase->getParameters()[0].getValue());
+		ASSERT_EQ(1u, m_runningTestCase->getAttachments().size());
+		ASSERT_EQ("gauges", m_runningTestCase->getAttachments()[0].getName());
+		ASSERT_EQ("application/json", m_runningTestCase->getAttachments()[0].getType());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndKeepsFullStepTreeByDefault)
+	{
+		addNestedSteps();
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ(2u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getStep(0)->getStepCount());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndKeepsOnlyTopLevelStepsForPassingTestWhenTopLevelPolicy)
+	{
+		m_testProgram.setStepDetailPolicy(model::StepDetailPolicy::TOP_LEVEL_ON_PASS);
+		addNestedSteps();
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ(2u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(0u, m_runningTestCase->getStep(0)->getStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getStep(0)->getParameters().size());
+		ASSERT_EQ("nested steps", m_runningTestCase->getStep(0)->getParameters()[0].getName());
+		ASSERT_EQ("2", m_runningTestCase->getStep(0)->getParameters()[0].getValue());
+		ASSERT_TRUE(m_runningTestCase->getStep(1)->getParameters().empty());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndReplacesStepsWithCountForPassingTestWhenSummaryPolicy)
+	{
+		m_testProgram.setStepDetailPolicy(model::StepDetailPolicy::SUMMARY_ON_PASS);
+		addNestedSteps();
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ(0u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getParameters().size());
+		ASSERT_EQ("steps", m_runningTestCase->getParameters()[0].getName());
+		ASSERT_EQ("4", m_runningTestCase->getParameters()[0].getValue());
+		ASSERT_TRUE(m_runningTestCase->getParameters()[0].getExcluded());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndHoistsAttachmentsOfDroppedStepsToTopLevelStep)
+	{
+		m_testProgram.setStepDetailPolicy(model::StepDetailPolicy::TOP_LEVEL_ON_PASS);
+		addNestedSteps();
+		model::Attachment attachment;
+		attachment.setSource("child-attachment.txt");
+		m_runningTestCase->getStep(0)->getStep(0)->addAttachment(attachment);
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ(1u, m_runningTestCase->getStep(0)->getAttachments().size());
+		ASSERT_EQ("child-attachment.txt", m_runningTestCase->getStep(0)->getAttachments()[0].getSource());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndHoistsAttachmentsOfDroppedStepsToTestCase)
+	{
+		m_testProgram.setStepDetailPolicy(model::StepDetailPolicy::SUMMARY_ON_PASS);
+		addNestedSteps();
+		model::Attachment parentAttachment;
+		parentAttachment.setSource("parent-attachment.txt");
+		m_runningTestCase->getStep(0)->addAttachment(parentAttachment);
+		model::Attachment childAttachment;
+		childAttachment.setSource("child-attachment.txt");
+		m_runningTestCase->getStep(0)->getStep(0)->addAttachment(childAttachment);
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ(2u, m_runningTestCase->getAttachments().size());
+		ASSERT_EQ("parent-attachment.txt", m_runningTestCase->getAttachments()[0].getSource());
+		ASSERT_EQ("child-attachment.txt", m_runningTestCase->getAttachments()[1].getSource());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndKeepsFullStepTreeForFailingTestWhenSummaryPolicy)
+	{
+		m_testProgram.setStepDetailPolicy(model::StepDetailPolicy::SUMMARY_ON_PASS);
+		addNestedSteps();
+		m_service->handleTestCaseEnd(model::Status::FAILED);
+
+		ASSERT_EQ(2u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getStep(0)->getStep(0)->getStepCount());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAddsSummaryStepWhenStepsWereDropped)
+	{
+		m_runningTestCase->setDroppedStepCount(42);
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ(1u, m_runningTestCase->getStepCount());
+		ASSERT_EQ("Step limit reached: 42 steps not recorded", m_runningTestCase->getStep(0)->getName());
+		ASSERT_EQ("42", m_runningTestCase->getStep(0)->getParameters()[0].getValue());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndTruncatesStatusDetailsBeyondLimit)
+	{
+		m_testProgram.setMaxStatusDetailBytes(4);
+		m_service->handleTestCaseEnd(model::Status::FAILED, "0123456789", "abcdefghij");
+
+		ASSERT_EQ("0123\n[... 6 more bytes truncated ...]", m_runningTestCase->getStatusMessage());
+		ASSERT_EQ("[... 6 earlier bytes truncated ...]\nghij", m_runningTestCase->getStatusTrace());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAddsPerfCountersAsExcludedParameters)
+	{
+		std::vector<model::Metric> metrics = { model::Metric("instructions", 1234) };
+		EXPECT_CALL(*m_perfCounterGroup, endTest()).WillOnce(Return(metrics));
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		const auto& parameters = m_runningTestCase->getParameters();
+		ASSERT_EQ(1u, parameters.size());
+		ASSERT_EQ("instructions", parameters[0].getName());
+		ASSERT_EQ("1234", parameters[0].getValue());
+		ASSERT_TRUE(parameters[0].getExcluded());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAddsAllocationUsageWhenTrackedThroughHooks)
+	{
+		service::IAllocationTracker::Usage usage;
+		usage.allocations = 7;
+		usage.bytesAllocated = 512;
+		usage.peakLiveBytes = 256;
+		ON_CALL(*m_allocationTracker, isEnabled()).WillByDefault(Return(true));
+		ON_CALL(*m_allocationTracker, isHooked()).WillByDefault(Return(true));
+		EXPECT_CALL(*m_allocationTracker, endTest()).WillOnce(Return(usage));
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		const auto& parameters = m_runningTestCase->getParameters();
+		ASSERT_EQ(3u, parameters.size());
+		ASSERT_EQ("allocations", parameters[0].getName());
+		ASSERT_EQ("7", parameters[0].getValue());
+		ASSERT_EQ("bytes allocated", parameters[1].getName());
+		ASSERT_EQ("512", parameters[1].getValue());
+		ASSERT_EQ("peak live bytes", parameters[2].getName());
+		ASSERT_EQ("256", parameters[2].getValue());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndIgnoresAllocationUsageWithoutHooks)
+	{
+		ON_CALL(*m_allocationTracker, isEnabled()).WillByDefault(Return(true));
+		ON_CALL(*m_allocationTracker, isHooked()).WillByDefault(Return(false));
+		EXPECT_CALL(*m_allocationTracker, endTest()).Times(0);
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_TRUE(m_runningTestCase->getParameters().empty());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAddsResourceUsageParametersWhenEnabled)
+	{
+		service::ResourceUsage usage;
+		usage.userCpuMicroseconds = 1500;
+		usage.blockOutputOperations = 3;
+		ON_CALL(*m_resourceUsageMonitor, isEnabled()).WillByDefault(Return(true));
+		EXPECT_CALL(*m_resourceUsageMonitor, endTest()).WillOnce(Return(usage));
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		const auto& parameters = m_runningTestCase->getParameters();
+		ASSERT_EQ(10u, parameters.size());
+		ASSERT_EQ("cpu user (us)", parameters[0].getName());
+		ASSERT_EQ("1500", parameters[0].getValue());
+		ASSERT_EQ("block writes", parameters[9].getName());
+		ASSERT_EQ("3", parameters[9].getValue());
+		ASSERT_TRUE(parameters[0].getExcluded());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndAddsNoResourceUsageParametersByDefault)
+	{
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+		ASSERT_TRUE(m_runningTestCase->getParameters().empty());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndFlagsDurationAboveBaseline)
+	{
+		service::DurationBaseline baseline;
+		ON_CALL(*m_durationBaselineStore, isEnabled()).WillByDefault(Return(true));
+		ON_CALL(*m_durationBaselineStore, getBaseline("H-2.2")).WillByDefault(Return(&baseline));
+		ON_CALL(*m_durationBaselineStore, isRegression(_, 5000)).WillByDefault(Return(true));
+		ON_CALL(*m_durationBaselineStore, buildRegressionMessage(_, 5000)).WillByDefault(Return("Duration regression: 0.005 ms"));
+		ON_CALL(*m_durationBaselineStore, isMarkKnown()).WillByDefault(Return(true));
+		EXPECT_CALL(*m_durationBaselineStore, record(_, _)).Times(0);
+		m_runningTestCase->setHistoryId("H-2.2");
+
+		m_service->handleTestCaseEnd(model::Status::FAILED, "Expected 1 but was 2", "");
+
+		ASSERT_EQ(1u, m_runningTestCase->getLabels().size());
+		ASSERT_EQ("performance-regression", m_runningTestCase->getLabels()[0].getValue());
+		ASSERT_EQ("Expected 1 but was 2\n\nDuration regression: 0.005 ms", m_runningTestCase->getStatusMessage());
+		ASSERT_FALSE(m_runningTestCase->getStatusFlaky());
+		ASSERT_TRUE(m_runningTestCase->getStatusKnown());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndRecordsDurationOfPassingTestInBaseline)
+	{
+		ON_CALL(*m_durationBaselineStore, isEnabled()).WillByDefault(Return(true));
+		ON_CALL(*m_durationBaselineStore, getBaseline("H-2.2")).WillByDefault(Return(nullptr));
+		EXPECT_CALL(*m_durationBaselineStore, record("H-2.2", 5000)).Times(1);
+		m_runningTestCase->setHistoryId("H-2.2");
+
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_TRUE(m_runningTestCase->getLabels().empty());
+	}
+
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndFailsPassingTestWithBudgetViolations)
+	{
+		m_runningTestCase->addBudgetViolation(model::Status::BROKEN, "Step \"Decode\": Exceeded budget of 2 ms by 1 ms (took 3 ms)");
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ(model::Status::BROKEN, m_runningTestCase->getStatus());
+		ASSERT_EQ("Step \"Decode\": Exceeded budget of 2 ms by 1 ms (took 3 ms)", m_runningTestCase->getStatusMessage());
+	}
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndKeepsFailureOfTestWithBudgetViolations)
+	{
+		m_runningTestCase->addBudgetViolation(model::Status::BROKEN, "Step \"Decode\": Exceeded budget");
+		m_service->handleTestCaseEnd(model::Status::FAILED, "Expected 1 but was 2", "");
+
+		ASSERT_EQ(model::Status::FAILED, m_runningTestCase->getStatus());
+		ASSERT_EQ("Expected 1 but was 2\n\nStep \"Decode\": Exceeded budget", m_runningTestCase->getStatusMessage());
+	}
+
+
+	TEST_F(TestCaseEndEventHandlerTest, testHandleTestCaseEndReportsDurationOfTestToOverheadGovernor)
+	{
+		m_runningTestCase->setDurationNs(2500);
+		EXPECT_CALL(*m_overheadGovernor, endTest(2500u)).Times(1);
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+	}
+
+
+	class TestCaseEndEventHandlerGovernorTest : public TestCaseEndEventHandlerTest
+	{
+	public:
+		void SetUp()
+		{
+			TestCaseEndEventHandlerTest::SetUp();
+
+			// Overhead so high that the governor captures attachments only on failure
+			ON_CALL(*m_overheadGovernor, isEnabled()).WillByDefault(Return(true));
+			ON_CALL(*m_overheadGovernor, getLevel()).WillByDefault(Return(model::CaptureLevel::ATTACHMENTS_ON_FAILURE));
+			ON_CALL(*m_overheadGovernor, getStepDetailPolicy(_)).WillByDefault(Return(model::StepDetailPolicy::SUMMARY_ON_PASS));
+			ON_CALL(*m_overheadGovernor, isDeferringAttachments()).WillByDefault(Return(true));
+
+			model::Attachment attachment;
+			attachment.setName("response");
+			attachment.setSource("deferred-attachment.txt");
+			m_runningTestCase->addAttachment(attachment);
+			m_runningTestCase->addDeferredAttachment("deferred-attachment.txt", "HTTP 200");
+			addNestedSteps();
+		}
+
+		std::string getParameterValue(const std::string& name)
+		{
+			for (const auto& parameter : m_runningTestCase->getParameters())
+			{
+				if (parameter.getName() == name)
+				{
+					return parameter.getValue();
+				}
+			}
+			return "";
+		}
+	};
+
+	TEST_F(TestCaseEndEventHandlerGovernorTest, testHandleTestCaseEndDropsDeferredAttachmentsAndStepsOfPassingTest)
+	{
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(AnyNumber());
+		EXPECT_CALL(*m_fileService, saveFile(HasSubstr("deferred-attachment.txt"), _)).Times(0);
+		m_service->handleTestCaseEnd(model::Status::PASSED);
+
+		ASSERT_EQ("attachments on failure", getParameterValue("capture level"));
+		ASSERT_EQ("4", getParameterValue("steps"));
+		ASSERT_EQ(0u, m_runningTestCase->getStepCount());
+		ASSERT_TRUE(m_runningTestCase->getAttachments().empty());
+		ASSERT_TRUE(m_runningTestCase->getDeferredAttachments().empty());
+	}
+
+	TEST_F(TestCaseEndEventHandlerGovernorTest, testHandleTestCaseEndWritesDeferredAttachmentsOfFailedTest)
+	{
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(AnyNumber());
+		EXPECT_CALL(*m_fileService, saveFile(HasSubstr("deferred-attachment.txt"), "HTTP 200"));
+		m_service->handleTestCaseEnd(model::Status::FAILED);
+
+		ASSERT_EQ("attachments on failure", getParameterValue("capture level"));
+		ASSERT_EQ(2u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getAttachments().size());
+	}
+
 
 	class TestCaseEndEventHandlerStatusTest : public TestCaseEndEventHandlerTest
 											, public testing::WithParamInterface<model::Status>
@@ -3,6 +3,12 @@
 
 #include "Model/TestProgram.h"
 
+#include "TestUtilities/Mocks/Services/Capture/MockOutputCapture.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockAllocationTracker.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockOverheadGovernor.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockPerfCounterGroup.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockResourceUsageMonitor.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockTestMetricRegistry.h"
 #include "TestUtilities/Mocks/Services/System/MockTimeService.h"
 #include "TestUtilities/Mocks/Services/System/MockUUIDGeneratorService.h"
 
@@ -24,8 +30,16 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			setUpTestProgram();
 			auto uuidGeneratorService = buildUUIDGeneratorService();
 			auto timeService = buildTimeService();
-
-			m_service = std::make_unique<service::TestCaseStartEventHandler>(m_testProgram, std::move(uuidGeneratorService), std::move(timeService));
+			m_outputCapture = std::make_shared<MockOutputCapture>();
+			m_resourceUsageMonitor = std::make_shared<MockResourceUsageMonitor>();
+			m_perfCounterGroup = std::make_shared<MockPerfCounterGroup>();
+			m_allocationTracker = std::make_shared<MockAllocationTracker>();
+			m_testMetricRegistry = std::make_shared<MockTestMetricRegistry>();
+			m_overheadGovernor = std::make_shared<MockOverheadGovernor>();
+
+			m_service = std::make_unique<service::TestCaseStartEventHandler>(m_testProgram, std::move(uuidGeneratorService), std::move(timeService),
+			                                                                 m_outputCapture, m_resourceUsageMonitor, m_perfCounterGroup, m_allocationTracker,
+			                                                                 m_testMetricRegistry, m_overheadGovernor);
 		}
 
 		void setUpTestProgram()
@@ -70,6 +84,12 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		model::TestProgram m_testProgram;
 		MockUUIDGeneratorService* m_uuidGeneratorService;
 		MockTimeService* m_timeService;
+		std::shared_ptr<MockOutputCapture> m_outputCapture;
+		std::shared_ptr<MockResourceUsageMonitor> m_resourceUsageMonitor;
+		std::shared_ptr<MockPerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<MockAllocationTracker> m_allocationTracker;
+		std::shared_ptr<MockTestMetricRegistry> m_testMetricRegistry;
+		std::shared_ptr<MockOverheadGovernor> m_overheadGovernor;
 
 		model::TestSuite* m_runningTestSuite;
 		std::string m_generatedUUID;
@@ -112,6 +132,26 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		EXPECT_EQ(model::Status::UNKNOWN, addedTestCase.getStatus());
 	}
 
+	TEST_F(TestCaseStartEventHandlerTest, testHandleTestCaseStartBeginsOutputCaptureOnceTestCaseIsRunning)
+	{
+		EXPECT_CALL(*m_outputCapture, beginTest()).WillOnce(Invoke([this]()
+		{
+			ASSERT_NE(nullptr, m_testProgram.getRunningTestCase());
+		}));
+
+		m_service->handleTestCaseStart("StartedTestCase");
+	}
+
+	TEST_F(TestCaseStartEventHandlerTest, testHandleTestCaseStartBeginsTestMeasurements)
+	{
+		EXPECT_CALL(*m_resourceUsageMonitor, beginTest()).Times(1);
+		EXPECT_CALL(*m_perfCounterGroup, beginTest()).Times(1);
+		EXPECT_CALL(*m_allocationTracker, beginTest()).Times(1);
+		EXPECT_CALL(*m_testMetricRegistry, beginTest()).Times(1);
+		EXPECT_CALL(*m_overheadGovernor, beginTest()).Times(1);
+		m_service->handleTestCaseStart("StartedTestCase");
+	}
+
 	TEST_F(TestCaseStartEventHandlerTest, testHandleTestCaseStartThrowsExceptionWhenNoRunningTestSuite)
 	{
 		m_testProgram.clearTestSuites();
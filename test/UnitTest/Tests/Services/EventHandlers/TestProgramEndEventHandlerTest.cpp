@@ -3,6 +3,8 @@
 
 #include "Model/TestProgram.h"
 
+#include "TestUtilities/Mocks/Services/Capture/MockOutputCapture.h"
+#include "TestUtilities/Mocks/Services/Report/MockChromeTraceWriter.h"
 #include "TestUtilities/Mocks/Services/Report/MockTestProgramJSONBuilder.h"
 
 
@@ -17,9 +19,11 @@ namespace systelab { namespace gtest_allure_utilities { namespace unit_test {
 		void SetUp()
 		{
 			auto testProgramJSONBuilder = buildTestProgramJSONBuilder();
+			m_outputCapture = std::make_shared<MockOutputCapture>();
+			m_chromeTraceWriter = std::make_shared<MockChromeTraceWriter>();
 
 			m_service = std::unique_ptr<service::TestProgramEndEventHandler>(new service::TestProgramEndEventHandler
-							(m_testProgram, std::move(testProgramJSONBuilder)) );
+							(m_testProgram, std::move(testProgramJSONBuilder), m_outputCapture, m_chromeTraceWriter) );
 		}
 
 		std::unique_ptr<service::ITestProgramJSONBuilder> buildTestProgramJSONBuilder()
@@ -33,6 +37,8 @@ namespace systelab { namespace gtest_allure_utilities { namespace unit_test {
 		std::unique_ptr<service::TestProgramEndEventHandler> m_service;
 		model::TestProgram m_testProgram;
 		MockTestProgramJSONBuilder* m_testProgramJSONBuilder;
+		std::shared_ptr<MockOutputCapture> m_outputCapture;
+		std::shared_ptr<MockChromeTraceWriter> m_chromeTraceWriter;
 	};
 
 
@@ -42,4 +48,22 @@ namespace systelab { namespace gtest_allure_utilities { namespace unit_test {
 		m_service->handleTestProgramEnd();
 	}
 
+	TEST_F(TestProgramEndEventHandlerTest, testHandleTestProgramEndShutsDownOutputCaptureBeforeWritingMetadata)
+	{
+		InSequence sequence;
+		EXPECT_CALL(*m_outputCapture, shutdown());
+		EXPECT_CALL(*m_testProgramJSONBuilder, buildMetadataFiles(_));
+
+		m_service->handleTestProgramEnd();
+	}
+
+	TEST_F(TestProgramEndEventHandlerTest, testHandleTestProgramEndClosesTraceAfterWritingMetadata)
+	{
+		InSequence sequence;
+		EXPECT_CALL(*m_testProgramJSONBuilder, buildMetadataFiles(_));
+		EXPECT_CALL(*m_chromeTraceWriter, close());
+
+		m_service->handleTestProgramEnd();
+	}
+
 }}}
@@ -2,10 +2,16 @@
 #include "Services/EventHandlers/TestProgramStartEventHandler.h"
 
 #include "Model/TestProgram.h"
+#include "Services/Report/ChromeTraceWriter.h"
+#include "Services/Report/DurationBaselineStore.h"
+
+#include "TestUtilities/Mocks/Services/Report/MockChromeTraceWriter.h"
+#include "TestUtilities/Mocks/Services/Report/MockDurationBaselineStore.h"
 
 
 using namespace testing;
 using namespace allure;
+using namespace allure::test_utility;
 
 namespace systelab { namespace gtest_allure { namespace unit_test {
 
@@ -13,12 +19,16 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 	{
 		void SetUp()
 		{
-			m_service = std::unique_ptr<service::TestProgramStartEventHandler>(new service::TestProgramStartEventHandler(m_testProgram) );
+			m_durationBaselineStore = std::make_shared<MockDurationBaselineStore>();
+			m_chromeTraceWriter = std::make_shared<MockChromeTraceWriter>();
+			m_service = std::unique_ptr<service::TestProgramStartEventHandler>(new service::TestProgramStartEventHandler(m_testProgram, m_durationBaselineStore, m_chromeTraceWriter) );
 		}
 
 	protected:
 		std::unique_ptr<service::TestProgramStartEventHandler> m_service;
 		model::TestProgram m_testProgram;
+		std::shared_ptr<MockDurationBaselineStore> m_durationBaselineStore;
+		std::shared_ptr<MockChromeTraceWriter> m_chromeTraceWriter;
 	};
 
 
@@ -33,4 +43,30 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		ASSERT_EQ(0, m_testProgram.getTestSuitesCount());
 	}
 
+	TEST_F(TestProgramStartEventHandlerTest, testHandleTestProgramStartLoadsDurationBaselinesWhenEnabled)
+	{
+		m_testProgram.setOutputFolder("Reports");
+		ON_CALL(*m_durationBaselineStore, isEnabled()).WillByDefault(Return(true));
+		EXPECT_CALL(*m_durationBaselineStore, loadFile(service::DurationBaselineStore::getFilepath("Reports"))).Times(1);
+
+		m_service->handleTestProgramStart();
+	}
+
+	TEST_F(TestProgramStartEventHandlerTest, testHandleTestProgramStartSkipsDurationBaselinesWhenDisabled)
+	{
+		ON_CALL(*m_durationBaselineStore, isEnabled()).WillByDefault(Return(false));
+		EXPECT_CALL(*m_durationBaselineStore, loadFile(_)).Times(0);
+
+		m_service->handleTestProgramStart();
+	}
+
+	TEST_F(TestProgramStartEventHandlerTest, testHandleTestProgramStartOpensTraceWhenEnabled)
+	{
+		m_testProgram.setOutputFolder("Reports");
+		ON_CALL(*m_chromeTraceWriter, isEnabled()).WillByDefault(Return(true));
+		EXPECT_CALL(*m_chromeTraceWriter, open(service::ChromeTraceWriter::getFilepath("Reports"))).Times(1);
+
+		m_service->handleTestProgramStart();
+	}
+
 }}}
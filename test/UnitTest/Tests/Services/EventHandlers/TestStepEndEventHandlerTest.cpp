@@ -4,9 +4,15 @@
 #include "Model/TestProgram.h"
 #include "Model/Action.h"
 
+#include "TestUtilities/Mocks/Services/Metrics/MockAllocationTracker.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockOverheadGovernor.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockPerfCounterGroup.h"
+#include "TestUtilities/Mocks/Services/Report/MockChromeTraceWriter.h"
 #include "TestUtilities/Mocks/Services/System/MockTimeService.h"
 #include "TestUtilities/Mocks/Services/System/MockUUIDGeneratorService.h"
 
+#include <algorithm>
+
 
 using namespace testing;
 using namespace allure;
@@ -21,8 +27,14 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		{
 			auto timeService = buildTimeService();
 			setUpTestProgram();
-
-			m_service = std::make_unique<service::TestStepEndEventHandler>(m_testProgram, std::move(timeService));
+			m_perfCounterGroup = std::make_shared<MockPerfCounterGroup>();
+			m_allocationTracker = std::make_shared<MockAllocationTracker>();
+			m_chromeTraceWriter = std::make_shared<MockChromeTraceWriter>();
+			m_overheadGovernor = std::make_shared<MockOverheadGovernor>();
+			ON_CALL(*m_overheadGovernor, getStepCoalescingThreshold(_)).WillByDefault(ReturnArg<0>());
+
+			m_service = std::make_unique<service::TestStepEndEventHandler>(m_testProgram, std::move(timeService), m_perfCounterGroup, m_allocationTracker,
+			                                                               m_chromeTraceWriter, m_overheadGovernor);
 		}
 
 		std::unique_ptr<service::ITimeService> buildTimeService()
@@ -33,6 +45,9 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			m_currentTime = 123456789;
 			ON_CALL(*m_timeService, getCurrentTime()).WillByDefault(Return(m_currentTime));
 
+			m_currentNanoseconds = 5000;
+			ON_CALL(*m_timeService, getMonotonicNanoseconds()).WillByDefault(Return(m_currentNanoseconds));
+
 			return timeService;
 		}
 
@@ -83,22 +98,65 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			return step;
 		}
 
+		void runNestedSteps(const std::string& name, unsigned int count, model::Status status)
+		{
+			for (unsigned int i = 0; i < count; i++)
+			{
+				m_runningTestStep->addStep(buildTestCaseStep(name, model::Stage::RUNNING));
+				m_service->handleTestStepEnd(status);
+			}
+		}
+
 	protected:
 		std::unique_ptr<service::TestStepEndEventHandler> m_service;
 		model::TestProgram m_testProgram;
 		MockTimeService* m_timeService;
+		std::shared_ptr<MockPerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<MockAllocationTracker> m_allocationTracker;
+		std::shared_ptr<MockChromeTraceWriter> m_chromeTraceWriter;
+		std::shared_ptr<MockOverheadGovernor> m_overheadGovernor;
 
 		model::Step* m_runningTestStep;
 		time_t m_currentTime;
+		int64_t m_currentNanoseconds;
 	};
 
 
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndAddsPerfCounterMetricsOfTheStep)
+	{
+		std::vector<model::Metric> metrics = { model::Metric("cycles", 42) };
+		EXPECT_CALL(*m_perfCounterGroup, endStep()).WillOnce(Return(metrics));
+
+		m_service->handleTestStepEnd(model::Status::PASSED);
+
+		const auto& stepMetrics = m_runningTestStep->getMetrics();
+		auto cycles = std::find_if(stepMetrics.begin(), stepMetrics.end(), [](const model::Metric& metric) { return metric.getName() == "cycles"; });
+		ASSERT_NE(stepMetrics.end(), cycles);
+		ASSERT_EQ(42, cycles->getValue());
+	}
+
 	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndSetsStopTimeOfRunningTestStepToCurrentTime)
 	{
 		m_service->handleTestStepEnd(model::Status::PASSED);
 		ASSERT_EQ(m_currentTime, m_runningTestStep->getStop());
 	}
 
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndSetsDurationOfRunningTestStepInNanoseconds)
+	{
+		m_runningTestStep->setStartNs(2000);
+		m_service->handleTestStepEnd(model::Status::PASSED);
+		ASSERT_EQ(3000u, m_runningTestStep->getDurationNs());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndWritesFinishedStepToTrace)
+	{
+		EXPECT_CALL(*m_chromeTraceWriter, writeStep(_)).WillOnce(Invoke([](const model::Step& step) {
+			ASSERT_EQ(model::Stage::FINISHED, step.getStage());
+		}));
+
+		m_service->handleTestStepEnd(model::Status::PASSED);
+	}
+
 	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndSetsStageOfRunningTestStepToFinished)
 	{
 		m_service->handleTestStepEnd(model::Status::PASSED);
@@ -153,4 +211,172 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 
 	INSTANTIATE_TEST_SUITE_P(Test, TestStepEndEventHandlerStatusTest, ValuesIn(testStatusData));
 
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndKeepsIdenticalSiblingsBelowCoalescingThreshold)
+	{
+		m_testProgram.setStepCoalescingThreshold(3);
+		runNestedSteps("Loop", 2, model::Status::PASSED);
+
+		ASSERT_EQ(2u, m_runningTestStep->getStepCount());
+		ASSERT_FALSE(m_runningTestStep->getStep(0)->isCoalesced());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndCoalescesIdenticalSiblingsOnceThresholdIsReached)
+	{
+		m_testProgram.setStepCoalescingThreshold(3);
+		runNestedSteps("Loop", 5, model::Status::PASSED);
+
+		ASSERT_EQ(1u, m_runningTestStep->getStepCount());
+		const model::Step& coalescedStep = *m_runningTestStep->getStep(0);
+		ASSERT_EQ("Loop", coalescedStep.getName());
+		ASSERT_TRUE(coalescedStep.isCoalesced());
+		ASSERT_EQ(5u, coalescedStep.getStatistics().getCount());
+		ASSERT_EQ(5u * 5000u, coalescedStep.getDurationNs());
+		ASSERT_EQ(5u * 5000u, coalescedStep.getStatistics().getTotal());
+		ASSERT_EQ(5000u, coalescedStep.getStatistics().getMin());
+		ASSERT_EQ(5000u, coalescedStep.getStatistics().getPercentile(99));
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndAggregatesMetricsOfCoalescedSteps)
+	{
+		m_testProgram.setStepCoalescingThreshold(3);
+		for (int i = 0; i < 4; i++)
+		{
+			auto step = buildTestCaseStep("Loop", model::Stage::RUNNING);
+			step->addMetric(model::Metric("instructions", 100 + i));
+			step->addMetric(model::Metric("peak live bytes", 10 * i, model::Metric::Aggregation::MAX));
+			m_runningTestStep->addStep(std::move(step));
+			m_service->handleTestStepEnd(model::Status::PASSED);
+		}
+
+		ASSERT_EQ(1u, m_runningTestStep->getStepCount());
+		const auto& metrics = m_runningTestStep->getStep(0)->getMetrics();
+		ASSERT_EQ(2u, metrics.size());
+		ASSERT_EQ(406, metrics[0].getValue());
+		ASSERT_EQ(30, metrics[1].getValue());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndDoesNotCoalesceSiblingsWithDifferentStatus)
+	{
+		m_testProgram.setStepCoalescingThreshold(3);
+		runNestedSteps("Loop", 3, model::Status::PASSED);
+		runNestedSteps("Loop", 1, model::Status::FAILED);
+
+		ASSERT_EQ(2u, m_runningTestStep->getStepCount());
+		ASSERT_EQ(3u, m_runningTestStep->getStep(0)->getStatistics().getCount());
+		ASSERT_FALSE(m_runningTestStep->getStep(1)->isCoalesced());
+		ASSERT_EQ(model::Status::FAILED, m_runningTestStep->getStep(1)->getStatus());
+	}
+
+	namespace {
+		unsigned int renderedNames = 0;
+
+		std::string renderFrameName(const unsigned char* data, size_t size)
+		{
+			renderedNames++;
+			return "Frame " + std::to_string(static_cast<unsigned int>(size > 0 ? data[0] : 0));
+		}
+
+		model::DeferredName buildFrameName(unsigned char frame)
+		{
+			model::DeferredName name(&renderFrameName);
+			name.append(&frame, sizeof(frame));
+			return name;
+		}
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndCoalescesFormattedNamesWithoutRenderingThem)
+	{
+		m_testProgram.setStepCoalescingThreshold(3);
+		renderedNames = 0;
+		for (unsigned char frame : { 1, 1, 1, 1, 2 })
+		{
+			auto step = buildTestCaseStep("", model::Stage::RUNNING);
+			step->setDeferredName(buildFrameName(frame));
+			m_runningTestStep->addStep(std::move(step));
+			m_service->handleTestStepEnd(model::Status::PASSED);
+		}
+
+		ASSERT_EQ(0u, renderedNames);
+		ASSERT_EQ(2u, m_runningTestStep->getStepCount());
+		ASSERT_EQ(4u, m_runningTestStep->getStep(0)->getStatistics().getCount());
+		ASSERT_EQ("Frame 2", m_runningTestStep->getStep(1)->getName());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndDoesNotCoalesceByDefault)
+	{
+		runNestedSteps("Loop", 20, model::Status::PASSED);
+
+		ASSERT_EQ(20u, m_runningTestStep->getStepCount());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndDoesNotCoalesceWhenThresholdIsZero)
+	{
+		m_testProgram.setStepCoalescingThreshold(0);
+		runNestedSteps("Loop", 20, model::Status::PASSED);
+
+		ASSERT_EQ(20u, m_runningTestStep->getStepCount());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndOnlyClosesDroppedStepWhenOneIsOpen)
+	{
+		m_testProgram.getRunningTestCase()->setOpenDroppedStepCount(1);
+		m_service->handleTestStepEnd(model::Status::PASSED);
+
+		ASSERT_EQ(0u, m_testProgram.getRunningTestCase()->getOpenDroppedStepCount());
+		ASSERT_EQ(model::Stage::RUNNING, m_runningTestStep->getStage());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndWithinBudgetRecordsBudgetAndDuration)
+	{
+		model::StepBudget budget;
+		budget.budgetNs = 10000;
+		m_service->handleTestStepEnd(model::Status::PASSED, budget);
+
+		ASSERT_EQ(model::Status::PASSED, m_runningTestStep->getStatus());
+		ASSERT_EQ("", m_runningTestStep->getStatusMessage());
+		ASSERT_EQ(1u, m_runningTestStep->getParameters().size());
+		ASSERT_EQ("budget", m_runningTestStep->getParameters()[0].getName());
+		ASSERT_EQ("10 us", m_runningTestStep->getParameters()[0].getValue());
+		ASSERT_EQ(1u, m_runningTestStep->getMetrics().size());
+		ASSERT_EQ("duration (ns)", m_runningTestStep->getMetrics()[0].getName());
+		ASSERT_EQ(5000, m_runningTestStep->getMetrics()[0].getValue());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndOverBudgetSetsExceededStatusAndMessage)
+	{
+		model::StepBudget budget;
+		budget.budgetNs = 4000;
+		budget.exceededStatus = model::Status::BROKEN;
+		m_service->handleTestStepEnd(model::Status::PASSED, budget);
+
+		ASSERT_EQ(model::Status::BROKEN, m_runningTestStep->getStatus());
+		ASSERT_EQ("Exceeded budget of 4 us by 1 us (took 5 us)", m_runningTestStep->getStatusMessage());
+		ASSERT_TRUE(m_testProgram.getRunningTestCase()->getBudgetViolations().empty());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndOverBudgetKeepsFailedStatus)
+	{
+		model::StepBudget budget;
+		budget.budgetNs = 4000;
+		budget.exceededStatus = model::Status::BROKEN;
+		m_service->handleTestStepEnd(model::Status::FAILED, budget);
+
+		ASSERT_EQ(model::Status::FAILED, m_runningTestStep->getStatus());
+		ASSERT_FALSE(m_runningTestStep->getStatusMessage().empty());
+	}
+
+	TEST_F(TestStepEndEventHandlerTest, testHandleTestStepEndOverBudgetRecordsViolationOnTestCaseWhenFailingTest)
+	{
+		model::StepBudget budget;
+		budget.budgetNs = 4000;
+		budget.failTest = true;
+		m_service->handleTestStepEnd(model::Status::PASSED, budget);
+
+		const model::TestCase& testCase = *m_testProgram.getRunningTestCase();
+		ASSERT_EQ(model::Status::FAILED, testCase.getBudgetViolationStatus());
+		ASSERT_EQ(1u, testCase.getBudgetViolations().size());
+		ASSERT_EQ("Step \"TC-2.2-Action2\": Exceeded budget of 4 us by 1 us (took 5 us)", testCase.getBudgetViolations()[0]);
+	}
+
 }}}
@@ -1,9 +1,12 @@
 #include "stdafx.h"
 #include "Services/EventHandlers/TestStepStartEventHandler.h"
 
+#include "Model/DeferredName.h"
 #include "Model/StepType.h"
 #include "Model/TestProgram.h"
 
+#include "TestUtilities/Mocks/Services/Metrics/MockAllocationTracker.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockPerfCounterGroup.h"
 #include "TestUtilities/Mocks/Services/System/MockTimeService.h"
 
 
@@ -13,14 +16,33 @@ using namespace allure::test_utility;
 
 namespace systelab { namespace gtest_allure { namespace unit_test {
 
+	namespace {
+		unsigned int renderedNameCount = 0;
+
+		std::string renderName(const unsigned char* data, size_t size)
+		{
+			renderedNameCount++;
+			return std::string(reinterpret_cast<const char*>(data), size);
+		}
+
+		model::DeferredName buildDeferredName(const std::string& name)
+		{
+			model::DeferredName deferredName(&renderName);
+			deferredName.append(name.data(), name.size());
+			return deferredName;
+		}
+	}
+
 	class TestStepStartEventHandlerTest : public testing::Test
 	{
 		void SetUp()
 		{
 			setUpTestProgram();
 			auto timeService = buildTimeService();
+			m_perfCounterGroup = std::make_shared<MockPerfCounterGroup>();
+			m_allocationTracker = std::make_shared<MockAllocationTracker>();
 
-			m_service = std::make_unique<service::TestStepStartEventHandler>(m_testProgram, std::move(timeService));
+			m_service = std::make_unique<service::TestStepStartEventHandler>(m_testProgram, std::move(timeService), m_perfCounterGroup, m_allocationTracker);
 		}
 
 		void setUpTestProgram()
@@ -67,6 +89,8 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		std::unique_ptr<service::TestStepStartEventHandler> m_service;
 		model::TestProgram m_testProgram;
 		MockTimeService* m_timeService;
+		std::shared_ptr<MockPerfCounterGroup> m_perfCounterGroup;
+		std::shared_ptr<MockAllocationTracker> m_allocationTracker;
 
 		model::TestCase* m_runningTestCase;
 		time_t m_currentTime;
@@ -105,6 +129,38 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		EXPECT_EQ(model::Status::UNKNOWN, addedTestStep.getStatus());
 	}
 
+	TEST_F(TestStepStartEventHandlerTest, testHandleTestStepStartWithDeferredNameRendersNameWhenRead)
+	{
+		renderedNameCount = 0;
+		m_service->handleTestStepStart(buildDeferredName("DeferredAction"), true);
+
+		ASSERT_EQ(1, m_runningTestCase->getStepCount());
+		model::Step& addedTestStep = *m_runningTestCase->getStep(0);
+		EXPECT_TRUE(addedTestStep.hasDeferredName());
+		EXPECT_EQ(0u, renderedNameCount);
+		EXPECT_EQ("DeferredAction", addedTestStep.getName());
+		EXPECT_EQ(1u, renderedNameCount);
+		EXPECT_EQ(model::Stage::RUNNING, addedTestStep.getStage());
+
+		addedTestStep.renderDeferredName();
+		EXPECT_FALSE(addedTestStep.hasDeferredName());
+		EXPECT_EQ("DeferredAction", addedTestStep.getName());
+		EXPECT_EQ(2u, renderedNameCount);
+	}
+
+	TEST_F(TestStepStartEventHandlerTest, testHandleTestStepStartWithDeferredNameNeverRendersDroppedStep)
+	{
+		renderedNameCount = 0;
+		m_testProgram.setMaxStepsPerTest(1);
+		m_runningTestCase->setRecordedStepCount(1);
+
+		m_service->handleTestStepStart(buildDeferredName("Dropped"), true);
+
+		ASSERT_EQ(0u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getDroppedStepCount());
+		ASSERT_EQ(0u, renderedNameCount);
+	}
+
 	TEST_F(TestStepStartEventHandlerTest, testHandleTestStepStartThrowsExceptionWhenNoRunningTestSuite)
 	{
 		m_testProgram.clearTestSuites();
@@ -122,4 +178,40 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			service::TestStepStartEventHandler::NoRunningTestCaseException);
 	}
 
+	TEST_F(TestStepStartEventHandlerTest, testHandleTestStepStartDropsStepsBeyondMaxStepsPerTest)
+	{
+		m_testProgram.setMaxStepsPerTest(2);
+		m_runningTestCase->setRecordedStepCount(2);
+
+		m_service->handleTestStepStart("Extra", true);
+
+		ASSERT_EQ(0u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getDroppedStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getOpenDroppedStepCount());
+	}
+
+	TEST_F(TestStepStartEventHandlerTest, testHandleTestStepStartDropsStepsBeyondMaxStepDepth)
+	{
+		m_testProgram.setMaxStepDepth(2);
+		m_service->handleTestStepStart("Depth1", true);
+		m_service->handleTestStepStart("Depth2", true);
+		m_service->handleTestStepStart("Depth3", true);
+
+		ASSERT_EQ(1u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getStep(0)->getStepCount());
+		ASSERT_EQ(0u, m_runningTestCase->getStep(0)->getStep(0)->getStepCount());
+		ASSERT_EQ(2u, m_runningTestCase->getRecordedStepCount());
+		ASSERT_EQ(1u, m_runningTestCase->getDroppedStepCount());
+	}
+
+	TEST_F(TestStepStartEventHandlerTest, testHandleTestStepStartDropsStepsNestedInDroppedStep)
+	{
+		m_runningTestCase->setOpenDroppedStepCount(1);
+
+		m_service->handleTestStepStart("Nested", true);
+
+		ASSERT_EQ(0u, m_runningTestCase->getStepCount());
+		ASSERT_EQ(2u, m_runningTestCase->getOpenDroppedStepCount());
+	}
+
 }}}
@@ -5,6 +5,7 @@
 
 #include "TestUtilities/Mocks/Services/System/MockTimeService.h"
 #include "TestUtilities/Mocks/Services/System/MockUUIDGeneratorService.h"
+#include "TestUtilities/Mocks/Services/Report/MockChromeTraceWriter.h"
 #include "TestUtilities/Mocks/Services/Report/MockContainerJSONSerializer.h"
 #include "TestUtilities/Mocks/Services/System/MockFileService.h"
 
@@ -24,8 +25,10 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 			auto timeService = buildTimeService();
 			auto containerJSONSerializer = buildContainerJSONSerializer();
 			auto fileService = buildFileService();
+			m_chromeTraceWriter = std::make_shared<MockChromeTraceWriter>();
 
-			m_service = std::make_unique<service::TestSuiteEndEventHandler>(m_testProgram, std::move(timeService), std::move(containerJSONSerializer), std::move(fileService));
+			m_service = std::make_unique<service::TestSuiteEndEventHandler>(m_testProgram, std::move(timeService), std::move(containerJSONSerializer), std::move(fileService),
+			                                                                m_chromeTraceWriter);
 		}
 
 		void setUpTestProgram()
@@ -77,6 +80,7 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		MockTimeService* m_timeService;
 		MockContainerJSONSerializer* m_containerJSONSerializer;
 		MockFileService* m_fileService;
+		std::shared_ptr<MockChromeTraceWriter> m_chromeTraceWriter;
 
 		model::TestSuite* m_runningTestSuite;
 		time_t m_currentTime;
@@ -140,6 +144,15 @@ namespace systelab { namespace gtest_allure { namespace unit_test {
 		m_service->handleTestSuiteEnd(model::Status::PASSED);
 	}
 
+	TEST_F(TestSuiteEndEventHandlerTest, testHandleTestSuiteEndWritesFinishedSuiteToTrace)
+	{
+		EXPECT_CALL(*m_chromeTraceWriter, writeTestSuite(_, _)).WillOnce(Invoke([](const model::TestSuite& testSuite, uint64_t) {
+			ASSERT_EQ(model::Stage::FINISHED, testSuite.getStage());
+		}));
+
+		m_service->handleTestSuiteEnd(model::Status::PASSED);
+	}
+
 	TEST_F(TestSuiteEndEventHandlerTest, testHandleTestSuiteEndUsesTestCasesFromSuiteInContainer)
 	{
 		// Add test cases to the running suite
@@ -0,0 +1,60 @@
+#include "stdafx.h"
+#include "Services/Log/LogRingBuffer.h"
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class LogRingBufferTest : public testing::Test
+	{
+	protected:
+		service::LogRingBuffer m_buffer{16};
+	};
+
+
+	TEST_F(LogRingBufferTest, testNewBufferIsEmpty)
+	{
+		ASSERT_TRUE(m_buffer.isEmpty());
+		ASSERT_EQ("", m_buffer.getContent());
+	}
+
+	TEST_F(LogRingBufferTest, testGetContentReturnsAppendedTextWhenCapacityNotExceeded)
+	{
+		m_buffer.append("one\n");
+		m_buffer.append("two\n");
+		ASSERT_FALSE(m_buffer.isEmpty());
+		ASSERT_EQ("one\ntwo\n", m_buffer.getContent());
+	}
+
+	TEST_F(LogRingBufferTest, testGetContentKeepsLastCompleteLinesWhenBufferWraps)
+	{
+		m_buffer.append("line-1\n");
+		m_buffer.append("line-2\n");
+		m_buffer.append("line-3\n");
+		ASSERT_EQ("[... 7 earlier bytes dropped ...]\nline-2\nline-3\n", m_buffer.getContent());
+	}
+
+	TEST_F(LogRingBufferTest, testAppendKeepsOnlyTailOfOversizedMessage)
+	{
+		m_buffer.append("0123456789abcdefXYZ\n");
+		ASSERT_EQ("456789abcdefXYZ\n", m_buffer.getContent());
+	}
+
+	TEST_F(LogRingBufferTest, testResetEmptiesBuffer)
+	{
+		m_buffer.append("line\n");
+		m_buffer.reset();
+		ASSERT_TRUE(m_buffer.isEmpty());
+		ASSERT_EQ("", m_buffer.getContent());
+	}
+
+	TEST_F(LogRingBufferTest, testZeroCapacityDisablesBuffer)
+	{
+		m_buffer.setCapacity(0);
+		m_buffer.append("line\n");
+		ASSERT_FALSE(m_buffer.isEnabled());
+		ASSERT_TRUE(m_buffer.isEmpty());
+	}
+
+}}}
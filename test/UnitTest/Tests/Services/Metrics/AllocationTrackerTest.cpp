@@ -0,0 +1,188 @@
+#include "stdafx.h"
+#include "Services/Metrics/AllocationTracker.h"
+
+#include <memory>
+#include <vector>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class AllocationTrackerTest : public testing::Test
+	{
+	public:
+		void SetUp()
+		{
+			m_tracker.setEnabled(true);
+		}
+
+	protected:
+		service::AllocationTracker m_tracker;
+	};
+
+
+	TEST_F(AllocationTrackerTest, testEndTestReportsAllocationsMadeDuringTest)
+	{
+		m_tracker.recordAllocation(10, 16);
+		m_tracker.beginTest();
+		m_tracker.recordAllocation(100, 112);
+		m_tracker.recordAllocation(20, 32);
+		m_tracker.recordDeallocation(112);
+		service::AllocationTracker::Usage usage = m_tracker.endTest();
+
+		ASSERT_EQ(2, usage.allocations);
+		ASSERT_EQ(120, usage.bytesAllocated);
+		ASSERT_EQ(144, usage.peakLiveBytes);
+	}
+
+	TEST_F(AllocationTrackerTest, testPeakLiveBytesIsRelativeToLiveBytesAtTestStart)
+	{
+		m_tracker.recordAllocation(1000, 1000);
+		m_tracker.beginTest();
+		m_tracker.recordDeallocation(1000);
+		m_tracker.recordAllocation(10, 10);
+		service::AllocationTracker::Usage usage = m_tracker.endTest();
+
+		ASSERT_EQ(0, usage.peakLiveBytes);
+	}
+
+	TEST_F(AllocationTrackerTest, testStepsReportTheirOwnAllocationsAndTestIncludesThem)
+	{
+		m_tracker.beginTest();
+		m_tracker.recordAllocation(10, 10);
+
+		m_tracker.beginStep();
+		m_tracker.recordAllocation(200, 200);
+		m_tracker.recordDeallocation(200);
+		service::AllocationTracker::Usage stepUsage = m_tracker.endStep();
+
+		m_tracker.recordAllocation(50, 50);
+		service::AllocationTracker::Usage testUsage = m_tracker.endTest();
+
+		ASSERT_EQ(1, stepUsage.allocations);
+		ASSERT_EQ(200, stepUsage.bytesAllocated);
+		ASSERT_EQ(200, stepUsage.peakLiveBytes);
+		ASSERT_EQ(3, testUsage.allocations);
+		ASSERT_EQ(260, testUsage.bytesAllocated);
+		ASSERT_EQ(210, testUsage.peakLiveBytes);
+	}
+
+	TEST_F(AllocationTrackerTest, testEndTestClosesStepsLeftOpen)
+	{
+		m_tracker.beginTest();
+		m_tracker.beginStep();
+		m_tracker.beginStep();
+		m_tracker.recordAllocation(30, 30);
+		service::AllocationTracker::Usage usage = m_tracker.endTest();
+
+		ASSERT_EQ(1, usage.allocations);
+		ASSERT_EQ(0, m_tracker.endStep().allocations);
+	}
+
+	TEST_F(AllocationTrackerTest, testStepsOutsideOfTestAreIgnored)
+	{
+		m_tracker.beginStep();
+		m_tracker.recordAllocation(30, 30);
+
+		ASSERT_EQ(0, m_tracker.endStep().allocations);
+	}
+
+	TEST_F(AllocationTrackerTest, testAllocationsInsidePauseAreNotCounted)
+	{
+		m_tracker.beginTest();
+		{
+			service::AllocationTracker::Pause pause;
+			ASSERT_TRUE(service::AllocationTracker::isPaused());
+			m_tracker.recordAllocation(100, 100);
+		}
+		ASSERT_FALSE(service::AllocationTracker::isPaused());
+		m_tracker.recordAllocation(10, 10);
+		service::AllocationTracker::Usage usage = m_tracker.endTest();
+
+		ASSERT_EQ(1, usage.allocations);
+		ASSERT_EQ(10, usage.bytesAllocated);
+	}
+
+	TEST_F(AllocationTrackerTest, testFreeingUncountedBlockNeverTakesLiveBytesBelowZero)
+	{
+		m_tracker.beginTest();
+		{
+			service::AllocationTracker::Pause pause;
+			ASSERT_FALSE(m_tracker.recordAllocation(1000, 1000));
+		}
+		m_tracker.recordDeallocation(1000);
+		m_tracker.recordAllocation(500, 500);
+		service::AllocationTracker::Usage usage = m_tracker.endTest();
+
+		ASSERT_EQ(500, usage.peakLiveBytes);
+	}
+
+	TEST_F(AllocationTrackerTest, testCountedBlockFreedWhilePausedIsReleased)
+	{
+		m_tracker.beginTest();
+		ASSERT_TRUE(m_tracker.recordAllocation(100, 100));
+		{
+			service::AllocationTracker::Pause pause;
+			m_tracker.recordCountedDeallocation(100);
+		}
+		m_tracker.recordAllocation(50, 50);
+		service::AllocationTracker::Usage usage = m_tracker.endTest();
+
+		ASSERT_EQ(100, usage.peakLiveBytes);
+	}
+
+	TEST_F(AllocationTrackerTest, testNothingIsCountedWhenDisabled)
+	{
+		m_tracker.setEnabled(false);
+		m_tracker.beginTest();
+		m_tracker.recordAllocation(10, 10);
+		service::AllocationTracker::Usage usage = m_tracker.endTest();
+
+		ASSERT_EQ(0, usage.allocations);
+	}
+
+	TEST_F(AllocationTrackerTest, testHooksCountOperatorNew)
+	{
+		service::AllocationTracker& tracker = service::AllocationTracker::instance();
+		if (!tracker.isHooked())
+		{
+			GTEST_SKIP() << "Built without ALLURE_TRACK_ALLOCATIONS";
+		}
+
+		tracker.setEnabled(true);
+		tracker.beginTest();
+		auto values = std::make_unique<std::vector<int>>(1000);
+		values.reset();
+		service::AllocationTracker::Usage usage = tracker.endTest();
+		tracker.setEnabled(false);
+
+		ASSERT_GE(usage.allocations, 2);
+		ASSERT_GE(usage.bytesAllocated, static_cast<int64_t>(1000 * sizeof(int)));
+		ASSERT_GE(usage.peakLiveBytes, static_cast<int64_t>(1000 * sizeof(int)));
+	}
+
+	TEST_F(AllocationTrackerTest, testHooksBalanceBlocksAllocatedWhilePaused)
+	{
+		service::AllocationTracker& tracker = service::AllocationTracker::instance();
+		if (!tracker.isHooked())
+		{
+			GTEST_SKIP() << "Built without ALLURE_TRACK_ALLOCATIONS";
+		}
+
+		tracker.setEnabled(true);
+		tracker.beginTest();
+		std::unique_ptr<std::vector<char>> pausedValues;
+		{
+			service::AllocationTracker::Pause pause;
+			pausedValues = std::make_unique<std::vector<char>>(1 << 20);
+		}
+		pausedValues.reset();
+		auto values = std::make_unique<std::vector<char>>(1000);
+		service::AllocationTracker::Usage usage = tracker.endTest();
+		tracker.setEnabled(false);
+
+		ASSERT_GE(usage.peakLiveBytes, 1000);
+	}
+
+}}}
@@ -0,0 +1,130 @@
+#include "stdafx.h"
+#include "Services/Metrics/OverheadGovernor.h"
+
+#include "TestUtilities/Mocks/Services/Metrics/MockSelfProfiler.h"
+
+
+using namespace testing;
+using namespace allure;
+using namespace allure::test_utility;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class OverheadGovernorTest : public testing::Test
+	{
+	public:
+		OverheadGovernorTest()
+			:m_selfProfiler(std::make_shared<MockSelfProfiler>())
+			,m_governor(m_selfProfiler)
+		{
+		}
+
+		void SetUp()
+		{
+			m_governor.setEnabled(true);
+			m_governor.setBudget(0.03);
+			m_governor.setWindow(4);
+		}
+
+	protected:
+		void recordTests(unsigned int count, uint64_t libraryNs, uint64_t testDurationNs)
+		{
+			for (unsigned int i = 0; i < count; i++)
+			{
+				m_governor.recordTest(libraryNs, testDurationNs);
+			}
+		}
+
+	protected:
+		std::shared_ptr<MockSelfProfiler> m_selfProfiler;
+		service::OverheadGovernor m_governor;
+	};
+
+
+	TEST_F(OverheadGovernorTest, testLevelIsKeptUntilWindowIsFull)
+	{
+		recordTests(3, 500, 1000);
+		ASSERT_EQ(model::CaptureLevel::FULL, m_governor.getLevel());
+
+		recordTests(1, 500, 1000);
+		ASSERT_EQ(model::CaptureLevel::COALESCED_STEPS, m_governor.getLevel());
+	}
+
+	TEST_F(OverheadGovernorTest, testLevelIsLoweredOneStepPerWindowOverBudget)
+	{
+		recordTests(8, 100, 1000);
+		ASSERT_EQ(model::CaptureLevel::STEPS_ON_FAILURE, m_governor.getLevel());
+
+		recordTests(8, 100, 1000);
+		ASSERT_EQ(model::CaptureLevel::ATTACHMENTS_ON_FAILURE, m_governor.getLevel());
+	}
+
+	TEST_F(OverheadGovernorTest, testLevelIsRestoredOnlyBelowHalfOfBudget)
+	{
+		recordTests(8, 100, 1000);
+		ASSERT_EQ(model::CaptureLevel::STEPS_ON_FAILURE, m_governor.getLevel());
+
+		recordTests(8, 20, 1000);
+		ASSERT_EQ(model::CaptureLevel::STEPS_ON_FAILURE, m_governor.getLevel());
+
+		recordTests(4, 10, 1000);
+		ASSERT_EQ(model::CaptureLevel::COALESCED_STEPS, m_governor.getLevel());
+	}
+
+	TEST_F(OverheadGovernorTest, testRatioIsComputedOverSlidingWindow)
+	{
+		recordTests(3, 0, 1000);
+		recordTests(1, 100, 1000);
+		ASSERT_EQ(model::CaptureLevel::FULL, m_governor.getLevel());
+
+		// Once the first cheap tests slide out, the window is over budget
+		recordTests(1, 100, 1000);
+		ASSERT_EQ(model::CaptureLevel::COALESCED_STEPS, m_governor.getLevel());
+	}
+
+	TEST_F(OverheadGovernorTest, testLibraryTimeOfTestIsTakenFromSelfProfilerAtNextTestStart)
+	{
+		uint64_t libraryNs = 0;
+		ON_CALL(*m_selfProfiler, getTotalNs()).WillByDefault(ReturnPointee(&libraryNs));
+		for (unsigned int i = 0; i < 4; i++)
+		{
+			m_governor.beginTest();
+			libraryNs += 500;
+			m_governor.endTest(1000);
+		}
+		ASSERT_EQ(model::CaptureLevel::FULL, m_governor.getLevel());
+
+		m_governor.beginTest();
+		ASSERT_EQ(model::CaptureLevel::COALESCED_STEPS, m_governor.getLevel());
+	}
+
+	TEST_F(OverheadGovernorTest, testReducedLevelsOverrideConfiguredDetail)
+	{
+		ASSERT_EQ(10u, m_governor.getStepCoalescingThreshold(10));
+		ASSERT_EQ(model::StepDetailPolicy::FULL, m_governor.getStepDetailPolicy(model::StepDetailPolicy::FULL));
+
+		recordTests(4, 100, 1000);
+		ASSERT_EQ(2u, m_governor.getStepCoalescingThreshold(10));
+		ASSERT_EQ(2u, m_governor.getStepCoalescingThreshold(0));
+		ASSERT_EQ(model::StepDetailPolicy::FULL, m_governor.getStepDetailPolicy(model::StepDetailPolicy::FULL));
+		ASSERT_FALSE(m_governor.isDeferringAttachments());
+
+		recordTests(4, 100, 1000);
+		ASSERT_EQ(model::StepDetailPolicy::SUMMARY_ON_PASS, m_governor.getStepDetailPolicy(model::StepDetailPolicy::FULL));
+		ASSERT_FALSE(m_governor.isDeferringAttachments());
+
+		recordTests(4, 100, 1000);
+		ASSERT_TRUE(m_governor.isDeferringAttachments());
+	}
+
+	TEST_F(OverheadGovernorTest, testDisabledGovernorAlwaysCapturesFullDetail)
+	{
+		recordTests(12, 100, 1000);
+		m_governor.setEnabled(false);
+
+		ASSERT_EQ(model::CaptureLevel::FULL, m_governor.getLevel());
+		ASSERT_EQ(10u, m_governor.getStepCoalescingThreshold(10));
+		ASSERT_FALSE(m_governor.isDeferringAttachments());
+	}
+
+}}}
@@ -0,0 +1,99 @@
+#include "stdafx.h"
+#include "Services/Metrics/PerfCounterGroup.h"
+
+#include <algorithm>
+#include <chrono>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+#if defined(__linux__)
+
+	class PerfCounterGroupTest : public testing::Test
+	{
+	public:
+		void SetUp()
+		{
+			m_group.setCounters({ model::PerfCounter::TASK_CLOCK, model::PerfCounter::CONTEXT_SWITCHES });
+			if (!m_group.isAvailable())
+			{
+				GTEST_SKIP() << "perf_event_open() is not permitted in this environment";
+			}
+		}
+
+		void spin(std::chrono::milliseconds duration)
+		{
+			volatile uint64_t accumulator = 0;
+			auto start = std::chrono::steady_clock::now();
+			while (std::chrono::steady_clock::now() - start < duration)
+			{
+				accumulator = accumulator + 1;
+			}
+		}
+
+	protected:
+		service::PerfCounterGroup m_group;
+	};
+
+
+	TEST_F(PerfCounterGroupTest, testEndTestReportsConfiguredCountersMeasuredDuringTest)
+	{
+		m_group.beginTest();
+		spin(std::chrono::milliseconds(20));
+		std::vector<model::Metric> metrics = m_group.endTest();
+
+		ASSERT_EQ(2u, metrics.size());
+		ASSERT_EQ("task clock (ns)", metrics[0].getName());
+		ASSERT_GE(metrics[0].getValue(), 10 * 1000 * 1000);
+		ASSERT_EQ("context switches", metrics[1].getName());
+	}
+
+	TEST_F(PerfCounterGroupTest, testHardwareCountersFallBackToSoftwareCountersWhenUnavailable)
+	{
+		m_group.setCounters({ model::PerfCounter::INSTRUCTIONS });
+		const auto& openCounters = m_group.getOpenCounters();
+
+		std::vector<model::PerfCounter> fallbacks = { model::PerfCounter::TASK_CLOCK, model::PerfCounter::PAGE_FAULTS,
+													  model::PerfCounter::CONTEXT_SWITCHES };
+		bool hardwareOpened = std::find(openCounters.begin(), openCounters.end(), model::PerfCounter::INSTRUCTIONS) != openCounters.end();
+		ASSERT_TRUE(hardwareOpened || (openCounters == fallbacks));
+	}
+
+	TEST_F(PerfCounterGroupTest, testNestedStepsReportTheirOwnDeltas)
+	{
+		m_group.setPerStep(true);
+		m_group.beginTest();
+		m_group.beginStep();
+		m_group.beginStep();
+		spin(std::chrono::milliseconds(5));
+		std::vector<model::Metric> innerMetrics = m_group.endStep();
+		spin(std::chrono::milliseconds(20));
+		std::vector<model::Metric> outerMetrics = m_group.endStep();
+		m_group.endTest();
+
+		ASSERT_EQ(2u, innerMetrics.size());
+		ASSERT_EQ(2u, outerMetrics.size());
+		ASSERT_GT(outerMetrics[0].getValue(), innerMetrics[0].getValue());
+	}
+
+	TEST_F(PerfCounterGroupTest, testStepsReportNothingWhenNotPerStep)
+	{
+		m_group.beginTest();
+		m_group.beginStep();
+
+		ASSERT_TRUE(m_group.endStep().empty());
+	}
+
+	TEST_F(PerfCounterGroupTest, testEndTestReportsNothingWhenNoCountersConfigured)
+	{
+		m_group.setCounters({});
+		m_group.beginTest();
+
+		ASSERT_TRUE(m_group.endTest().empty());
+	}
+
+#endif
+
+}}}
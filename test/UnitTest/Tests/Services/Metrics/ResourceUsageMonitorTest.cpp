@@ -0,0 +1,86 @@
+#include "stdafx.h"
+#include "Services/Metrics/ResourceUsageMonitor.h"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+#if defined(__linux__)
+
+	class ResourceUsageMonitorTest : public testing::Test
+	{
+	public:
+		void SetUp()
+		{
+			m_monitor.setEnabled(true);
+		}
+
+	protected:
+		service::ResourceUsageMonitor m_monitor;
+	};
+
+
+	TEST_F(ResourceUsageMonitorTest, testEndTestReportsCpuTimeSpentByTheTest)
+	{
+		m_monitor.beginTest();
+		volatile uint64_t accumulator = 0;
+		auto start = std::chrono::steady_clock::now();
+		while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(50))
+		{
+			accumulator = accumulator + 1;
+		}
+		service::ResourceUsage usage = m_monitor.endTest();
+
+		ASSERT_GE(usage.userCpuMicroseconds + usage.systemCpuMicroseconds, 20000);
+	}
+
+	TEST_F(ResourceUsageMonitorTest, testEndTestReportsPageFaultsAndRssOfTouchedMemory)
+	{
+		const size_t size = 16 * 1024 * 1024;
+		m_monitor.beginTest();
+		auto memory = std::make_unique<char[]>(size);
+		std::memset(memory.get(), 1, size);
+		service::ResourceUsage usage = m_monitor.endTest();
+
+		ASSERT_GE(usage.minorFaults, 1);
+		ASSERT_GE(usage.rssKilobytes, 8 * 1024);
+	}
+
+	TEST_F(ResourceUsageMonitorTest, testEndTestReturnsZerosWhenDisabled)
+	{
+		m_monitor.setEnabled(false);
+		m_monitor.beginTest();
+		service::ResourceUsage usage = m_monitor.endTest();
+
+		ASSERT_EQ(0, usage.userCpuMicroseconds);
+		ASSERT_EQ(0u, m_monitor.getMeasuredTestCount());
+	}
+
+	TEST_F(ResourceUsageMonitorTest, testEndTestKeepsRssUnchangedWhenNoPageWasFaultedIn)
+	{
+		m_monitor.beginTest();
+		service::ResourceUsage usage = m_monitor.endTest();
+
+		if (usage.minorFaults == 0 && usage.majorFaults == 0)
+		{
+			ASSERT_EQ(0, usage.rssKilobytes);
+		}
+	}
+
+	TEST_F(ResourceUsageMonitorTest, testSamplingOverheadIsAccountedPerTest)
+	{
+		m_monitor.beginTest();
+		m_monitor.endTest();
+
+		ASSERT_EQ(1u, m_monitor.getMeasuredTestCount());
+		ASSERT_GT(m_monitor.getTotalOverheadNanoseconds(), 0u);
+	}
+
+#endif
+
+}}}
@@ -0,0 +1,109 @@
+#include "stdafx.h"
+#include "Services/Metrics/SelfProfiler.h"
+
+#include <chrono>
+#include <nlohmann/json.hpp>
+#include <thread>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class SelfProfilerTest : public testing::Test
+	{
+	public:
+		void SetUp()
+		{
+			service::SelfProfiler::instance().reset();
+		}
+
+		void TearDown()
+		{
+			service::SelfProfiler::instance().reset();
+		}
+
+	protected:
+		const service::SelfProfiler::PhaseTotals& getPhase(const service::SelfProfiler::Totals& totals,
+														   service::SelfProfiler::Phase phase)
+		{
+			return totals.phases[static_cast<size_t>(phase)];
+		}
+	};
+
+
+	TEST_F(SelfProfilerTest, testScopeChargesPhaseOnce)
+	{
+		{
+			service::SelfProfiler::Scope scope(service::SelfProfiler::Phase::FILE_IO);
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+
+		service::SelfProfiler::Totals totals = service::SelfProfiler::instance().getTotals();
+		ASSERT_EQ(1u, getPhase(totals, service::SelfProfiler::Phase::FILE_IO).calls);
+		ASSERT_GE(getPhase(totals, service::SelfProfiler::Phase::FILE_IO).totalNs, 2000000u);
+		ASSERT_EQ(0u, getPhase(totals, service::SelfProfiler::Phase::SERIALIZATION).calls);
+	}
+
+	TEST_F(SelfProfilerTest, testNestedScopeTimeIsNotChargedToEnclosingPhase)
+	{
+		{
+			service::SelfProfiler::Scope outerScope(service::SelfProfiler::Phase::EVENT_HANDLERS);
+			service::SelfProfiler::Scope innerScope(service::SelfProfiler::Phase::SERIALIZATION);
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+
+		service::SelfProfiler::Totals totals = service::SelfProfiler::instance().getTotals();
+		uint64_t eventHandlersNs = getPhase(totals, service::SelfProfiler::Phase::EVENT_HANDLERS).totalNs;
+		uint64_t serializationNs = getPhase(totals, service::SelfProfiler::Phase::SERIALIZATION).totalNs;
+		ASSERT_EQ(1u, getPhase(totals, service::SelfProfiler::Phase::EVENT_HANDLERS).calls);
+		ASSERT_GE(serializationNs, 10000000u);
+		ASSERT_LT(eventHandlersNs, serializationNs);
+	}
+
+	TEST_F(SelfProfilerTest, testFilesAndAllocationsAreAccumulatedUntilReset)
+	{
+		service::SelfProfiler& profiler = service::SelfProfiler::instance();
+		profiler.recordFileWritten(100);
+		profiler.recordFileWritten(20);
+		profiler.recordAllocation(64);
+
+		service::SelfProfiler::Totals totals = profiler.getTotals();
+		ASSERT_EQ(2u, totals.filesWritten);
+		ASSERT_EQ(120u, totals.bytesWritten);
+		ASSERT_EQ(1u, totals.allocations);
+		ASSERT_EQ(64u, totals.bytesAllocated);
+
+		profiler.reset();
+		ASSERT_EQ(0u, profiler.getTotals().filesWritten);
+	}
+
+	TEST_F(SelfProfilerTest, testFormatJSONListsPhasesAndTotals)
+	{
+		service::SelfProfiler& profiler = service::SelfProfiler::instance();
+		profiler.recordPhase(service::SelfProfiler::Phase::SERIALIZATION, 3000);
+		profiler.recordPhase(service::SelfProfiler::Phase::FILE_IO, 5000);
+		profiler.recordFileWritten(42);
+
+		nlohmann::json j = nlohmann::json::parse(service::SelfProfiler::formatJSON(profiler.getTotals()));
+		ASSERT_EQ(8000u, j["totalNs"].get<uint64_t>());
+		ASSERT_EQ(5u, j["phases"].size());
+		ASSERT_EQ(1u, j["phases"]["serialization"]["calls"].get<uint64_t>());
+		ASSERT_EQ(5000u, j["phases"]["fileIO"]["totalNs"].get<uint64_t>());
+		ASSERT_EQ(42u, j["bytesWritten"].get<uint64_t>());
+	}
+
+	TEST_F(SelfProfilerTest, testFormatPropertiesUsesOneKeyPerTotal)
+	{
+		service::SelfProfiler& profiler = service::SelfProfiler::instance();
+		profiler.recordPhase(service::SelfProfiler::Phase::UUID_GENERATION, 1500000);
+		profiler.recordFileWritten(10);
+
+		std::string properties = service::SelfProfiler::formatProperties(profiler.getTotals());
+		ASSERT_NE(std::string::npos, properties.find("AllureOverhead=1.500 ms\n"));
+		ASSERT_NE(std::string::npos, properties.find("AllureOverhead.uuidGeneration=1.500 ms (1 calls)\n"));
+		ASSERT_NE(std::string::npos, properties.find("AllureFilesWritten=1\n"));
+		ASSERT_NE(std::string::npos, properties.find("AllureBytesWritten=10\n"));
+	}
+
+}}}
@@ -0,0 +1,244 @@
+#include "stdafx.h"
+#include "Services/Metrics/TestMetricRegistry.h"
+
+#include <nlohmann/json.hpp>
+#include <thread>
+#include <vector>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class TestMetricRegistryTest : public testing::Test
+	{
+	protected:
+		service::TestMetricRegistry m_registry;
+	};
+
+
+	TEST_F(TestMetricRegistryTest, testNothingIsRecordedOutsideOfTests)
+	{
+		ASSERT_EQ(nullptr, m_registry.getCounter("requests"));
+		ASSERT_EQ(nullptr, m_registry.getGauge("queue depth"));
+	}
+
+	TEST_F(TestMetricRegistryTest, testEndTestReportsCountersUsedDuringTest)
+	{
+		m_registry.beginTest();
+		m_registry.getCounter("requests")->fetch_add(3);
+		m_registry.getCounter("requests")->fetch_add(2);
+		m_registry.getCounter("errors")->fetch_add(1);
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(2u, metrics.counters.size());
+		ASSERT_EQ("requests", metrics.counters[0].name);
+		ASSERT_EQ(5, metrics.counters[0].value);
+		ASSERT_EQ("errors", metrics.counters[1].name);
+		ASSERT_EQ(1, metrics.counters[1].value);
+		ASSERT_EQ(nullptr, m_registry.getCounter("requests"));
+	}
+
+	TEST_F(TestMetricRegistryTest, testCountersStartFromZeroAndOnlyUsedOnesAreReported)
+	{
+		m_registry.beginTest();
+		m_registry.getCounter("requests")->fetch_add(10);
+		m_registry.getCounter("errors")->fetch_add(1);
+		m_registry.endTest();
+
+		m_registry.beginTest();
+		m_registry.getCounter("requests")->fetch_add(1);
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(1u, metrics.counters.size());
+		ASSERT_EQ("requests", metrics.counters[0].name);
+		ASSERT_EQ(1, metrics.counters[0].value);
+	}
+
+	TEST_F(TestMetricRegistryTest, testCountersOfAllThreadsAreSummed)
+	{
+		m_registry.beginTest();
+		std::vector<std::thread> threads;
+		for (int thread = 0; thread < 4; thread++)
+		{
+			threads.emplace_back([this]()
+			{
+				std::atomic<int64_t>* counter = m_registry.getCounter("items");
+				for (int i = 0; i < 10000; i++)
+				{
+					counter->fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(1u, metrics.counters.size());
+		ASSERT_EQ(40000, metrics.counters[0].value);
+	}
+
+	TEST_F(TestMetricRegistryTest, testThreadsGetDifferentCacheLines)
+	{
+		m_registry.beginTest();
+		std::atomic<int64_t>* mainSlot = m_registry.getCounter("items");
+		std::atomic<int64_t>* otherSlot = nullptr;
+		std::thread([this, &otherSlot]() { otherSlot = m_registry.getCounter("items"); }).join();
+		m_registry.endTest();
+
+		ASSERT_NE(mainSlot, otherSlot);
+		ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(mainSlot) % service::CACHE_LINE_SIZE);
+		ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(otherSlot) % service::CACHE_LINE_SIZE);
+	}
+
+	TEST_F(TestMetricRegistryTest, testCountersBeyondLimitAreIgnored)
+	{
+		m_registry.beginTest();
+		for (size_t i = 0; i < service::TestMetricRegistry::MAX_COUNTERS; i++)
+		{
+			ASSERT_NE(nullptr, m_registry.getCounter("counter " + std::to_string(i)));
+		}
+		ASSERT_EQ(nullptr, m_registry.getCounter("one too many"));
+		ASSERT_EQ(nullptr, m_registry.getCounter("one too many"));
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(service::TestMetricRegistry::MAX_COUNTERS, metrics.counters.size());
+		ASSERT_EQ(1u, metrics.droppedCounters);
+	}
+
+	TEST_F(TestMetricRegistryTest, testCounterLimitAppliesToEachTest)
+	{
+		m_registry.beginTest();
+		for (size_t i = 0; i < service::TestMetricRegistry::MAX_COUNTERS; i++)
+		{
+			m_registry.getCounter("counter " + std::to_string(i))->fetch_add(1);
+		}
+		m_registry.endTest();
+
+		m_registry.beginTest();
+		m_registry.getCounter("requests")->fetch_add(2);
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(1u, metrics.counters.size());
+		ASSERT_EQ("requests", metrics.counters[0].name);
+		ASSERT_EQ(2, metrics.counters[0].value);
+		ASSERT_EQ(0u, metrics.droppedCounters);
+	}
+
+	TEST_F(TestMetricRegistryTest, testGaugesBeyondLimitAreCountedAsDropped)
+	{
+		m_registry.beginTest();
+		for (size_t i = 0; i < service::TestMetricRegistry::MAX_GAUGES; i++)
+		{
+			ASSERT_NE(nullptr, m_registry.getGauge("gauge " + std::to_string(i)));
+		}
+		ASSERT_EQ(nullptr, m_registry.getGauge("one too many"));
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(1u, metrics.droppedGauges);
+	}
+
+	TEST_F(TestMetricRegistryTest, testGaugeReportsLastMinAndMaxValues)
+	{
+		m_registry.setSampleIntervalNanoseconds(0);
+		m_registry.beginTest();
+		service::GaugeSlot* gauge = m_registry.getGauge("queue depth");
+		m_registry.setGauge(*gauge, 5.0);
+		m_registry.setGauge(*gauge, 12.0);
+		m_registry.setGauge(*gauge, 3.0);
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(1u, metrics.gauges.size());
+		ASSERT_EQ("queue depth", metrics.gauges[0].name);
+		ASSERT_DOUBLE_EQ(3.0, metrics.gauges[0].lastValue);
+		ASSERT_DOUBLE_EQ(3.0, metrics.gauges[0].minValue);
+		ASSERT_DOUBLE_EQ(12.0, metrics.gauges[0].maxValue);
+		ASSERT_EQ(4u, metrics.gauges[0].samples.size());
+	}
+
+	TEST_F(TestMetricRegistryTest, testGaugeReportsSpikeBetweenSamples)
+	{
+		m_registry.setSampleIntervalNanoseconds(60LL * 1000 * 1000 * 1000);
+		m_registry.beginTest();
+		service::GaugeSlot* gauge = m_registry.getGauge("queue depth");
+		m_registry.setGauge(*gauge, 1.0);
+		m_registry.setGauge(*gauge, 1000.0);
+		m_registry.setGauge(*gauge, -5.0);
+		m_registry.setGauge(*gauge, 2.0);
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(2u, metrics.gauges[0].samples.size());
+		ASSERT_DOUBLE_EQ(2.0, metrics.gauges[0].lastValue);
+		ASSERT_DOUBLE_EQ(-5.0, metrics.gauges[0].minValue);
+		ASSERT_DOUBLE_EQ(1000.0, metrics.gauges[0].maxValue);
+	}
+
+	TEST_F(TestMetricRegistryTest, testGaugeIsSampledOncePerInterval)
+	{
+		m_registry.setSampleIntervalNanoseconds(60LL * 1000 * 1000 * 1000);
+		m_registry.beginTest();
+		service::GaugeSlot* gauge = m_registry.getGauge("queue depth");
+		for (int i = 1; i <= 100; i++)
+		{
+			m_registry.setGauge(*gauge, i);
+		}
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		ASSERT_EQ(2u, metrics.gauges[0].samples.size());
+		ASSERT_DOUBLE_EQ(1.0, metrics.gauges[0].samples[0].value);
+		ASSERT_DOUBLE_EQ(100.0, metrics.gauges[0].samples[1].value);
+	}
+
+	TEST_F(TestMetricRegistryTest, testFullSeriesIsDownsampledKeepingFirstAndLastSamples)
+	{
+		m_registry.setSampleIntervalNanoseconds(0);
+		m_registry.setMaxSamples(8);
+		m_registry.beginTest();
+		service::GaugeSlot* gauge = m_registry.getGauge("queue depth");
+		for (int i = 1; i <= 100; i++)
+		{
+			m_registry.setGauge(*gauge, i);
+		}
+		service::TestMetricRegistry::Metrics metrics = m_registry.endTest();
+
+		const auto& samples = metrics.gauges[0].samples;
+		ASSERT_LT(samples.size(), 8u);
+		ASSERT_DOUBLE_EQ(1.0, samples.front().value);
+		ASSERT_DOUBLE_EQ(100.0, samples.back().value);
+		for (size_t i = 1; i < samples.size(); i++)
+		{
+			ASSERT_LE(samples[i - 1].timeNs, samples[i].timeNs);
+		}
+	}
+
+	TEST_F(TestMetricRegistryTest, testFormatSeriesCSV)
+	{
+		std::vector<service::TestMetricRegistry::GaugeSeries> gauges = {
+			{ "depth", 2.0, 1.0, 2.0, { { 0, 1.0 }, { 1500000, 2.5 } } },
+			{ "a,b", 7.0, 7.0, 7.0, { { 2000000, 7.0 } } }
+		};
+
+		ASSERT_EQ("gauge,time_ms,value\n"
+				  "depth,0.000,1\n"
+				  "depth,1.500,2.5\n"
+				  "\"a,b\",2.000,7\n",
+				  service::TestMetricRegistry::formatSeriesCSV(gauges));
+	}
+
+	TEST_F(TestMetricRegistryTest, testFormatSeriesJSON)
+	{
+		std::vector<service::TestMetricRegistry::GaugeSeries> gauges = {
+			{ "depth", 2.5, 1.0, 2.5, { { 0, 1.0 }, { 1500000, 2.5 } } }
+		};
+
+		auto json = nlohmann::json::parse(service::TestMetricRegistry::formatSeriesJSON(gauges));
+
+		ASSERT_EQ("ms", json["unit"]);
+		ASSERT_EQ(2u, json["gauges"]["depth"].size());
+		ASSERT_DOUBLE_EQ(1.5, json["gauges"]["depth"][1][0].get<double>());
+		ASSERT_DOUBLE_EQ(2.5, json["gauges"]["depth"][1][1].get<double>());
+	}
+
+}}}
@@ -0,0 +1,169 @@
+#include "stdafx.h"
+#include "Services/Report/ChromeTraceWriter.h"
+
+#include "Model/Action.h"
+#include "Model/TestSuite.h"
+
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <thread>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class ChromeTraceWriterTest : public testing::Test
+	{
+		void SetUp()
+		{
+			m_traceFilepath = "ChromeTraceWriterTest.json";
+			remove(m_traceFilepath.c_str());
+		}
+
+		void TearDown()
+		{
+			remove(m_traceFilepath.c_str());
+		}
+
+	protected:
+		nlohmann::json readTraceEvents()
+		{
+			std::ifstream fileStream(m_traceFilepath);
+			std::stringstream buffer;
+			buffer << fileStream.rdbuf();
+			return nlohmann::json::parse(buffer.str())["traceEvents"];
+		}
+
+		std::vector<nlohmann::json> getCompleteEvents(const nlohmann::json& traceEvents)
+		{
+			std::vector<nlohmann::json> events;
+			for (const auto& event : traceEvents)
+			{
+				if (event["ph"] == "X")
+				{
+					events.push_back(event);
+				}
+			}
+			return events;
+		}
+
+	protected:
+		service::ChromeTraceWriter m_writer;
+		std::string m_traceFilepath;
+	};
+
+
+	TEST_F(ChromeTraceWriterTest, testClosedWriterProducesValidEmptyTrace)
+	{
+		m_writer.open(m_traceFilepath);
+		m_writer.close();
+
+		nlohmann::json traceEvents = readTraceEvents();
+		ASSERT_EQ(1u, traceEvents.size());
+		ASSERT_EQ("process_name", traceEvents[0]["name"]);
+	}
+
+	TEST_F(ChromeTraceWriterTest, testEventsAreWrittenAsCompleteEventsInMicroseconds)
+	{
+		model::Action step;
+		step.setName("Decode frame");
+		step.setStatus(model::Status::PASSED);
+		step.setStartNs(2000000);
+		step.setDurationNs(1500);
+		model::Parameter parameter;
+		parameter.setName("frame");
+		parameter.setValue("7");
+		step.addParameter(parameter);
+
+		model::TestCase testCase;
+		testCase.setUUID("uuid-1");
+		testCase.setName("testDecode");
+		testCase.setStatus(model::Status::FAILED);
+		testCase.setStartNs(1000000);
+		testCase.setDurationNs(5000000);
+
+		model::TestSuite testSuite;
+		testSuite.setName("DecoderTest");
+		testSuite.setStartNs(500000);
+
+		m_writer.open(m_traceFilepath);
+		m_writer.writeStep(step);
+		m_writer.writeTestCase(testCase);
+		m_writer.writeTestSuite(testSuite, 6000000);
+		m_writer.close();
+
+		std::vector<nlohmann::json> events = getCompleteEvents(readTraceEvents());
+		ASSERT_EQ(3u, events.size());
+		ASSERT_EQ("Decode frame", events[0]["name"]);
+		ASSERT_EQ("step", events[0]["cat"]);
+		ASSERT_DOUBLE_EQ(2000.0, events[0]["ts"].get<double>());
+		ASSERT_DOUBLE_EQ(1.5, events[0]["dur"].get<double>());
+		ASSERT_EQ("passed", events[0]["args"]["status"]);
+		ASSERT_EQ("7", events[0]["args"]["frame"]);
+
+		ASSERT_EQ("test", events[1]["cat"]);
+		ASSERT_EQ("uuid-1", events[1]["args"]["uuid"]);
+		ASSERT_EQ("failed", events[1]["args"]["status"]);
+		ASSERT_DOUBLE_EQ(5000.0, events[1]["dur"].get<double>());
+
+		ASSERT_EQ("suite", events[2]["cat"]);
+		ASSERT_DOUBLE_EQ(500.0, events[2]["ts"].get<double>());
+		ASSERT_EQ(events[0]["tid"], events[2]["tid"]);
+	}
+
+	TEST_F(ChromeTraceWriterTest, testEachThreadGetsItsOwnNamedTrack)
+	{
+		model::Action step;
+		step.setName("Work");
+
+		m_writer.open(m_traceFilepath);
+		m_writer.writeStep(step);
+		std::thread([this, &step]() { m_writer.writeStep(step); }).join();
+		m_writer.close();
+
+		nlohmann::json traceEvents = readTraceEvents();
+		std::vector<nlohmann::json> events = getCompleteEvents(traceEvents);
+		ASSERT_EQ(2u, events.size());
+		ASSERT_NE(events[0]["tid"], events[1]["tid"]);
+
+		unsigned int namedTracks = 0;
+		for (const auto& event : traceEvents)
+		{
+			namedTracks += (event["name"] == "thread_name") ? 1 : 0;
+		}
+		ASSERT_EQ(2u, namedTracks);
+	}
+
+	TEST_F(ChromeTraceWriterTest, testNothingIsWrittenWhenNotOpen)
+	{
+		model::Action step;
+		m_writer.writeStep(step);
+
+		ASSERT_FALSE(m_writer.isOpen());
+		ASSERT_FALSE(std::ifstream(m_traceFilepath).good());
+	}
+
+	TEST_F(ChromeTraceWriterTest, testStepsWrittenWhileClosingKeepTheTraceValid)
+	{
+		model::Action step;
+		step.setName("Work");
+
+		m_writer.open(m_traceFilepath);
+		std::thread writer([this, &step]()
+		{
+			for (unsigned int i = 0; i < 1000; i++)
+			{
+				m_writer.writeStep(step);
+			}
+		});
+		m_writer.close();
+		writer.join();
+
+		nlohmann::json traceEvents = readTraceEvents();
+		ASSERT_EQ("process_name", traceEvents[0]["name"]);
+		ASSERT_FALSE(m_writer.isOpen());
+	}
+
+}}}
@@ -0,0 +1,111 @@
+#include "stdafx.h"
+#include "Services/Report/DurationBaselineStore.h"
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class DurationBaselineStoreTest : public testing::Test
+	{
+	public:
+		void SetUp()
+		{
+			m_store.setEnabled(true);
+		}
+
+		void recordRuns(const std::string& historyId, const std::vector<uint64_t>& durations)
+		{
+			for (uint64_t duration : durations)
+			{
+				m_store.record(historyId, duration);
+			}
+			m_store.update();
+		}
+
+	protected:
+		service::DurationBaselineStore m_store;
+	};
+
+
+	TEST_F(DurationBaselineStoreTest, testUpdateComputesStatisticsOfRecordedDurations)
+	{
+		recordRuns("H1", { 100, 200, 300, 400, 500 });
+
+		const service::DurationBaseline* baseline = m_store.getBaseline("H1");
+		ASSERT_NE(nullptr, baseline);
+		ASSERT_EQ(5u, baseline->runs);
+		ASSERT_DOUBLE_EQ(300.0, baseline->mean);
+		ASSERT_NEAR(158.11, baseline->stddev, 0.01);
+		ASSERT_EQ(300u, baseline->p50);
+		ASSERT_EQ(500u, baseline->p95);
+	}
+
+	TEST_F(DurationBaselineStoreTest, testUpdateKeepsOnlyTheLastWindowOfDurations)
+	{
+		m_store.setWindow(5);
+		recordRuns("H1", { 1, 2, 3, 4, 5, 6, 7 });
+
+		const service::DurationBaseline* baseline = m_store.getBaseline("H1");
+		ASSERT_EQ(std::vector<uint64_t>({ 3, 4, 5, 6, 7 }), baseline->samples);
+		ASSERT_EQ(7u, baseline->runs);
+	}
+
+	TEST_F(DurationBaselineStoreTest, testSerializedBaselinesAreLoadedBack)
+	{
+		recordRuns("H1", { 100, 200, 300, 400, 500 });
+		recordRuns("H2", { 42 });
+		std::string content = m_store.serialize();
+
+		service::DurationBaselineStore loadedStore;
+		loadedStore.load(content);
+
+		ASSERT_EQ(m_store.getBaseline("H1")->samples, loadedStore.getBaseline("H1")->samples);
+		ASSERT_DOUBLE_EQ(300.0, loadedStore.getBaseline("H1")->mean);
+		ASSERT_EQ(1u, loadedStore.getBaseline("H2")->runs);
+		ASSERT_EQ(content, loadedStore.serialize());
+	}
+
+	TEST_F(DurationBaselineStoreTest, testLoadSkipsMalformedLines)
+	{
+		m_store.load("not json\n{\"historyId\":\"H1\",\"samples\":[10,20]}\n{\"samples\":[1]}\n");
+
+		ASSERT_NE(nullptr, m_store.getBaseline("H1"));
+		ASSERT_EQ(2u, m_store.getBaseline("H1")->runs);
+	}
+
+	TEST_F(DurationBaselineStoreTest, testDurationBeyondThresholdIsRegression)
+	{
+		recordRuns("H1", { 1000, 1100, 900, 1000, 1000 });
+		const service::DurationBaseline& baseline = *m_store.getBaseline("H1");
+
+		ASSERT_FALSE(m_store.isRegression(baseline, 1150));
+		ASSERT_TRUE(m_store.isRegression(baseline, 1500));
+	}
+
+	TEST_F(DurationBaselineStoreTest, testDurationWithinMinimumRelativeIncreaseIsNoRegression)
+	{
+		recordRuns("H1", { 1000, 1000, 1000, 1000, 1000 });
+		const service::DurationBaseline& baseline = *m_store.getBaseline("H1");
+
+		ASSERT_FALSE(m_store.isRegression(baseline, 1090));
+		ASSERT_TRUE(m_store.isRegression(baseline, 1110));
+	}
+
+	TEST_F(DurationBaselineStoreTest, testBaselineWithTooFewRunsFlagsNothing)
+	{
+		recordRuns("H1", { 1000, 1000, 1000, 1000 });
+
+		ASSERT_FALSE(m_store.isRegression(*m_store.getBaseline("H1"), 1000000));
+	}
+
+	TEST_F(DurationBaselineStoreTest, testRegressionMessageComparesDurationWithBaseline)
+	{
+		recordRuns("H1", { 1000000, 2000000, 3000000, 4000000, 5000000 });
+		const service::DurationBaseline& baseline = *m_store.getBaseline("H1");
+
+		ASSERT_EQ("Duration regression: 10.000 ms exceeds baseline mean 3.000 ms by 4.4 standard deviations "
+				  "(p95 5.000 ms, last 5 runs)", m_store.buildRegressionMessage(baseline, 10000000));
+	}
+
+}}}
@@ -0,0 +1,100 @@
+#include "stdafx.h"
+#include "Services/Report/FlameGraphBuilder.h"
+
+#include "Model/Action.h"
+#include "Model/TestCase.h"
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class FlameGraphBuilderTest : public testing::Test
+	{
+	protected:
+		model::TestCase buildTestCase(const std::string& name)
+		{
+			std::unique_ptr<model::Step> decodeStep = std::make_unique<model::Action>();
+			decodeStep->setName("Decode");
+			decodeStep->setDurationNs(600);
+
+			std::unique_ptr<model::Step> parseStep = std::make_unique<model::Action>();
+			parseStep->setName("Parse");
+			parseStep->setDurationNs(100);
+
+			std::unique_ptr<model::Step> loadStep = std::make_unique<model::Action>();
+			loadStep->setName("Load");
+			loadStep->setDurationNs(800);
+			loadStep->addStep(std::move(decodeStep));
+			loadStep->addStep(std::move(parseStep));
+
+			model::TestCase testCase;
+			testCase.setName(name);
+			testCase.setDurationNs(1000);
+			testCase.addStep(std::move(loadStep));
+			return testCase;
+		}
+
+	protected:
+		service::FlameGraphBuilder m_builder;
+	};
+
+
+	TEST_F(FlameGraphBuilderTest, testCollapseTestCaseRecordsSelfTimePerStepPath)
+	{
+		service::FlameGraphBuilder::Stacks stacks;
+		service::FlameGraphBuilder::collapseTestCase("Suite", buildTestCase("testLoad"), stacks);
+
+		ASSERT_EQ(4u, stacks.size());
+		ASSERT_EQ(200u, stacks["Suite;testLoad"]);
+		ASSERT_EQ(100u, stacks["Suite;testLoad;Load"]);
+		ASSERT_EQ(600u, stacks["Suite;testLoad;Load;Decode"]);
+		ASSERT_EQ(100u, stacks["Suite;testLoad;Load;Parse"]);
+	}
+
+	TEST_F(FlameGraphBuilderTest, testCollapseTestCaseSanitizesFrameSeparatorsInNames)
+	{
+		service::FlameGraphBuilder::Stacks stacks;
+		service::FlameGraphBuilder::collapseTestCase("Suite;A", buildTestCase("test\nB"), stacks);
+
+		ASSERT_EQ(200u, stacks["Suite,A;test B"]);
+	}
+
+	TEST_F(FlameGraphBuilderTest, testAddStacksMergesRunStacksByPath)
+	{
+		service::FlameGraphBuilder::Stacks stacks;
+		service::FlameGraphBuilder::collapseTestCase("Suite", buildTestCase("testLoad"), stacks);
+		m_builder.addStacks(stacks);
+		m_builder.addStacks(stacks);
+
+		service::FlameGraphBuilder::Stacks runStacks = m_builder.getRunStacks();
+		ASSERT_EQ(4u, runStacks.size());
+		ASSERT_EQ(1200u, runStacks["Suite;testLoad;Load;Decode"]);
+		ASSERT_EQ("Suite;testLoad 400\nSuite;testLoad;Load 200\nSuite;testLoad;Load;Decode 1200\nSuite;testLoad;Load;Parse 200\n",
+				  service::FlameGraphBuilder::formatCollapsed(runStacks));
+
+		m_builder.clear();
+		ASSERT_TRUE(m_builder.getRunStacks().empty());
+	}
+
+	TEST_F(FlameGraphBuilderTest, testRenderSVGDrawsOneFramePerPathWithEscapedTitles)
+	{
+		service::FlameGraphBuilder::Stacks stacks;
+		service::FlameGraphBuilder::collapseTestCase("Suite", buildTestCase("test<A&B>"), stacks);
+		std::string svg = service::FlameGraphBuilder::renderSVG(stacks, "Run \"1\"");
+
+		ASSERT_EQ(0u, svg.find("<svg xmlns=\"http://www.w3.org/2000/svg\""));
+		ASSERT_NE(std::string::npos, svg.find("Run &quot;1&quot;"));
+		ASSERT_NE(std::string::npos, svg.find("<title>test&lt;A&amp;B&gt; (0.001 ms, 100.00%)</title>"));
+		ASSERT_NE(std::string::npos, svg.find("<title>Decode (0.001 ms, 60.00%)</title>"));
+		ASSERT_EQ(std::string::npos, svg.find("test<A"));
+
+		size_t frames = 0;
+		for (size_t position = svg.find("<g>"); position != std::string::npos; position = svg.find("<g>", position + 1))
+		{
+			frames++;
+		}
+		ASSERT_EQ(6u, frames);
+	}
+
+}}}
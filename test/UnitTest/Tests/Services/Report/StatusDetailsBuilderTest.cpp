@@ -0,0 +1,68 @@
+#include "stdafx.h"
+#include "Services/Report/StatusDetailsBuilder.h"
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class StatusDetailsBuilderTest : public testing::Test
+	{
+	};
+
+
+	TEST_F(StatusDetailsBuilderTest, testDistinctFailuresAreJoinedLikeBefore)
+	{
+		service::StatusDetailsBuilder builder(0);
+		builder.addFailure("first", "a.cpp:1");
+		builder.addFailure("second", "a.cpp:2");
+
+		ASSERT_EQ("first\nsecond", builder.getMessage());
+		ASSERT_EQ("a.cpp:1\nfirst\na.cpp:2\nsecond", builder.getTrace());
+	}
+
+	TEST_F(StatusDetailsBuilderTest, testRepeatedFailuresAreListedOnceWithCount)
+	{
+		service::StatusDetailsBuilder builder(0);
+		for (int i = 0; i < 3; i++)
+		{
+			builder.addFailure("same", "a.cpp:1");
+		}
+		builder.addFailure("other", "a.cpp:2");
+
+		ASSERT_EQ("same (repeated 3 times)\nother", builder.getMessage());
+	}
+
+	TEST_F(StatusDetailsBuilderTest, testFailuresBeyondLimitAreCountedAsOmitted)
+	{
+		service::StatusDetailsBuilder builder(12);
+		builder.addFailure("failure-1", "a.cpp:1");
+		builder.addFailure("failure-2", "a.cpp:2");
+		builder.addFailure("failure-3", "a.cpp:3");
+
+		ASSERT_EQ("failure-1\n[... 2 more failures omitted ...]", builder.getMessage());
+	}
+
+	TEST_F(StatusDetailsBuilderTest, testTraceKeepsMostRecentBytesWithinLimit)
+	{
+		service::StatusDetailsBuilder builder(16);
+		for (int i = 0; i < 1000; i++)
+		{
+			builder.addFailure("failure-" + std::to_string(i), "a.cpp:" + std::to_string(i));
+		}
+
+		std::string trace = builder.getTrace();
+		ASSERT_EQ(0u, trace.find("[... "));
+		ASSERT_EQ("\nfailure-999", trace.substr(trace.size() - 12));
+		ASSERT_LE(trace.size() - trace.find('\n') - 1, 16u);
+	}
+
+	TEST_F(StatusDetailsBuilderTest, testLongFirstFailureIsCutInsteadOfOmitted)
+	{
+		service::StatusDetailsBuilder builder(4);
+		builder.addFailure("0123456789", "a.cpp:1");
+
+		ASSERT_EQ("0123\n[... 6 more bytes truncated ...]", builder.getMessage());
+	}
+
+}}}
@@ -5,10 +5,16 @@
 #include "Model/TestSuite.h"
 #include "Model/TestProgram.h"
 
+#include "Services/Metrics/SelfProfiler.h"
+#include "Services/Report/DurationBaselineStore.h"
+#include "Services/Report/FlameGraphBuilder.h"
 #include "Services/System/FileService.h"
+#include "TestUtilities/Mocks/Services/Metrics/MockSelfProfiler.h"
 #include "TestUtilities/Mocks/Services/System/MockFileService.h"
 #include "TestUtilities/Mocks/Services/Report/MockTestCaseJSONSerializer.h"
 #include "TestUtilities/Mocks/Services/Report/MockContainerJSONSerializer.h"
+#include "TestUtilities/Mocks/Services/Report/MockDurationBaselineStore.h"
+#include "TestUtilities/Mocks/Services/Report/MockFlameGraphBuilder.h"
 
 #include <cstdio>
 #include <cstdlib>
@@ -105,11 +111,17 @@ namespace systelab { namespace gtest_allure_utilities { namespace unit_test {
 			auto testCaseJSONSerializer = buildTestCaseJSONSerializer();
 			auto containerJSONSerializer = buildContainerJSONSerializer();
 			auto fileService = buildFileService();
+			m_durationBaselineStore = std::make_shared<MockDurationBaselineStore>();
+			m_flameGraphBuilder = std::make_shared<MockFlameGraphBuilder>();
+			m_selfProfiler = std::make_shared<MockSelfProfiler>();
 
 			m_service = std::make_unique<service::TestProgramJSONBuilder>(
 				std::move(testCaseJSONSerializer),
 				std::move(containerJSONSerializer),
-				std::move(fileService));
+				std::move(fileService),
+				m_durationBaselineStore,
+				m_flameGraphBuilder,
+				m_selfProfiler);
 		}
 
 		std::unique_ptr<model::TestProgram> buildTestProgram()
@@ -185,6 +197,9 @@ namespace systelab { namespace gtest_allure_utilities { namespace unit_test {
 		MockTestCaseJSONSerializer* m_testCaseJSONSerializer;
 		MockContainerJSONSerializer* m_containerJSONSerializer;
 		MockFileService* m_fileService;
+		std::shared_ptr<MockDurationBaselineStore> m_durationBaselineStore;
+		std::shared_ptr<MockFlameGraphBuilder> m_flameGraphBuilder;
+		std::shared_ptr<MockSelfProfiler> m_selfProfiler;
 
 		std::unique_ptr<model::TestProgram> m_testProgram;
 		std::string m_testProgramName;
@@ -238,6 +253,48 @@ namespace systelab { namespace gtest_allure_utilities { namespace unit_test {
 		m_service->buildJSONFiles(emptyTestProgram);
 	}
 
+	TEST_F(TestProgramJSONBuilderTest, testBuildJSONFilesSavesUpdatedDurationBaselinesWhenEnabled)
+	{
+		ON_CALL(*m_durationBaselineStore, isEnabled()).WillByDefault(Return(true));
+		ON_CALL(*m_durationBaselineStore, serialize()).WillByDefault(Return("{\"historyId\":\"H-1\"}\n"));
+		EXPECT_CALL(*m_durationBaselineStore, update()).Times(1);
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(3);
+		EXPECT_CALL(*m_fileService, saveFile(service::DurationBaselineStore::getFilepath(m_outputFolder), "{\"historyId\":\"H-1\"}\n"));
+
+		model::TestProgram emptyTestProgram;
+		emptyTestProgram.setOutputFolder(m_outputFolder);
+		m_service->buildJSONFiles(emptyTestProgram);
+	}
+
+	TEST_F(TestProgramJSONBuilderTest, testBuildJSONFilesSavesRunFlameGraphWhenEnabled)
+	{
+		service::IFlameGraphBuilder::Stacks stacks = { { "Suite;Test;Step", 1000 } };
+		ON_CALL(*m_flameGraphBuilder, isEnabled()).WillByDefault(Return(true));
+		ON_CALL(*m_flameGraphBuilder, getRunStacks()).WillByDefault(Return(stacks));
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(3);
+		EXPECT_CALL(*m_fileService, saveFile(service::FlameGraphBuilder::getCollapsedFilepath(m_outputFolder), "Suite;Test;Step 1000\n"));
+		EXPECT_CALL(*m_fileService, saveFile(service::FlameGraphBuilder::getSVGFilepath(m_outputFolder), HasSubstr("<svg")));
+
+		model::TestProgram emptyTestProgram;
+		emptyTestProgram.setOutputFolder(m_outputFolder);
+		m_service->buildJSONFiles(emptyTestProgram);
+	}
+
+	TEST_F(TestProgramJSONBuilderTest, testBuildJSONFilesSavesSelfProfileOnlyWhenEnabledAndBuiltIn)
+	{
+		service::ISelfProfiler::Totals totals;
+		totals.filesWritten = 4;
+		ON_CALL(*m_selfProfiler, isEnabled()).WillByDefault(Return(true));
+		ON_CALL(*m_selfProfiler, getTotals()).WillByDefault(Return(totals));
+		EXPECT_CALL(*m_fileService, saveFile(_, _)).Times(3);
+		EXPECT_CALL(*m_fileService, saveFile(service::SelfProfiler::getFilepath(m_outputFolder), _))
+			.Times(service::SelfProfiler::isCompiledIn() ? 1 : 0);
+
+		model::TestProgram emptyTestProgram;
+		emptyTestProgram.setOutputFolder(m_outputFolder);
+		m_service->buildJSONFiles(emptyTestProgram);
+	}
+
 	TEST_F(TestProgramJSONBuilderTest, testExecutorJsonUsesExplicitBuildValuesWhenProvided)
 	{
 #ifdef _WIN32
@@ -0,0 +1,24 @@
+#include "stdafx.h"
+#include "Services/Report/XMLUtils.h"
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class XMLUtilsTest : public testing::Test
+	{
+	};
+
+
+	TEST_F(XMLUtilsTest, testEscapeXMLReplacesMarkupCharacters)
+	{
+		ASSERT_EQ("a &lt;b&gt; &amp; &quot;c&quot;", service::escapeXML("a <b> & \"c\""));
+	}
+
+	TEST_F(XMLUtilsTest, testEscapeXMLKeepsPlainText)
+	{
+		ASSERT_EQ("decode frame 7", service::escapeXML("decode frame 7"));
+	}
+
+}}}
@@ -0,0 +1,48 @@
+#include "stdafx.h"
+#include "Services/System/ConfiguredTimeService.h"
+#include "Services/System/TimeService.h"
+
+#include "Model/TestProgram.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class ConfiguredTimeServiceTest : public testing::Test
+	{
+	public:
+		void SetUp()
+		{
+			m_service = std::make_unique<service::ConfiguredTimeService>(m_testProgram);
+		}
+
+	protected:
+		model::TestProgram m_testProgram;
+		std::unique_ptr<service::ConfiguredTimeService> m_service;
+	};
+
+
+	TEST_F(ConfiguredTimeServiceTest, testGetCurrentTimeUsesSystemTimeByDefault)
+	{
+		service::TimeService systemTimeService;
+		time_t systemTime = systemTimeService.getCurrentTime();
+
+		ASSERT_LE(std::abs(static_cast<long long>(m_service->getCurrentTime() - systemTime)), 100);
+	}
+
+	TEST_F(ConfiguredTimeServiceTest, testTimelineScaleConfiguredAfterConstructionTakesEffect)
+	{
+		m_testProgram.setTimelineScale(1000);
+		time_t currentTime1 = m_service->getCurrentTime();
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		time_t currentTime2 = m_service->getCurrentTime();
+
+		ASSERT_GE(currentTime2, currentTime1 + 10000);
+	}
+
+}}}
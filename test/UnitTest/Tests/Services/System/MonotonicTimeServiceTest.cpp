@@ -0,0 +1,87 @@
+#include "stdafx.h"
+#include "Services/System/MonotonicTimeService.h"
+#include "Services/System/TimeService.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+
+using namespace allure;
+
+namespace systelab { namespace gtest_allure { namespace unit_test {
+
+	class MonotonicTimeServiceTest : public testing::TestWithParam<bool>
+	{
+	public:
+		void SetUp()
+		{
+			m_service = std::make_unique<service::MonotonicTimeService>(GetParam());
+		}
+
+	protected:
+		std::unique_ptr<service::MonotonicTimeService> m_service;
+	};
+
+
+	TEST_P(MonotonicTimeServiceTest, testGetCurrentTimeNeverGoesBackwards)
+	{
+		time_t previousTime = m_service->getCurrentTime();
+		for (int i = 0; i < 100000; i++)
+		{
+			time_t currentTime = m_service->getCurrentTime();
+			ASSERT_GE(currentTime, previousTime);
+			previousTime = currentTime;
+		}
+	}
+
+	TEST_P(MonotonicTimeServiceTest, testGetCurrentTimeStaysCloseToSystemTime)
+	{
+		service::TimeService systemTimeService;
+		time_t systemTime = systemTimeService.getCurrentTime();
+		time_t monotonicTime = m_service->getCurrentTime();
+
+		ASSERT_LE(std::abs(static_cast<long long>(monotonicTime - systemTime)), 100);
+	}
+
+	TEST_P(MonotonicTimeServiceTest, testGetCurrentTimeAdvancesWithElapsedTime)
+	{
+		time_t currentTime1 = m_service->getCurrentTime();
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		time_t currentTime2 = m_service->getCurrentTime();
+
+		ASSERT_GE(currentTime2, currentTime1 + 40);
+	}
+
+	TEST_P(MonotonicTimeServiceTest, testServicesOfTheSameSourceShareTheAnchor)
+	{
+		service::MonotonicTimeService otherService(GetParam());
+		time_t currentTime1 = m_service->getCurrentTime();
+		time_t currentTime2 = otherService.getCurrentTime();
+
+		ASSERT_GE(currentTime2, currentTime1);
+	}
+
+	TEST_P(MonotonicTimeServiceTest, testTimelineScaleStretchesElapsedTime)
+	{
+		service::MonotonicTimeService scaledService(GetParam(), 1000);
+		time_t currentTime1 = scaledService.getCurrentTime();
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		time_t currentTime2 = scaledService.getCurrentTime();
+
+		ASSERT_GE(currentTime2, currentTime1 + 10000);
+	}
+
+	TEST_P(MonotonicTimeServiceTest, testGetMonotonicNanosecondsHasSubMillisecondResolution)
+	{
+		int64_t start = m_service->getMonotonicNanoseconds();
+		std::this_thread::sleep_for(std::chrono::microseconds(200));
+		int64_t elapsed = m_service->getMonotonicNanoseconds() - start;
+
+		ASSERT_GE(elapsed, 200000);
+	}
+
+	INSTANTIATE_TEST_SUITE_P(ClockSources, MonotonicTimeServiceTest, testing::Values(false, true));
+
+}}}